@@ -0,0 +1,142 @@
+#include "blit.h"
+#include "GLCD.h"
+#include "spece.h"
+
+uint32_t blitSpans = 0;
+uint32_t blitPixels = 0;
+
+
+// Fills a rectangle that is known to be on the screen
+static void fillSpan(int x, int y, int w, int h) {
+	GLCD_FillRect(x, y, w, h);
+	blitSpans++;
+	blitPixels += w * h;
+}
+
+// Fills the part of a rectangle that is on the screen, if any
+void drawRect(int x, int y, int w, int h) {
+	int x0 = (x > 0) ? x : 0;
+	int y0 = (y > 0) ? y : 0;
+	int x1 = (x + w < COURSE_WIDTH) ? x + w : COURSE_WIDTH;
+	int y1 = (y + h < COURSE_HEIGHT) ? y + h : COURSE_HEIGHT;
+
+	if (x0 < x1 && y0 < y1) {
+		fillSpan(x0, y0, x1 - x0, y1 - y0);
+	}
+}
+
+// A limit x limit square, like one block of a sprite
+void drawPixelsAt(int x, int y, int limit) {
+	drawRect(x, y, limit, limit);
+}
+
+// Draws a sprite: bitmap rows run along x, last row first, and each bit is a SPRITE_SCALE x SPRITE_SCALE block
+// (the same layout scene.c reads back). The sprite's rectangle is clipped once; each bit then gives one band
+// of SPRITE_SCALE lines, in which every run of lit blocks is filled as one span.
+void drawSpriteAt(int x, int y, char *bitmap, int bitmap_size) {
+	int x0 = (x > 0) ? x : 0;
+	int y0 = (y > 0) ? y : 0;
+	int x1 = (x + bitmap_size * SPRITE_SCALE < COURSE_WIDTH) ? x + bitmap_size * SPRITE_SCALE : COURSE_WIDTH;
+	int y1 = (y + SPRITE_COLS * SPRITE_SCALE < COURSE_HEIGHT) ? y + SPRITE_COLS * SPRITE_SCALE : COURSE_HEIGHT;
+
+	if (x0 >= x1 || y0 >= y1) {
+		return;
+	}
+
+	for (int bit = 0; bit < SPRITE_COLS; ++bit) {
+		int top = y + bit * SPRITE_SCALE;
+		int bottom = top + SPRITE_SCALE;
+
+		if (top < y0) top = y0;
+		if (bottom > y1) bottom = y1;
+		if (top >= bottom) {
+			continue;
+		}
+
+		for (int col = 0; col < bitmap_size; ) {
+			int start, left, right;
+
+			if (!((bitmap[bitmap_size - 1 - col] >> bit) & 1)) {
+				col++;
+				continue;
+			}
+			start = col;
+			while (col < bitmap_size && ((bitmap[bitmap_size - 1 - col] >> bit) & 1)) {
+				col++;
+			}
+
+			left = x + start * SPRITE_SCALE;
+			right = x + col * SPRITE_SCALE;
+			if (left < x0) left = x0;
+			if (right > x1) right = x1;
+			if (left < right) {
+				fillSpan(left, top, right - left, bottom - top);
+			}
+		}
+	}
+}
+
+// Palette index of pixel (x, y) of an image, which must be inside it
+int imageIndexAt(const IndexedImage *image, int x, int y) {
+	const uint8_t *row = image->pixels + y * IMAGE_STRIDE(image->w, image->bpp);
+	int bit = x * image->bpp;
+
+	return (row[bit / 8] >> (8 - image->bpp - bit % 8)) & ((1 << image->bpp) - 1);
+}
+
+// Streams part of one or more rows of an image that is known to be on the screen, expanded by the driver
+static void imageSpan(int x, int y, const IndexedImage *image, int left, int top, int w, int h,
+		const unsigned short *palette) {
+	int stride = IMAGE_STRIDE(image->w, image->bpp);
+
+	GLCD_BitmapIndexed(x, y, w, h, image->bpp, image->pixels + top * stride, stride, left, palette);
+	blitSpans++;
+	blitPixels += w * h;
+}
+
+// Draws an indexed image with its top left corner at (x, y), clipped to the screen. An opaque image is one
+// window; in a transparent one every run of drawn pixels on a row is its own span.
+void drawImageAt(int x, int y, const IndexedImage *image, const unsigned short *palette) {
+	int x0 = (x > 0) ? x : 0;
+	int y0 = (y > 0) ? y : 0;
+	int x1 = (x + image->w < COURSE_WIDTH) ? x + image->w : COURSE_WIDTH;
+	int y1 = (y + image->h < COURSE_HEIGHT) ? y + image->h : COURSE_HEIGHT;
+
+	if (x0 >= x1 || y0 >= y1) {
+		return;
+	}
+
+	if (!image->transparent) {
+		imageSpan(x0, y0, image, x0 - x, y0 - y, x1 - x0, y1 - y0, palette);
+		return;
+	}
+
+	for (int row = y0 - y; row < y1 - y; ++row) {
+		for (int col = x0 - x; col < x1 - x; ) {
+			int start;
+
+			if (imageIndexAt(image, col, row) == 0) {
+				col++;
+				continue;
+			}
+			start = col;
+			while (col < x1 - x && imageIndexAt(image, col, row) != 0) {
+				col++;
+			}
+			imageSpan(x + start, y + row, image, start, row, col - start, 1, palette);
+		}
+	}
+}
+
+// Draws a run-length coded image with its top left corner at (x, y), decoded straight into the LCD by the
+// driver. The codes cannot be skipped through cheaply, so the image is not clipped: one that is not wholly
+// on the screen is not drawn, and false returned.
+bool drawRleImage(int x, int y, const RleImage *image) {
+	if (x < 0 || y < 0 || x + image->w > COURSE_WIDTH || y + image->h > COURSE_HEIGHT) {
+		return false;
+	}
+	GLCD_BitmapRLE(x, y, image->w, image->h, image->data, image->size, image->colours ? image->palette : NULL);
+	blitSpans++;
+	blitPixels += image->w * image->h;
+	return true;
+}
@@ -0,0 +1,57 @@
+#ifndef GAME_BLIT
+#define GAME_BLIT
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "physics.h"
+
+// Drawing in the current text colour, clipped to the screen (the size of the course). Shapes may lie partly
+// or wholly off the screen, e.g. a ball resting on the right edge; only the part on the screen is sent to the
+// LCD, and never an address outside it.
+//
+// Sprites are drawn as spans: the blocks lit next to each other on the same bitmap bit make one rectangle,
+// clipped and filled through a single LCD window.
+
+void drawPixelsAt(int x, int y, int limit);
+void drawSpriteAt(int x, int y, char *bitmap, int bitmap_size);
+void drawRect(int x, int y, int w, int h);
+
+// An indexed-colour image, for multi-colour sprites and tiles: bpp (2 or 4) bits per pixel, high bits first,
+// rows top down and each row starting on a new byte. A pixel is an index into a palette of 4 or 16 RGB565
+// colours given when drawing, so the same pixels can be drawn in other colours (a palette swap) for free.
+// In a transparent image index 0 is not drawn and shows what is under it; tiles are opaque images.
+typedef struct {
+	uint8_t w;
+	uint8_t h;
+	uint8_t bpp;
+	bool transparent;
+	const uint8_t *pixels;
+} IndexedImage;
+
+#define IMAGE_STRIDE(w, bpp) (((w) * (bpp) + 7) / 8)   // bytes per row
+
+int imageIndexAt(const IndexedImage *image, int x, int y);
+void drawImageAt(int x, int y, const IndexedImage *image, const unsigned short *palette);
+
+// A run-length coded image, for whole screens that would not fit in RAM as 16 bpp (a full screen is 150 KB).
+// Pixels run left to right and rows top down, coded by tools/imagec into runs of one pixel and stretches of
+// literal pixels (the format is in GLCD_BitmapRLE). A pixel is an index into the palette, or RGB565 in two
+// bytes if the image has more colours than a palette holds.
+typedef struct {
+	uint16_t w;
+	uint16_t h;
+	uint16_t colours;                // entries of the palette, 0 if pixels are RGB565
+	const unsigned short *palette;
+	const uint8_t *data;
+	uint32_t size;                   // bytes of data
+} RleImage;
+
+#define RLE_PALETTE_MAX 256
+
+bool drawRleImage(int x, int y, const RleImage *image);
+
+// Rectangles sent to the LCD since startup, and the pixels in them
+extern uint32_t blitSpans;
+extern uint32_t blitPixels;
+
+#endif
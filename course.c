@@ -0,0 +1,427 @@
+#include "course.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+// Fixed-point fraction of a physics step, for the swept wall test
+#define STEP_ONE (1 << 16)
+
+uint32_t courseWallTests = 0;
+
+const uint16_t TERRAIN_FRICTION[4] = {
+	FRICTION_FAIRWAY,
+	19661,     // sand, 30 %
+	2621,      // ice, 4 %
+	32768,     // water, 50 %
+};
+
+
+// Bit of the grid cell holding ball position (x, y); positions are always on the course after a physics step
+static bool gridBit(const uint8_t *grid, int x, int y) {
+	uint32_t cell = (uint32_t)(y >> COURSE_CELL_SHIFT) * COURSE_GRID_W + (uint32_t)(x >> COURSE_CELL_SHIFT);
+
+	return (grid[cell >> 3] >> (cell & 7)) & 1;
+}
+
+// Sets the cells of every ball position in [x0, x1) x [y0, y1), clipped to the course
+static void markPositions(uint8_t *grid, int x0, int y0, int x1, int y1) {
+	if (x0 < 0) x0 = 0;
+	if (y0 < 0) y0 = 0;
+	if (x1 > COURSE_WIDTH + 1) x1 = COURSE_WIDTH + 1;
+	if (y1 > COURSE_HEIGHT + 1) y1 = COURSE_HEIGHT + 1;
+
+	for (int cy = y0 >> COURSE_CELL_SHIFT; cy <= (y1 - 1) >> COURSE_CELL_SHIFT && y0 < y1; ++cy) {
+		for (int cx = x0 >> COURSE_CELL_SHIFT; cx <= (x1 - 1) >> COURSE_CELL_SHIFT && x0 < x1; ++cx) {
+			uint32_t cell = (uint32_t)cy * COURSE_GRID_W + cx;
+			grid[cell >> 3] |= 1 << (cell & 7);
+		}
+	}
+}
+
+// Ball positions whose lit pixels overlap the rectangle
+static void markRect(uint8_t *grid, const CourseRect *r) {
+	markPositions(grid, r->x - COURSE_BALL_X - COURSE_BALL_W + 1, r->y - COURSE_BALL_Y - COURSE_BALL_H + 1,
+	              r->x + r->w - COURSE_BALL_X, r->y + r->h - COURSE_BALL_Y);
+}
+
+// Ball positions that spritesOverlap a sprite at `p` (ball and sprite both 3 rows, like the game uses them)
+static void markSprite(uint8_t *grid, CoursePoint p) {
+	int w = SPRITE_COLS * SPRITE_SCALE;
+	int h = 3 * SPRITE_SCALE;
+
+	markPositions(grid, p.x - w + 1, p.y - h + 1, p.x + w, p.y + h);
+}
+
+// 2-bit terrain of cell (cx, cy): the row is a shift, the cell's bits a shift and a mask
+static int terrainCell(const uint8_t *terrain, int cx, int cy) {
+	uint32_t cell = ((uint32_t)cy << COURSE_TERRAIN_ROW_SHIFT) | cx;
+
+	return (terrain[cell >> 2] >> ((cell & 3) << 1)) & 3;
+}
+
+static int clampBucket(int v, int count) {
+	v >>= COURSE_BUCKET_SHIFT;
+	return (v < 0) ? 0 : (v >= count) ? count - 1 : v;
+}
+
+// Buckets touched by the screen box [x0, x1) x [y0, y1)
+static void bucketRange(int x0, int y0, int x1, int y1, int *bx0, int *by0, int *bx1, int *by1) {
+	*bx0 = clampBucket(x0, COURSE_BUCKETS_W);
+	*by0 = clampBucket(y0, COURSE_BUCKETS_H);
+	*bx1 = clampBucket(x1 - 1, COURSE_BUCKETS_W);
+	*by1 = clampBucket(y1 - 1, COURSE_BUCKETS_H);
+}
+
+// A wall touching several of the queried buckets is listed in each of them; it is only tested in the bucket
+// holding the top-left corner of its overlap with the query box, so no wall is tested twice
+static bool firstBucket(const CourseRect *w, int x0, int y0, int bx, int by) {
+	return clampBucket((w->x > x0) ? w->x : x0, COURSE_BUCKETS_W) == bx &&
+	       clampBucket((w->y > y0) ? w->y : y0, COURSE_BUCKETS_H) == by;
+}
+
+// Step fractions at which the ball's origin enters and leaves the open interval (lo, hi) of one axis while
+// moving from `from` by `delta`. Returns false if it never is inside.
+static bool axisSpan(int from, int delta, int lo, int hi, int32_t *enter, int32_t *leave) {
+	if (delta == 0) {
+		*enter = INT32_MIN;
+		*leave = INT32_MAX;
+		return from > lo && from < hi;
+	}
+	if (delta > 0) {
+		*enter = (int32_t)(((lo - from) * STEP_ONE) / delta);
+		*leave = (int32_t)(((hi - from) * STEP_ONE) / delta);
+	} else {
+		*enter = (int32_t)(((hi - from) * STEP_ONE) / delta);
+		*leave = (int32_t)(((lo - from) * STEP_ONE) / delta);
+	}
+	return true;
+}
+
+// Swept test of the ball's lit box moving from `from` to `to` against a wall. Returns the step fraction at
+// which it starts to overlap the wall and which axes it came in on (bit 0: x, bit 1: y), or -1 if it does not
+// hit it during the step. A ball that already overlaps the wall at `from` is let out rather than trapped.
+static int32_t sweepWall(const CourseRect *w, Pos from, Pos to, int *axes) {
+	int32_t enterX, leaveX, enterY, leaveY, enter, leave;
+
+	courseWallTests++;
+	if (!axisSpan(from.x, to.x - from.x, w->x - COURSE_BALL_X - COURSE_BALL_W, w->x + w->w - COURSE_BALL_X, &enterX, &leaveX) ||
+	    !axisSpan(from.y, to.y - from.y, w->y - COURSE_BALL_Y - COURSE_BALL_H, w->y + w->h - COURSE_BALL_Y, &enterY, &leaveY)) {
+		return -1;
+	}
+
+	enter = (enterX > enterY) ? enterX : enterY;
+	leave = (leaveX < leaveY) ? leaveX : leaveY;
+	if (enter >= leave || enter >= STEP_ONE || enter < 0) {
+		return -1;
+	}
+
+	*axes = (enterX == enter ? 1 : 0) | (enterY == enter ? 2 : 0);
+	return enter;
+}
+
+// Earliest wall hit on the way from `from` to `to`, or -1; only the walls of the buckets of the swept box
+static int firstWallHit(const Course *course, Pos from, Pos to, int *axes) {
+	int x0 = ((from.x < to.x) ? from.x : to.x) + COURSE_BALL_X;
+	int y0 = ((from.y < to.y) ? from.y : to.y) + COURSE_BALL_Y;
+	int x1 = ((from.x > to.x) ? from.x : to.x) + COURSE_BALL_X + COURSE_BALL_W;
+	int y1 = ((from.y > to.y) ? from.y : to.y) + COURSE_BALL_Y + COURSE_BALL_H;
+	int bx0, by0, bx1, by1, hit = -1;
+	int32_t first = STEP_ONE;
+
+	bucketRange(x0, y0, x1, y1, &bx0, &by0, &bx1, &by1);
+	for (int by = by0; by <= by1; ++by) {
+		for (int bx = bx0; bx <= bx1; ++bx) {
+			int b = by * COURSE_BUCKETS_W + bx;
+
+			for (int k = course->bucketStart[b]; k < course->bucketStart[b + 1]; ++k) {
+				const CourseRect *w = &course->walls[course->bucketWalls[k]];
+				int wallAxes;
+				int32_t t;
+
+				// Cheap rejects first: walls outside the swept box, and walls already seen in another bucket
+				if (((w->x >= x1) | (w->x + w->w <= x0) | (w->y >= y1) | (w->y + w->h <= y0)) || !firstBucket(w, x0, y0, bx, by)) {
+					continue;
+				}
+				t = sweepWall(w, from, to, &wallAxes);
+				if (t >= 0 && t < first) {
+					first = t;
+					hit = course->bucketWalls[k];
+					*axes = wallAxes;
+				}
+			}
+		}
+	}
+	return hit;
+}
+
+
+uint32_t courseSize(const CourseHeader *header) {
+	return sizeof(CourseHeader) +
+	       (header->wallCount + header->hazardCount) * sizeof(CourseRect) +
+	       header->teleporterCount * sizeof(CourseTeleporter) +
+	       header->holeCount * sizeof(CoursePoint) +
+	       (COURSE_BUCKETS + 1) * sizeof(uint16_t) + header->cellEntries +
+	       COURSE_GRID_BYTES + COURSE_TERRAIN_BYTES;
+}
+
+// Checks a course image and points `course` into it. `data` must be 4-byte aligned.
+bool parseCourse(const uint8_t *data, uint32_t size, Course *course) {
+	const CourseHeader *header = (const CourseHeader *)data;
+	const uint8_t *p = data + sizeof(CourseHeader);
+
+	if (size < sizeof(CourseHeader) || header->magic != COURSE_MAGIC || header->version != COURSE_VERSION ||
+	    header->holeCount == 0 || courseSize(header) != size) {
+		return false;
+	}
+
+	course->header = header;
+	course->walls = (const CourseRect *)p;
+	p += header->wallCount * sizeof(CourseRect);
+	course->hazards = (const CourseRect *)p;
+	p += header->hazardCount * sizeof(CourseRect);
+	course->teleporters = (const CourseTeleporter *)p;
+	p += header->teleporterCount * sizeof(CourseTeleporter);
+	course->holes = (const CoursePoint *)p;
+	p += header->holeCount * sizeof(CoursePoint);
+	course->bucketStart = (const uint16_t *)p;
+	p += (COURSE_BUCKETS + 1) * sizeof(uint16_t);
+	course->bucketWalls = p;
+	p += header->cellEntries;
+	course->trigger = p;
+	course->terrain = p + COURSE_GRID_BYTES;
+
+	return course->bucketStart[COURSE_BUCKETS] == header->cellEntries;
+}
+
+// Lays out a course image from its objects and terrain grid (NULL: all fairway) and precomputes the wall
+// buckets and the trigger grid (the course compiler stores the result). Returns the image size, or 0 if it
+// does not fit in `capacity`.
+uint32_t assembleCourse(const CourseHeader *header, const CourseRect *walls, const CourseRect *hazards,
+                        const CourseTeleporter *teleporters, const CoursePoint *holes, const uint8_t *terrain,
+                        uint8_t *out, uint32_t capacity) {
+	CourseHeader h = *header;
+	uint16_t *bucketStart;
+	uint8_t *bucketWalls;
+	uint8_t *p = out;
+	uint32_t entries = 0;
+	Course course;
+
+	// Count the bucket entries first, the header holds their number
+	for (int i = 0; i < h.wallCount; ++i) {
+		int bx0, by0, bx1, by1;
+
+		bucketRange(walls[i].x, walls[i].y, walls[i].x + walls[i].w, walls[i].y + walls[i].h, &bx0, &by0, &bx1, &by1);
+		entries += (bx1 - bx0 + 1) * (by1 - by0 + 1);
+	}
+	if (entries > UINT16_MAX) {
+		return 0;
+	}
+	h.magic = COURSE_MAGIC;
+	h.version = COURSE_VERSION;
+	h.cellEntries = entries;
+	h.terrains = 0;
+	if (courseSize(&h) > capacity) {
+		return 0;
+	}
+
+	memcpy(p, &h, sizeof(h));                                      p += sizeof(h);
+	memcpy(p, walls, h.wallCount * sizeof(CourseRect));             p += h.wallCount * sizeof(CourseRect);
+	memcpy(p, hazards, h.hazardCount * sizeof(CourseRect));         p += h.hazardCount * sizeof(CourseRect);
+	memcpy(p, teleporters, h.teleporterCount * sizeof(CourseTeleporter));
+	p += h.teleporterCount * sizeof(CourseTeleporter);
+	memcpy(p, holes, h.holeCount * sizeof(CoursePoint));           p += h.holeCount * sizeof(CoursePoint);
+	bucketStart = (uint16_t *)p;                                   p += (COURSE_BUCKETS + 1) * sizeof(uint16_t);
+	bucketWalls = p;                                               p += entries;
+	memset(p, 0, COURSE_GRID_BYTES);
+
+	// Bucket lists, in wall order within each bucket
+	entries = 0;
+	for (int b = 0; b < COURSE_BUCKETS; ++b) {
+		int bx = b % COURSE_BUCKETS_W, by = b / COURSE_BUCKETS_W;
+
+		bucketStart[b] = entries;
+		for (int i = 0; i < h.wallCount; ++i) {
+			int bx0, by0, bx1, by1;
+
+			bucketRange(walls[i].x, walls[i].y, walls[i].x + walls[i].w, walls[i].y + walls[i].h, &bx0, &by0, &bx1, &by1);
+			if (bx >= bx0 && bx <= bx1 && by >= by0 && by <= by1) {
+				bucketWalls[entries++] = i;
+			}
+		}
+	}
+	bucketStart[COURSE_BUCKETS] = entries;
+
+	for (int i = 0; i < h.hazardCount; ++i) {
+		markRect(p, &hazards[i]);
+	}
+	for (int i = 0; i < h.teleporterCount; ++i) {
+		markSprite(p, teleporters[i].entry);
+	}
+	for (int i = 0; i < h.holeCount; ++i) {
+		markSprite(p, holes[i]);
+	}
+
+	p += COURSE_GRID_BYTES;
+	if (terrain != NULL) {
+		memcpy(p, terrain, COURSE_TERRAIN_BYTES);
+	} else {
+		memset(p, 0, COURSE_TERRAIN_BYTES);
+	}
+	for (int cy = 0; cy < COURSE_TERRAIN_ROWS; ++cy) {
+		for (int cx = 0; cx < COURSE_TERRAIN_COLS; ++cx) {
+			h.terrains |= 1 << terrainCell(p, cx, cy);
+		}
+	}
+	((CourseHeader *)out)->terrains = h.terrains;
+
+	return parseCourse(out, courseSize(&h), &course) ? courseSize(&h) : 0;
+}
+
+// True if the ball at `pos` overlaps a wall
+bool courseSolidAt(const Course *course, Pos pos) {
+	int x0 = pos.x + COURSE_BALL_X;
+	int y0 = pos.y + COURSE_BALL_Y;
+	int bx0, by0, bx1, by1;
+
+	bucketRange(x0, y0, x0 + COURSE_BALL_W, y0 + COURSE_BALL_H, &bx0, &by0, &bx1, &by1);
+	for (int by = by0; by <= by1; ++by) {
+		for (int bx = bx0; bx <= bx1; ++bx) {
+			int b = by * COURSE_BUCKETS_W + bx;
+
+			for (int k = course->bucketStart[b]; k < course->bucketStart[b + 1]; ++k) {
+				const CourseRect *w = &course->walls[course->bucketWalls[k]];
+
+				courseWallTests++;
+				if (ballInRect(pos, w)) {
+					return true;
+				}
+			}
+		}
+	}
+	return false;
+}
+
+// Sets the cells of a rectangle to a terrain: every cell it touches, or with `inward` only the cells wholly
+// inside it (so the cells never stick out of a rectangle drawn on top, like water)
+void paintTerrain(uint8_t *terrain, const CourseRect *rect, TerrainType type, bool inward) {
+	int round = inward ? (1 << COURSE_TERRAIN_SHIFT) - 1 : 0;
+	int cx0 = (rect->x + round) >> COURSE_TERRAIN_SHIFT;
+	int cy0 = (rect->y + round) >> COURSE_TERRAIN_SHIFT;
+	int cx1 = (rect->x + rect->w + ((1 << COURSE_TERRAIN_SHIFT) - 1 - round)) >> COURSE_TERRAIN_SHIFT;
+	int cy1 = (rect->y + rect->h + ((1 << COURSE_TERRAIN_SHIFT) - 1 - round)) >> COURSE_TERRAIN_SHIFT;
+
+	if (cx1 > COURSE_TERRAIN_COLS) cx1 = COURSE_TERRAIN_COLS;
+	if (cy1 > COURSE_TERRAIN_ROWS) cy1 = COURSE_TERRAIN_ROWS;
+
+	for (int cy = cy0; cy < cy1; ++cy) {
+		for (int cx = cx0; cx < cx1; ++cx) {
+			uint32_t cell = ((uint32_t)cy << COURSE_TERRAIN_ROW_SHIFT) | cx;
+			int shift = (cell & 3) << 1;
+
+			terrain[cell >> 2] = (terrain[cell >> 2] & ~(3 << shift)) | (type << shift);
+		}
+	}
+}
+
+// Terrain of a cell, in cells of 1 << COURSE_TERRAIN_SHIFT pixels
+int courseTerrainCell(const Course *course, int cx, int cy) {
+	return terrainCell(course->terrain, cx, cy);
+}
+
+// Terrain under the ball at `pos`
+int courseTerrainAt(const Course *course, Pos ball) {
+	return terrainCell(course->terrain, (ball.x + COURSE_BALL_X + COURSE_BALL_W / 2) >> COURSE_TERRAIN_SHIFT,
+	                   (ball.y + COURSE_BALL_Y + COURSE_BALL_H / 2) >> COURSE_TERRAIN_SHIFT);
+}
+
+// True if the ball at `pos` might touch a hole, teleporter or hazard; false means none of them needs testing
+bool courseTriggerAt(const Course *course, Pos pos) {
+	return gridBit(course->trigger, pos.x, pos.y);
+}
+
+// Exact test of the ball's lit pixels against a rectangle
+bool ballInRect(Pos ball, const CourseRect *rect) {
+	int x = ball.x + COURSE_BALL_X;
+	int y = ball.y + COURSE_BALL_Y;
+
+	return x < rect->x + rect->w && x + COURSE_BALL_W > rect->x &&
+	       y < rect->y + rect->h && y + COURSE_BALL_H > rect->y;
+}
+
+// Index of the teleporter the ball is on, or -1
+int courseTeleporterAt(const Course *course, Pos ball, int ballSize, int teleporterSize) {
+	if (!courseTriggerAt(course, ball)) {
+		return -1;
+	}
+
+	for (int i = 0; i < course->header->teleporterCount; ++i) {
+		Pos entry = { course->teleporters[i].entry.x, course->teleporters[i].entry.y };
+
+		if (spritesOverlap(ball, ballSize, entry, teleporterSize)) {
+			return i;
+		}
+	}
+	return -1;
+}
+
+bool courseHazardAt(const Course *course, Pos ball) {
+	if (!courseTriggerAt(course, ball)) {
+		return false;
+	}
+
+	for (int i = 0; i < course->header->hazardCount; ++i) {
+		if (ballInRect(ball, &course->hazards[i])) {
+			return true;
+		}
+	}
+	return false;
+}
+
+// One physics step on the course: the open-field step with the friction of the terrain under the ball, then
+// the move is swept against the walls near it. The ball stops flush against the first wall it meets, keeps
+// sliding along it, and bounces off it (its velocity along the blocked axis turns away from the wall).
+// Further sweeps catch walls met while sliding; a ball still blocked after that (a tight pocket between
+// walls) stays where it was and bounces straight back.
+void stepCourse(const Course *course, Pos *pos, int *xVelocity, int *yVelocity) {
+	Pos from = *pos;
+
+	if (course == NULL) {
+		stepPhysics(pos, xVelocity, yVelocity);
+		return;
+	}
+
+	stepPhysicsFriction(pos, xVelocity, yVelocity, TERRAIN_FRICTION[courseTerrainAt(course, from)]);
+	if (course->header->wallCount == 0) {
+		return;
+	}
+
+	for (int sweep = 0; ; ++sweep) {
+		int axes = 0;
+		int hit = firstWallHit(course, from, *pos, &axes);
+		const CourseRect *w;
+
+		if (hit < 0) {
+			return;
+		}
+		if (sweep == 3) {
+			*pos = from;
+			*xVelocity = -*xVelocity;
+			*yVelocity = -*yVelocity;
+			return;
+		}
+		w = &course->walls[hit];
+
+		if (axes & 1) {
+			bool right = pos->x > from.x;
+
+			pos->x = right ? w->x - COURSE_BALL_X - COURSE_BALL_W : w->x + w->w - COURSE_BALL_X;
+			*xVelocity = right ? -abs(*xVelocity) : abs(*xVelocity);
+		}
+		if (axes & 2) {
+			bool down = pos->y > from.y;
+
+			pos->y = down ? w->y - COURSE_BALL_Y - COURSE_BALL_H : w->y + w->h - COURSE_BALL_Y;
+			*yVelocity = down ? -abs(*yVelocity) : abs(*yVelocity);
+		}
+	}
+}
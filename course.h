@@ -0,0 +1,140 @@
+#ifndef GAME_COURSE
+#define GAME_COURSE
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "physics.h"
+
+// Binary course format, shared by the game (courses compiled into flash, see courseData.c) and the host tools
+// (course files memory-mapped). All fields are little-endian and the layout is:
+//
+//   CourseHeader
+//   CourseRect       walls[wallCount]
+//   CourseRect       hazards[hazardCount]       water: the ball goes back to where the shot started, +1 stroke
+//   CourseTeleporter teleporters[teleporterCount]
+//   CoursePoint      holes[holeCount]            the game picks one of them at random
+//   uint16_t         bucketStart[COURSE_BUCKETS + 1]
+//   uint8_t          bucketWalls[cellEntries]    wall indices of each bucket, bucketStart[b] .. bucketStart[b + 1]
+//   uint8_t          trigger[COURSE_GRID_BYTES]  bit-packed grid over ball positions
+//   uint8_t          terrain[COURSE_TERRAIN_BYTES]  2 bits (TerrainType) per 8 x 8 pixel cell
+//
+// Everything after the holes is precomputed by assembleCourse (tools/coursec). The buckets are a uniform grid
+// over the screen listing the walls that touch each bucket, so a physics step only tests the walls of the
+// one to four buckets its swept ball box touches: its cost follows how crowded those buckets are, not the
+// number of walls on the course.
+// The trigger grid is indexed by the ball's top-left position (what Pos holds), not by screen pixels: a trigger
+// cell is one where the ball might touch a hole, teleporter or hazard, so the exact tests only run in those.
+// The terrain grid sets the friction under the ball; rows are a power of two wide, so finding a cell is a
+// shift and an or, and reading it a shift and a mask.
+
+#define COURSE_MAGIC 0x53524347UL   // "GCRS" little-endian
+#define COURSE_VERSION 3
+
+#define COURSE_CELL_SHIFT 3         // 8 x 8 pixel cells
+#define COURSE_CELL (1 << COURSE_CELL_SHIFT)
+#define COURSE_GRID_W ((COURSE_WIDTH >> COURSE_CELL_SHIFT) + 1)    // the ball can sit on COURSE_WIDTH itself
+#define COURSE_GRID_H ((COURSE_HEIGHT >> COURSE_CELL_SHIFT) + 1)
+#define COURSE_GRID_BYTES ((COURSE_GRID_W * COURSE_GRID_H + 7) / 8)
+
+// The game draws the hole and the teleporters as static sprites of its background layer (scene.h)
+#define COURSE_MAX_TELEPORTERS 15
+
+// Spawn or teleporter exit coordinate meaning "pick at random"
+#define COURSE_RANDOM (-1)
+
+// Wall buckets, 32 x 32 screen pixels; they cover every pixel the ball's lit box can reach
+#define COURSE_BUCKET_SHIFT 5
+#define COURSE_BUCKETS_W (((COURSE_WIDTH + COURSE_BALL_X + COURSE_BALL_W) >> COURSE_BUCKET_SHIFT) + 1)
+#define COURSE_BUCKETS_H (((COURSE_HEIGHT + COURSE_BALL_Y + COURSE_BALL_H) >> COURSE_BUCKET_SHIFT) + 1)
+#define COURSE_BUCKETS (COURSE_BUCKETS_W * COURSE_BUCKETS_H)
+
+// Where the ball's lit pixels are inside its sprite box (ballBitmap), which is what walls and hazards hit
+#define COURSE_BALL_X 0
+#define COURSE_BALL_Y 9
+#define COURSE_BALL_W 9
+#define COURSE_BALL_H 9
+
+// Terrain, sampled under the centre of the ball's lit pixels
+typedef enum {
+	TERRAIN_FAIRWAY = 0,
+	TERRAIN_SAND,
+	TERRAIN_ICE,
+	TERRAIN_WATER                   // under the water hazards, which reset the ball anyway
+} TerrainType;
+
+#define COURSE_TERRAIN_SHIFT 3          // 8 x 8 pixel cells
+#define COURSE_TERRAIN_ROW_SHIFT 6      // 64 cells per row, of which 41 are used
+#define COURSE_TERRAIN_ROWS (((COURSE_HEIGHT + COURSE_BALL_Y + COURSE_BALL_H / 2) >> COURSE_TERRAIN_SHIFT) + 1)
+#define COURSE_TERRAIN_COLS (((COURSE_WIDTH + COURSE_BALL_X + COURSE_BALL_W / 2) >> COURSE_TERRAIN_SHIFT) + 1)
+#define COURSE_TERRAIN_BYTES ((COURSE_TERRAIN_ROWS << COURSE_TERRAIN_ROW_SHIFT) / 4)
+
+// Friction of each terrain, in 1/FRICTION_ONE of the speed per step
+extern const uint16_t TERRAIN_FRICTION[4];
+
+typedef struct {
+	int16_t x;
+	int16_t y;
+} CoursePoint;
+
+typedef struct {
+	int16_t x;
+	int16_t y;
+	int16_t w;
+	int16_t h;
+} CourseRect;
+
+typedef struct {
+	CoursePoint entry;
+	CoursePoint exit;               // COURSE_RANDOM: anywhere on the course, like the original teleporter
+} CourseTeleporter;
+
+typedef struct {
+	uint32_t magic;
+	uint8_t version;
+	uint8_t wallCount;
+	uint8_t hazardCount;
+	uint8_t teleporterCount;
+	uint8_t holeCount;
+	uint8_t terrains;               // bit (1 << TerrainType) set for each terrain on the course
+	uint16_t cellEntries;           // length of bucketWalls
+	CoursePoint spawn;              // COURSE_RANDOM: random, off the teleporters
+} CourseHeader;
+
+// A parsed course; every pointer points into the course data, nothing is copied
+typedef struct {
+	const CourseHeader *header;
+	const CourseRect *walls;
+	const CourseRect *hazards;
+	const CourseTeleporter *teleporters;
+	const CoursePoint *holes;
+	const uint16_t *bucketStart;
+	const uint8_t *bucketWalls;
+	const uint8_t *trigger;
+	const uint8_t *terrain;
+} Course;
+
+// Walls tested by stepCourse and courseSolidAt, for the collision benchmark (tools/collbench)
+extern uint32_t courseWallTests;
+
+// Courses compiled into the image (courseData.c, generated by tools/coursec)
+extern const uint8_t *const COURSE_DATA[];
+extern const uint32_t COURSE_SIZES[];
+extern const uint32_t NUM_COURSES;
+
+uint32_t courseSize(const CourseHeader *header);
+bool parseCourse(const uint8_t *data, uint32_t size, Course *course);
+uint32_t assembleCourse(const CourseHeader *header, const CourseRect *walls, const CourseRect *hazards,
+                        const CourseTeleporter *teleporters, const CoursePoint *holes, const uint8_t *terrain,
+                        uint8_t *out, uint32_t capacity);
+void paintTerrain(uint8_t *terrain, const CourseRect *rect, TerrainType type, bool inward);
+int courseTerrainCell(const Course *course, int cx, int cy);
+int courseTerrainAt(const Course *course, Pos ball);
+
+bool courseSolidAt(const Course *course, Pos pos);
+bool courseTriggerAt(const Course *course, Pos pos);
+bool ballInRect(Pos ball, const CourseRect *rect);
+int courseTeleporterAt(const Course *course, Pos ball, int ballSize, int teleporterSize);
+bool courseHazardAt(const Course *course, Pos ball);
+void stepCourse(const Course *course, Pos *pos, int *xVelocity, int *yVelocity);
+
+#endif
@@ -0,0 +1,120 @@
+// Generated by tools/coursec from: courses/classic.txt courses/walls.txt courses/islands.txt
+// Do not edit; edit the course descriptions and run coursec -c again.
+
+#include "course.h"
+
+// courses/classic.txt
+static const uint32_t course0[] = {
+	0x53524347, 0x01000003, 0x00000106, 0xFFFFFFFF, 0x00960064, 0xFFFFFFFF, 0x00280028, 0x00320104,
+	0x006E00A0, 0x00C8010E, 0x00BE001E, 0x001E00C8, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00003F00, 0x007E0000, 0xFC000FC0, 0x001F8000, 0x3F01FC00, 0x03F80000, 0xF0000000,
+	0x00000007, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xE0000000, 0x00000007, 0x00000FC0,
+	0x001F8000, 0x00000000, 0x00000000, 0x00000000, 0x000001FC, 0x0003F800, 0x07F00000, 0x00000000,
+	0x00000000, 0x00000000, 0x00001FC0, 0x003F8000, 0x7F000000, 0x1FC00000, 0x80000000, 0x0000003F,
+	0x00007F00, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+};
+
+// courses/walls.txt
+static const uint32_t course1[] = {
+	0x53524347, 0x01000303, 0x001C0701, 0x006E0014, 0x0000005A, 0x0096000C, 0x005A00BE, 0x0096000C,
+	0x009600EB, 0x00320028, 0x00C80028, 0x00140096, 0x006E0118, 0x00000000, 0x00010000, 0x00020002,
+	0x00020002, 0x00020002, 0x00020002, 0x00020002, 0x00040003, 0x00040004, 0x00040004, 0x00040004,
+	0x00040004, 0x00050004, 0x00060006, 0x00080007, 0x00080008, 0x00080008, 0x00080008, 0x000A0009,
+	0x000B000A, 0x000C000C, 0x000C000C, 0x000C000C, 0x000D000C, 0x000E000E, 0x0010000F, 0x00120011,
+	0x00120012, 0x00120012, 0x00120012, 0x00130012, 0x00150014, 0x00160016, 0x00160016, 0x00160016,
+	0x00160016, 0x00180017, 0x001A0019, 0x001A001A, 0x001A001A, 0x001A001A, 0x001B001A, 0x001C001C,
+	0x001C001C, 0x001C001C, 0x001C001C, 0x001C001C, 0x001C001C, 0x001C001C, 0x001C001C, 0x00000000,
+	0x01010000, 0x01010000, 0x01010000, 0x01010202, 0x01010202, 0x01010202, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0003F000, 0x07E00000,
+	0xC0000000, 0x0000000F, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFC000000, 0x00000000, 0x000001F8, 0x0003F000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x55400000, 0x00000005, 0x00000000, 0x00000000, 0x55400000,
+	0x00000005, 0x00000000, 0x00000000, 0x55400000, 0x00000005, 0x00000000, 0x00000000, 0x55400000,
+	0x00000005, 0x00000000, 0x00000000, 0x55400000, 0x00000005, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xAAA80000, 0x0000002A,
+	0x00000000, 0x00000000, 0xAAA80000, 0x0000002A, 0x00000000, 0x00000000, 0xAAA80000, 0x0000002A,
+	0x00000000, 0x00000000, 0xAAA80000, 0x0000002A, 0x00000000, 0x00000000, 0xAAA80000, 0x0000002A,
+	0x00000000, 0x00000000, 0xAAA80000, 0x0000002A, 0x00000000, 0x00000000, 0xAAA80000, 0x0000002A,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+};
+
+// courses/islands.txt
+static const uint32_t course2[] = {
+	0x53524347, 0x02000403, 0x002E0701, 0x0014000A, 0x0000003C, 0x00F0001E, 0x003C0096, 0x00B4001E,
+	0x000000E6, 0x00AA001E, 0x00780064, 0x000A0028, 0x00C8001E, 0x0028006E, 0x001400C8, 0xFFFFFFFF,
+	0x00C80122, 0x00000000, 0x00020001, 0x00020002, 0x00020002, 0x00040003, 0x00040004, 0x00050004,
+	0x00060006, 0x00080007, 0x00090008, 0x000A000A, 0x000A000A, 0x000C000B, 0x000D000C, 0x000E000E,
+	0x0010000F, 0x00100010, 0x00110010, 0x00130012, 0x00160015, 0x00170016, 0x00180018, 0x00180018,
+	0x001A0019, 0x001D001B, 0x001E001E, 0x0020001F, 0x00200020, 0x00210020, 0x00220022, 0x00240023,
+	0x00250024, 0x00260026, 0x00260026, 0x00280027, 0x00290028, 0x002A002A, 0x002A002A, 0x002A002A,
+	0x002B002A, 0x002C002C, 0x002E002D, 0x002E002E, 0x002E002E, 0x002E002E, 0x002E002E, 0x002E002E,
+	0x002E002E, 0x002E002E, 0x002E002E, 0x02020000, 0x01010000, 0x00000202, 0x02020101, 0x01030000,
+	0x02020103, 0x01030000, 0x02020103, 0x01010000, 0x00000202, 0x00000101, 0x00000101, 0x00000000,
+	0x001F8000, 0x3F000000, 0x00000000, 0x0000007E, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00007F00, 0x00FEFE00, 0xFDFC0000,
+	0xF8000001, 0x00000003, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000AAA,
+	0x00000000, 0x00000000, 0x00000000, 0x00000AAA, 0x00000000, 0x00000000, 0x00000000, 0x00000AAA,
+	0x00000000, 0x00000000, 0x00000000, 0x00000AAA, 0x00000000, 0x00000000, 0x00000000, 0x00000AAA,
+	0x00000000, 0x00000000, 0x00000000, 0x00000AAA, 0x00000000, 0x00000000, 0x00000000, 0x00000AAA,
+	0x00000000, 0x00000000, 0x00000000, 0x00000AAA, 0x00000000, 0x00000000, 0x00000000, 0x00000AAA,
+	0x00000000, 0x00000000, 0x00000000, 0x00000AAA, 0x00000000, 0x00000000, 0x00000000, 0x00000AAA,
+	0x00000000, 0x00000000, 0x00000000, 0x00000AAA, 0x00000000, 0x00000000, 0x00000000, 0x00000AAA,
+	0x00000000, 0x00000000, 0x00000000, 0x00000AAA, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00555400, 0x00000000, 0x00000000, 0x00000000, 0x00555400, 0x00000000, 0x00000000, 0x00000000,
+	0x00555400, 0x00000000, 0x00000000, 0x00000000, 0x00555400, 0x00000000, 0x00000000, 0x00000000,
+	0x00555400, 0x00000000, 0x00000000, 0x00000000, 0x00555400, 0x00000000, 0x00000000, 0x00000000,
+	0x00555400, 0x00000000, 0x00000000, 0x00000000, 0x00555400, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+};
+
+const uint8_t *const COURSE_DATA[] = {
+	(const uint8_t *)course0,
+	(const uint8_t *)course1,
+	(const uint8_t *)course2,
+};
+
+const uint32_t COURSE_SIZES[] = {
+	919,
+	951,
+	985,
+};
+
+const uint32_t NUM_COURSES = 3;
@@ -48,12 +48,21 @@ extern void GLCD_Clear          (unsigned short color);
 extern void GLCD_DrawChar       (unsigned int x,  unsigned int y, unsigned int cw, unsigned int ch, unsigned char *c);
 extern void GLCD_DisplayChar    (unsigned int ln, unsigned int col, unsigned char fi, unsigned char  c);
 extern void GLCD_DisplayString  (unsigned int ln, unsigned int col, unsigned char fi, unsigned char *s);
+extern void GLCD_DisplayStringRows (unsigned int y, unsigned int col, unsigned char fi, unsigned char *s, unsigned int row, unsigned int rows);
 extern void GLCD_ClearLn        (unsigned int ln, unsigned char fi);
 extern void GLCD_Bargraph       (unsigned int x,  unsigned int y, unsigned int w, unsigned int h, unsigned int val);
+extern void GLCD_FillRect       (unsigned int x,  unsigned int y, unsigned int w, unsigned int h);
 extern void GLCD_Bitmap         (unsigned int x,  unsigned int y, unsigned int w, unsigned int h, unsigned char *bitmap);
+extern void GLCD_BitmapIndexed  (unsigned int x,  unsigned int y, unsigned int w, unsigned int h, unsigned int bpp, const unsigned char *pix, unsigned int stride, unsigned int first, const unsigned short *palette);
+extern void GLCD_BitmapRLE      (unsigned int x,  unsigned int y, unsigned int w, unsigned int h, const unsigned char *data, unsigned int size, const unsigned short *palette);
 extern void GLCD_ScrollVertical (unsigned int dy);
+extern unsigned int GLCD_ScrollHeight (void);
 
 extern void GLCD_WrCmd          (unsigned char cmd);
 extern void GLCD_WrReg          (unsigned char reg, unsigned short val); 
 
+extern unsigned int GLCD_SpiBytes;      /* Bytes sent over SPI since startup  */
+extern unsigned int GLCD_ElidedWrites;  /* Register writes skipped, unchanged */
+extern unsigned int GLCD_GlyphMisses;   /* Glyphs expanded from the font      */
+
 #endif /* _GLCD_H */
@@ -17,9 +17,23 @@
 
 /************************** Orientation  configuration ************************/
 
+#ifndef LANDSCAPE
 #define LANDSCAPE   1                   /* 1 for landscape, 0 for portrait    */
+#endif
 #define ROTATE180   0                   /* 1 to rotate the screen for 180 deg */
 
+/************************** Controller configuration **************************/
+
+#define CTRL_DETECT 0                   /* Read the controller ID at init     */
+#define CTRL_HIMAX  1                   /* HX8347-D                           */
+#define CTRL_ILI    2                   /* ILI932x, SPFD5408, RM68050         */
+
+/* A fixed controller skips the detection and calls its addressing functions
+   directly instead of through the controller table                           */
+#ifndef GLCD_CONTROLLER
+#define GLCD_CONTROLLER CTRL_DETECT
+#endif
+
 /*********************** Hardware specific configuration **********************/
 
 /* SPI Interface: SPI3
@@ -72,6 +86,13 @@
 #define DAT_MODE(x) ((x == OUT) ? (LPC_GPIO0->FIODIR |= PIN_DAT) : (LPC_GPIO0->FIODIR &= ~PIN_DAT))
 #define BUS_VAL()                ((LPC_GPIO0->FIOPIN  & PIN_DAT) != 0)
 
+/* Host build: the SSP and chip select go to a model of the LCD (tools)       */
+#ifdef GLCD_MODEL
+#include "lcdmodel.h"
+#undef  LCD_CS
+#define LCD_CS(x)   lcd_model_cs(x)
+#endif
+
 
 #define SPI_START   (0x70)              /* Start byte for SPI transfer        */
 #define SPI_RD      (0x01)              /* WR bit 1 within start              */
@@ -87,7 +108,68 @@
 
 /******************************************************************************/
 static volatile unsigned short Color[2] = {White, Black};
-static unsigned char Himax;
+
+/* Bytes sent to the LCD over SPI since startup                               */
+unsigned int GLCD_SpiBytes = 0;
+
+/* Register writes skipped because the register already held the value       */
+unsigned int GLCD_ElidedWrites = 0;
+
+/* Shadow copy of the address, window and scroll registers (all below 0x80),
+   with a valid bit each: wr_reg_shadow skips a write that would not change
+   the register. Only those registers go through it, anything else written
+   to them must update or forget the shadow.                                  */
+#define SHADOW_REGS 0x80
+static unsigned short shadow[SHADOW_REGS];
+static unsigned int   shadow_valid[SHADOW_REGS / 32];
+
+#define SHADOWED(reg)       ((shadow_valid[(reg) >> 5] >> ((reg) & 31)) & 1)
+#define SHADOW_SET(reg, v)  (shadow[reg] = (v), shadow_valid[(reg) >> 5] |=  (1u << ((reg) & 31)))
+#define SHADOW_FORGET(reg)  (shadow_valid[(reg) >> 5] &= ~(1u << ((reg) & 31)))
+
+/* Glyphs recently drawn by GLCD_DisplayString and GLCD_DisplayChar, kept
+   expanded to the colours they were drawn in. Each font has its own slots,
+   sized for it: a 6x8 slot takes 108 bytes of RAM and a 16x24 one 780, so
+   the defaults cost 1.7 KB + 1.5 KB. Each count must be at least 1.         */
+#ifndef GLCD_GLYPHS_6x8
+#define GLCD_GLYPHS_6x8   16            /* The HUD's font                     */
+#endif
+#ifndef GLCD_GLYPHS_16x24
+#define GLCD_GLYPHS_16x24 2             /* The scrolling console's font       */
+#endif
+
+typedef struct {
+  unsigned short fg, bg;                /* Colours it was expanded in         */
+  unsigned char  c;                     /* Character, from ' '                */
+  unsigned int   used;                  /* glyph_clock at last use, 0 if free */
+} Glyph;
+
+/* 6x8 slots first, then 16x24; slot k of a font keeps its pixels, rows top
+   down, in glyph_pix_6x8[k] or glyph_pix_16x24[k]                           */
+static Glyph glyphs[GLCD_GLYPHS_6x8 + GLCD_GLYPHS_16x24];
+static unsigned short glyph_pix_6x8[GLCD_GLYPHS_6x8][6*8];
+static unsigned short glyph_pix_16x24[GLCD_GLYPHS_16x24][16*24];
+static unsigned int glyph_clock;
+
+/* Glyphs expanded from the font since startup (cache misses)                 */
+unsigned int GLCD_GlyphMisses = 0;
+
+/* First GRAM line shown at the top of the screen                             */
+static unsigned int scroll_y;
+
+/* ILI932x GRAM address counter and window registers, in screen axes: the
+   counter moves along x first                                                */
+#if (LANDSCAPE == 1)
+#define ILI_AC_X    0x21
+#define ILI_AC_Y    0x20
+#define ILI_WIN_X   0x52                /* start; the end is the next one     */
+#define ILI_WIN_Y   0x50
+#else
+#define ILI_AC_X    0x20
+#define ILI_AC_Y    0x21
+#define ILI_WIN_X   0x50
+#define ILI_WIN_Y   0x52
+#endif
 
 /************************ Local auxiliary functions ***************************/
 
@@ -103,6 +185,7 @@ static void delay (int cnt) {
 }
 
 
+#if (GLCD_CONTROLLER == CTRL_DETECT)
 /*******************************************************************************
 * Transfer 1 byte over the serial communication                                *
 *   Parameter:    byte:   byte to be sent                                      *
@@ -130,6 +213,7 @@ static unsigned char spi_tran_man (unsigned char byte, unsigned int mode) {
   }
   return (val);
 }
+#endif
 
 
 /*******************************************************************************
@@ -140,9 +224,14 @@ static unsigned char spi_tran_man (unsigned char byte, unsigned int mode) {
 
 static __inline unsigned char spi_tran (unsigned char byte) {
 
+  GLCD_SpiBytes++;
+#ifdef GLCD_MODEL
+  return (lcd_model_tran(byte));
+#else
   LPC_SSP1->DR = byte;
   while (!(LPC_SSP1->SR & RNE));        /* Wait for send to finish            */
   return (LPC_SSP1->DR);
+#endif
 }
 
 
@@ -183,6 +272,8 @@ static __inline void wr_dat (unsigned short dat) {
 *******************************************************************************/
 
 static __inline void wr_dat_start (void) {
+  SHADOW_FORGET(ILI_AC_X);              /* The stream moves the address       */
+  SHADOW_FORGET(ILI_AC_Y);
   LCD_CS(0);
   spi_tran(SPI_START | SPI_WR | SPI_DATA);    /* Write : RS = 1, RW = 0       */
 }
@@ -246,19 +337,51 @@ static __inline void wr_reg (unsigned char reg, unsigned short val) {
 }
 
 
+/*******************************************************************************
+* Write a value to a shadowed LCD register, unless it already holds it        *
+*   Parameter:    reg:    register to be written (below SHADOW_REGS)           *
+*                 val:    value to write to the register                       *
+*******************************************************************************/
+
+static __inline void wr_reg_shadow (unsigned char reg, unsigned short val) {
+
+  if (SHADOWED(reg) && shadow[reg] == val) {
+    GLCD_ElidedWrites++;
+    return;
+  }
+  wr_reg(reg, val);
+  SHADOW_SET(reg, val);
+}
+
+
+/*******************************************************************************
+* Forget every shadowed register, e.g. after the init sequence wrote them     *
+*******************************************************************************/
+
+static void shadow_reset (void) {
+  unsigned int i;
+
+  for (i = 0; i < SHADOW_REGS / 32; i++)
+    shadow_valid[i] = 0;
+}
+
+
 /*******************************************************************************
 * Read from the LCD register                                                   *
 *   Parameter:    reg:    register to be read                                  *
 *   Return:               value read from the register                         *
 *******************************************************************************/
 
+#if (GLCD_CONTROLLER != CTRL_HIMAX)
 static unsigned short rd_reg (unsigned char reg) {
 
   wr_cmd(reg);
   return(rd_dat());
 }
+#endif
 
 
+#if (GLCD_CONTROLLER == CTRL_DETECT)
 /*******************************************************************************
 * Read LCD controller ID (Himax GLCD)                                          *
 *   Parameter:    (none)                                                       *
@@ -292,6 +415,123 @@ static unsigned short rd_id_man (void) {
 
   return (val);
 }
+#endif
+
+
+/************************ Controller addressing *******************************/
+
+/* Each controller addresses GRAM its own way; the fastest sequence of each
+   sits behind a small table picked once at init:
+     window: set the draw window, the next memory write starts at its corner
+     pixel:  address a single pixel for the next memory write
+     scroll: set the vertical scroll line                                     */
+
+typedef struct {
+  void (*window) (unsigned int x, unsigned int y, unsigned int w, unsigned int h);
+  void (*pixel)  (unsigned int x, unsigned int y);
+  void (*scroll) (unsigned int y);
+} LCD_Controller;
+
+
+#if (GLCD_CONTROLLER != CTRL_ILI)
+/*------------------------------ Himax HX8347-D ------------------------------*/
+
+/* The registers are 8 bit, so each address is a high and a low byte. A memory
+   write starts at the window start, so a pixel only needs the start written
+   once the window end is left at the screen corner; with the shadow, that is
+   usually one low byte per pixel.                                            */
+
+static void himax_start (unsigned int x, unsigned int y) {
+  wr_reg_shadow(0x02, x >> 8);          /* Column address start MSB           */
+  wr_reg_shadow(0x03, x & 0xFF);        /* Column address start LSB           */
+  wr_reg_shadow(0x06, y >> 8);          /* Row address start MSB              */
+  wr_reg_shadow(0x07, y & 0xFF);        /* Row address start LSB              */
+}
+
+static void himax_end (unsigned int xe, unsigned int ye) {
+  wr_reg_shadow(0x04, xe >> 8);         /* Column address end MSB             */
+  wr_reg_shadow(0x05, xe & 0xFF);       /* Column address end LSB             */
+  wr_reg_shadow(0x08, ye >> 8);         /* Row address end MSB                */
+  wr_reg_shadow(0x09, ye & 0xFF);       /* Row address end LSB                */
+}
+
+static void himax_window (unsigned int x, unsigned int y, unsigned int w, unsigned int h) {
+  himax_start(x, y);
+  himax_end(x+w-1, y+h-1);
+}
+
+static void himax_pixel (unsigned int x, unsigned int y) {
+  himax_end(WIDTH-1, HEIGHT-1);
+  himax_start(x, y);
+}
+
+static void himax_scroll (unsigned int y) {
+  wr_reg_shadow(0x01, 0x08);
+  wr_reg_shadow(0x14, y>>8);            /* VSP MSB                            */
+  wr_reg_shadow(0x15, y&0xFF);          /* VSP LSB                            */
+}
+
+static const LCD_Controller ctrl_himax = { himax_window, himax_pixel, himax_scroll };
+#endif
+
+
+#if (GLCD_CONTROLLER != CTRL_HIMAX)
+
+/*------------------------ ILI932x, SPFD5408, RM68050 ------------------------*/
+
+/* 16-bit registers: a pixel is the two GRAM address counter registers. Every
+   pixel written moves the counter on along x within the window, so after a
+   pixel the shadow holds where the counter went: the next pixel along the
+   line then needs no address at all.                                         */
+
+static void ili_window (unsigned int x, unsigned int y, unsigned int w, unsigned int h) {
+  wr_reg_shadow(ILI_WIN_Y,   y);        /* GRAM window along y                */
+  wr_reg_shadow(ILI_WIN_Y+1, y+h-1);
+  wr_reg_shadow(ILI_WIN_X,   x);        /* GRAM window along x                */
+  wr_reg_shadow(ILI_WIN_X+1, x+w-1);
+  wr_reg_shadow(ILI_AC_Y,    y);
+  wr_reg_shadow(ILI_AC_X,    x);
+}
+
+static void ili_pixel (unsigned int x, unsigned int y) {
+  wr_reg_shadow(ILI_AC_Y, y);
+  wr_reg_shadow(ILI_AC_X, x);
+
+  /* Where the counter goes after the one pixel, if the window is known and
+     the pixel is in it                                                       */
+  if (SHADOWED(ILI_WIN_X) && SHADOWED(ILI_WIN_X+1) && SHADOWED(ILI_WIN_Y) && SHADOWED(ILI_WIN_Y+1) &&
+      x >= shadow[ILI_WIN_X] && x <= shadow[ILI_WIN_X+1] && y >= shadow[ILI_WIN_Y] && y <= shadow[ILI_WIN_Y+1]) {
+    if (x < shadow[ILI_WIN_X+1]) {
+      SHADOW_SET(ILI_AC_X, x+1);
+    }
+    else {
+      SHADOW_SET(ILI_AC_X, shadow[ILI_WIN_X]);
+      SHADOW_SET(ILI_AC_Y, (y < shadow[ILI_WIN_Y+1]) ? y+1 : shadow[ILI_WIN_Y]);
+    }
+  }
+  else {
+    SHADOW_FORGET(ILI_AC_X);
+    SHADOW_FORGET(ILI_AC_Y);
+  }
+}
+
+static void ili_scroll (unsigned int y) {
+  wr_reg_shadow(0x6A, y);
+  wr_reg_shadow(0x61, 3);
+}
+
+static const LCD_Controller ctrl_ili = { ili_window, ili_pixel, ili_scroll };
+#endif
+
+
+#if   (GLCD_CONTROLLER == CTRL_HIMAX)
+#define CTRL        (&ctrl_himax)
+#elif (GLCD_CONTROLLER == CTRL_ILI)
+#define CTRL        (&ctrl_ili)
+#else
+static const LCD_Controller *ctrl = &ctrl_ili;
+#define CTRL        ctrl
+#endif
 
 
 /************************ Exported functions **********************************/
@@ -326,13 +566,22 @@ void GLCD_Init (void) {
   LPC_SSP1->CPSR       = 0x02;
   LPC_SSP1->CR1        = 0x02;
   
+#if   (GLCD_CONTROLLER == CTRL_HIMAX)
+  driverCode = 0x47;
+#else
+ #if (GLCD_CONTROLLER == CTRL_DETECT)
   driverCode = rd_id_man ();
-  if (driverCode == 0) {
+  if (driverCode == 0)
+ #endif
+  {
     driverCode = rd_reg(0x00);
   }
+#endif
 
   if (driverCode == 0x47) {             /* LCD with HX8347-D LCD Controller   */
-    Himax = 1;                          /* Set Himax LCD controller flag      */
+   #if (GLCD_CONTROLLER == CTRL_DETECT)
+    ctrl = &ctrl_himax;                 /* Select the Himax addressing        */
+   #endif
     /* Driving ability settings ----------------------------------------------*/
     wr_reg(0xEA, 0x00);                 /* Power control internal used (1)    */
     wr_reg(0xEB, 0x20);                 /* Power control internal used (2)    */
@@ -430,7 +679,9 @@ void GLCD_Init (void) {
     wr_reg(0x13, 0x00);                 /* BFA LSB                            */
   }
   else {
-    Himax = 0;                          /* This is not Himax LCD controller   */
+   #if (GLCD_CONTROLLER == CTRL_DETECT)
+    ctrl = &ctrl_ili;                   /* This is not Himax LCD controller   */
+   #endif
     /* Start Initial Sequence ------------------------------------------------*/
    #if (ROTATE180 == 1)
     wr_reg(0x01, 0x0000);               /* Clear SS bit                       */
@@ -569,6 +820,8 @@ void GLCD_Init (void) {
 
     wr_reg(0x07, 0x0137);               /* 262K color and display ON          */
   }
+  shadow_reset();                       /* Nothing is known about the regs    */
+  scroll_y = 0;
   LPC_GPIO4->FIOSET = 0x10000000;
 }
 
@@ -583,39 +836,8 @@ void GLCD_Init (void) {
 *******************************************************************************/
 
 void GLCD_SetWindow (unsigned int x, unsigned int y, unsigned int w, unsigned int h) {
-  unsigned int xe, ye;
 
-  if (Himax) {
-    xe = x+w-1;
-    ye = y+h-1;
-
-    wr_reg(0x02, x  >>    8);           /* Column address start MSB           */
-    wr_reg(0x03, x  &  0xFF);           /* Column address start LSB           */
-    wr_reg(0x04, xe >>    8);           /* Column address end MSB             */
-    wr_reg(0x05, xe &  0xFF);           /* Column address end LSB             */
-  
-    wr_reg(0x06, y  >>    8);           /* Row address start MSB              */
-    wr_reg(0x07, y  &  0xFF);           /* Row address start LSB              */
-    wr_reg(0x08, ye >>    8);           /* Row address end MSB                */
-    wr_reg(0x09, ye &  0xFF);           /* Row address end LSB                */
-  }
-  else {
-   #if (LANDSCAPE == 1)
-    wr_reg(0x50, y);                    /* Vertical   GRAM Start Address      */
-    wr_reg(0x51, y+h-1);                /* Vertical   GRAM End   Address (-1) */
-    wr_reg(0x52, x);                    /* Horizontal GRAM Start Address      */
-    wr_reg(0x53, x+w-1);                /* Horizontal GRAM End   Address (-1) */
-    wr_reg(0x20, y);
-    wr_reg(0x21, x);
-   #else
-    wr_reg(0x50, x);                    /* Horizontal GRAM Start Address      */
-    wr_reg(0x51, x+w-1);                /* Horizontal GRAM End   Address (-1) */
-    wr_reg(0x52, y);                    /* Vertical   GRAM Start Address      */
-    wr_reg(0x53, y+h-1);                /* Vertical   GRAM End   Address (-1) */
-    wr_reg(0x20, x);
-    wr_reg(0x21, y);
-   #endif
-  }
+  CTRL->window(x, y, w, h);
 }
 
 
@@ -639,27 +861,7 @@ void GLCD_WindowMax (void) {
 
 void GLCD_PutPixel (unsigned int x, unsigned int y) {
 
-  if (Himax) {
-    wr_reg(0x02, x >>    8);            /* Column address start MSB           */
-    wr_reg(0x03, x &  0xFF);            /* Column address start LSB           */
-    wr_reg(0x04, x >>    8);            /* Column address end MSB             */
-    wr_reg(0x05, x &  0xFF);            /* Column address end LSB             */
-  
-    wr_reg(0x06, y >>    8);            /* Row address start MSB              */
-    wr_reg(0x07, y &  0xFF);            /* Row address start LSB              */
-    wr_reg(0x08, y >>    8);            /* Row address end MSB                */
-    wr_reg(0x09, y &  0xFF);            /* Row address end LSB                */
-  }
-  else {
-   #if (LANDSCAPE == 1)
-    wr_reg(0x20, y);
-    wr_reg(0x21, x);
-   #else
-    wr_reg(0x20, x);
-    wr_reg(0x21, y);
-   #endif
-  }
-
+  CTRL->pixel(x, y);
   wr_cmd(0x22);
   wr_dat(Color[TXT_COLOR]);
 }
@@ -752,6 +954,120 @@ void GLCD_DrawChar (unsigned int x, unsigned int y, unsigned int cw, unsigned in
 }
 
 
+/*******************************************************************************
+* Find a glyph expanded in the current colours, expanding it on a miss        *
+*   Parameter:      fi:       font index (0 = 6x8, 1 = 16x24)                  *
+*                   c:        character, from ' '                              *
+*                   since:    glyphs used at or after this are not evicted     *
+*   Return:                   pixels of the glyph, NULL if none can be evicted *
+*******************************************************************************/
+
+static const unsigned short *glyph_get (unsigned char fi, unsigned char c, unsigned int since) {
+  unsigned short fg = Color[TXT_COLOR], bg = Color[BG_COLOR];
+  unsigned int cw = fi ? 16 : 6, ch = fi ? 24 : 8;
+  unsigned int i, j, pixs;
+  Glyph *first = fi ? glyphs + GLCD_GLYPHS_6x8 : glyphs;
+  Glyph *last  = fi ? first + GLCD_GLYPHS_16x24 : first + GLCD_GLYPHS_6x8;
+  Glyph *g, *victim = 0;
+  unsigned short *pix;
+
+  for (g = first; g < last; g++) {
+    if (g->c == c && g->fg == fg && g->bg == bg && g->used) {
+      g->used = ++glyph_clock;
+      return (fi ? glyph_pix_16x24[g - first] : glyph_pix_6x8[g - first]);
+    }
+    if (g->used < since && (!victim || g->used < victim->used)) {
+      victim = g;
+    }
+  }
+  if (!victim) {
+    return (0);
+  }
+
+  pix = fi ? glyph_pix_16x24[victim - first] : glyph_pix_6x8[victim - first];
+  for (j = 0; j < ch; j++) {
+    pixs = fi ? Font_16x24_h[c * 24 + j] : Font_6x8_h[c * 8 + j];
+    for (i = 0; i < cw; i++) {
+      pix[j * cw + i] = (pixs >> i) & 1 ? fg : bg;
+    }
+  }
+  victim->c    = c;
+  victim->fg   = fg;
+  victim->bg   = bg;
+  victim->used = ++glyph_clock;
+  GLCD_GlyphMisses++;
+  return (pix);
+}
+
+
+/*******************************************************************************
+* Draw characters next to each other on a line through one window: every row *
+* of the line is streamed across all of them, from the glyph cache           *
+*   Parameter:      y:        vertical position of the first row drawn         *
+*                   col:      column number                                    *
+*                   fi:       font index (0 = 6x8, 1 = 16x24)                  *
+*                   s:        characters                                       *
+*                   n:        number of characters                             *
+*                   row:      first glyph row drawn                            *
+*                   rows:     number of glyph rows drawn                       *
+*   Return:                                                                    *
+*******************************************************************************/
+
+static void draw_glyphs (unsigned int y, unsigned int col, unsigned char fi, unsigned char *s, unsigned int n,
+                         unsigned int row, unsigned int rows) {
+  /* Static, not 216 bytes of a 512 byte thread stack: like the glyph cache
+     and the colours it is driver state, used by the one thread that draws   */
+  static const unsigned short *pix[(WIDTH+5)/6];
+  unsigned int cw = fi ? 16 : 6, ch = fi ? 24 : 8;
+  unsigned int x = col * cw, w, i, j, k, cols, pixs;
+  unsigned int since = glyph_clock + 1;
+  unsigned char c;
+
+  if (fi > 1 || x >= WIDTH || row >= ch || y >= HEIGHT) {
+    return;
+  }
+  if (rows > ch - row) {
+    rows = ch - row;
+  }
+  if (rows > HEIGHT - y) {
+    rows = HEIGHT - y;
+  }
+  if (n > (WIDTH - x + cw - 1) / cw) {  /* Characters that show, the last one */
+    n = (WIDTH - x + cw - 1) / cw;      /* maybe only in part                 */
+  }
+  w = (x + n * cw > WIDTH) ? WIDTH - x : n * cw;
+
+  /* Glyphs of this line are never evicted for another one of it: one that
+     finds no free slot is expanded row by row while it is streamed          */
+  for (k = 0; k < n; k++) {
+    pix[k] = glyph_get(fi, s[k] - 32, since);
+  }
+
+  GLCD_SetWindow(x, y, w, rows);
+  wr_cmd(0x22);
+  wr_dat_start();
+  for (j = row; j < row + rows; j++) {
+    for (k = 0; k < n; k++) {
+      cols = (w - k * cw < cw) ? w - k * cw : cw;
+      if (pix[k]) {
+        const unsigned short *line = pix[k] + j * cw;
+        for (i = 0; i < cols; i++) {
+          wr_dat_only(line[i]);
+        }
+      }
+      else {
+        c    = s[k] - 32;
+        pixs = fi ? Font_16x24_h[c * 24 + j] : Font_6x8_h[c * 8 + j];
+        for (i = 0; i < cols; i++) {
+          wr_dat_only(Color[(pixs >> i) & 1]);
+        }
+      }
+    }
+  }
+  wr_dat_stop();
+}
+
+
 /*******************************************************************************
 * Disply character on given line                                               *
 *   Parameter:      ln:       line number                                      *
@@ -763,15 +1079,7 @@ void GLCD_DrawChar (unsigned int x, unsigned int y, unsigned int cw, unsigned in
 
 void GLCD_DisplayChar (unsigned int ln, unsigned int col, unsigned char fi, unsigned char c) {
 
-  c -= 32;
-  switch (fi) {
-    case 0:  /* Font 6 x 8 */
-      GLCD_DrawChar(col *  6, ln *  8,  6,  8, (unsigned char *)&Font_6x8_h  [c * 8]);
-      break;
-    case 1:  /* Font 16 x 24 */
-      GLCD_DrawChar(col * 16, ln * 24, 16, 24, (unsigned char *)&Font_16x24_h[c * 24]);
-      break;
-  }
+  draw_glyphs(ln * (fi ? 24 : 8), col, fi, &c, 1, 0, 24);
 }
 
 
@@ -785,10 +1093,34 @@ void GLCD_DisplayChar (unsigned int ln, unsigned int col, unsigned char fi, unsi
 *******************************************************************************/
 
 void GLCD_DisplayString (unsigned int ln, unsigned int col, unsigned char fi, unsigned char *s) {
+  unsigned int n = 0;
+
+  while (s[n]) {
+    n++;
+  }
+  draw_glyphs(ln * (fi ? 24 : 8), col, fi, s, n, 0, 24);
+}
+
+
+/*******************************************************************************
+* Disply some of the pixel rows of a string, from any vertical position       *
+*   Parameter:      y:        vertical position of the first row drawn         *
+*                   col:      column number                                    *
+*                   fi:       font index (0 = 6x8, 1 = 16x24)                  *
+*                   s:        pointer to string                                *
+*                   row:      first pixel row of the string drawn              *
+*                   rows:     number of pixel rows drawn                       *
+*   Return:                                                                    *
+*******************************************************************************/
+
+void GLCD_DisplayStringRows (unsigned int y, unsigned int col, unsigned char fi, unsigned char *s,
+                             unsigned int row, unsigned int rows) {
+  unsigned int n = 0;
 
-  while (*s) {
-    GLCD_DisplayChar(ln, col++, fi, *s++);
+  while (s[n]) {
+    n++;
   }
+  draw_glyphs(y, col, fi, s, n, row, rows);
 }
 
 
@@ -808,13 +1140,15 @@ void GLCD_ClearLn (unsigned int ln, unsigned char fi) {
     case 0:  /* Font 6 x 8 */
       for (i = 0; i < (WIDTH+5)/6; i++)
         buf[i] = ' ';
-      buf[i+1] = 0;
+      buf[i] = 0;
       break;
     case 1:  /* Font 16 x 24 */
       for (i = 0; i < (WIDTH+15)/16; i++)
         buf[i] = ' ';
-      buf[i+1] = 0;
+      buf[i] = 0;
       break;
+    default:
+      return;
   }
   GLCD_DisplayString (ln, 0, fi, buf);
 }
@@ -849,6 +1183,28 @@ void GLCD_Bargraph (unsigned int x, unsigned int y, unsigned int w, unsigned int
 }
 
 
+/*******************************************************************************
+* Fill a rectangle with the foreground color, through one window              *
+*   Parameter:      x:        horizontal position                              *
+*                   y:        vertical position                                *
+*                   w:        width of the rectangle                           *
+*                   h:        height of the rectangle                          *
+*   Return:                                                                    *
+*******************************************************************************/
+
+void GLCD_FillRect (unsigned int x, unsigned int y, unsigned int w, unsigned int h) {
+  unsigned int i;
+
+  GLCD_SetWindow(x, y, w, h);
+  wr_cmd(0x22);
+  wr_dat_start();
+  for (i = 0; i < w * h; i++) {
+    wr_dat_only(Color[TXT_COLOR]);
+  }
+  wr_dat_stop();
+}
+
+
 /*******************************************************************************
 * Display graphical bitmap image at position x horizontally and y vertically   *
 * (This function is optimized for 16 bits per pixel format, it has to be       *
@@ -878,6 +1234,110 @@ void GLCD_Bitmap (unsigned int x, unsigned int y, unsigned int w, unsigned int h
 }
 
 
+/*******************************************************************************
+* Display indexed color image at position x horizontally and y vertically,     *
+* expanding each pixel through the palette while it is streamed                *
+* (2 or 4 bits per pixel, high bits first, rows top down)                      *
+*   Parameter:      x:        horizontal position                              *
+*                   y:        vertical position                                *
+*                   w:        width of the area drawn                          *
+*                   h:        height of the area drawn                         *
+*                   bpp:      bits per pixel, 2 or 4                           *
+*                   pix:      first row of the area in the image               *
+*                   stride:   bytes from one image row to the next             *
+*                   first:    pixel of the row the area starts at              *
+*                   palette:  RGB565 color of each index (4 or 16 entries)     *
+*   Return:                                                                    *
+*******************************************************************************/
+
+void GLCD_BitmapIndexed (unsigned int x, unsigned int y, unsigned int w, unsigned int h, unsigned int bpp,
+                         const unsigned char *pix, unsigned int stride, unsigned int first,
+                         const unsigned short *palette) {
+  unsigned int i, j, mask = (1 << bpp) - 1;
+
+  GLCD_SetWindow(x, y, w, h);
+  wr_cmd(0x22);
+  wr_dat_start();
+  for (j = 0; j < h; j++, pix += stride) {
+    const unsigned char *p = pix + first * bpp / 8;
+    int shift = 8 - bpp - (first * bpp) % 8;
+
+    for (i = 0; i < w; i++) {
+      wr_dat_only(palette[(*p >> shift) & mask]);
+      shift -= bpp;
+      if (shift < 0) {                  /* Next byte of the row               */
+        shift = 8 - bpp;
+        p++;
+      }
+    }
+  }
+  wr_dat_stop();
+}
+
+
+
+/*******************************************************************************
+* Display run-length coded image at position x horizontally and y vertically,  *
+* decoded while it is streamed, so it never needs a buffer                     *
+* (codes 0LNNNNNN: a run of one pixel, 1LNNNNNN: that many literal pixels;     *
+*  with L set the count is NNNNNN and the next byte, count + 1 pixels.         *
+*  A pixel is a palette index byte, or a big-endian RGB565 word)               *
+*   Parameter:      x:        horizontal position                              *
+*                   y:        vertical position                                *
+*                   w:        width of image                                   *
+*                   h:        height of image                                  *
+*                   data:     address at which the codes reside                *
+*                   size:     bytes of codes                                   *
+*                   palette:  RGB565 color of each index, 0 for RGB565 pixels  *
+*   Return:                                                                    *
+*******************************************************************************/
+
+void GLCD_BitmapRLE (unsigned int x, unsigned int y, unsigned int w, unsigned int h,
+                     const unsigned char *data, unsigned int size, const unsigned short *palette) {
+  const unsigned char *end = data + size;
+  unsigned int left = w * h, n, code;
+  unsigned short color = 0;
+
+  GLCD_SetWindow(x, y, w, h);
+  wr_cmd(0x22);
+  wr_dat_start();
+  while (left && data < end) {
+    code = *data++;
+    n = code & 0x3F;
+    if (code & 0x40) {                  /* Long count                         */
+      n = (n << 8) | *data++;
+    }
+    n++;
+    if (n > left) {
+      n = left;
+    }
+    left -= n;
+
+    if (code & 0x80) {                  /* Literal pixels                     */
+      while (n--) {
+        if (palette) {
+          color = palette[*data++];
+        } else {
+          color = (data[0] << 8) | data[1];
+          data += 2;
+        }
+        wr_dat_only(color);
+      }
+    } else {                            /* Run of one pixel                   */
+      if (palette) {
+        color = palette[*data++];
+      } else {
+        color = (data[0] << 8) | data[1];
+        data += 2;
+      }
+      while (n--) {
+        wr_dat_only(color);
+      }
+    }
+  }
+  wr_dat_stop();
+}
+
 
 /*******************************************************************************
 * Scroll content of the whole display for dy pixels vertically                 *
@@ -887,21 +1347,27 @@ void GLCD_Bitmap (unsigned int x, unsigned int y, unsigned int w, unsigned int h
 
 void GLCD_ScrollVertical (unsigned int dy) {
 #if (LANDSCAPE == 0)
-  static unsigned int y = 0;
+  scroll_y = scroll_y + dy;
+  while (scroll_y >= HEIGHT)
+    scroll_y -= HEIGHT;
 
-  y = y + dy;
-  while (y >= HEIGHT)
-    y -= HEIGHT;
+  CTRL->scroll(scroll_y);
+#endif
+}
 
-  if (Himax) {
-    wr_reg(0x01, 0x08);
-    wr_reg(0x14, y>>8);                 /* VSP MSB                            */
-    wr_reg(0x15, y&0xFF);               /* VSP LSB                            */
-  }
-  else {
-    wr_reg(0x6A, y);
-    wr_reg(0x61, 3);
-  }
+
+/*******************************************************************************
+* Lines GLCD_ScrollVertical turns the screen content around in                 *
+*   Parameter:                                                                 *
+*   Return:                   HEIGHT, 0 if it can not scroll vertically: the   *
+*                             controllers scroll along the 320 pixel side      *
+*******************************************************************************/
+
+unsigned int GLCD_ScrollHeight (void) {
+#if (LANDSCAPE == 0)
+  return (HEIGHT);
+#else
+  return (0);
 #endif
 }
 
@@ -924,5 +1390,8 @@ void GLCD_WrCmd (unsigned char cmd) {
 *******************************************************************************/
 void GLCD_WrReg (unsigned char reg, unsigned short val) {
   wr_reg (reg, val);
+  if (reg < SHADOW_REGS) {
+    SHADOW_FORGET(reg);
+  }
 }
 /******************************************************************************/
@@ -1,7 +1,12 @@
 /*----------------------------------------------------------------------------
 * Name:    GLCD_Scroll.c
 * Purpose: Showing the a text block on Keil board display.
-* Note(s):
+* Note(s): The lines on the screen live in a ring in the LCD's memory, turned
+*          with the controller's vertical scroll: moving the text by a line
+*          scrolls it and draws just the one line that comes in. Every line
+*          is drawn across the whole width, so nothing is ever cleared first.
+*          The controllers only scroll along the 320 pixel side, so on a
+*          landscape screen the lines that move are redrawn in place instead.
 *----------------------------------------------------------------------------
 * This file is part of the UW-MTE241 course project.
 *
@@ -9,12 +14,13 @@
 *
 * Copyright (c) 2014. All rights reserved.
 *----------------------------------------------------------------------------*/
-#include <LPC17xx.h>
+#include <lpc17xx.h>
 #include <stdlib.h>
-#include "glcd.h"
-#include "glcd_scroll.h"
+#include "GLCD.h"
+#include "GLCD_Scroll.h"
 
 #define SCREEN_SIZE  			(LCD_WIDTH * LCD_HEIGTH)
+#define LINE_PIXELS			(FONT_SIZE ? 24 : 8)
 
 uint8_t chache[CACHE_LINE_CAP][LCD_WIDTH + 1];		//The chach size is CACHE_LINE_CAP lines of LCD_WIDTH + 1 length (Each line is an string, and string ends up to '0').
 
@@ -26,6 +32,9 @@ short int last_col_cahche = 0;
 
 uint32_t window_start = 0, window_size = 0;
 
+//Pixel lines the screen scrolls around in, 0 when it can't scroll. The top text line is drawn at ring_top.
+uint32_t ring_height = 0, ring_top = 0;
+
 
 void init_scroll( void ) {
 	GLCD_Init(); 
@@ -39,6 +48,12 @@ void init_scroll( void ) {
 	last_col_cahche = 0;
 	window_start = 0;
 	window_size = 0;
+
+	ring_height = GLCD_ScrollHeight();
+	if ( ring_height < LCD_HEIGTH * LINE_PIXELS ) {
+		ring_height = 0;
+	}
+	ring_top = 0;
 	
 }
 
@@ -50,17 +65,96 @@ uint32_t last_window_line( void ) {
 	return (window_start + window_size) % CACHE_LINE_CAP;
 }
 
+/*
+	Draws rows [row, row + rows) of a string, starting at the given column of a screen line, where the ring
+	has it: a line that runs over the end of the ring goes on at its start.
+*/
+void draw_rows( uint32_t line, uint32_t col, uint8_t *str, uint32_t row, uint32_t rows ) {
+	uint32_t y = line * LINE_PIXELS + row, first = rows;
+
+	if ( ring_height ) {
+		y = (ring_top + y) % ring_height;
+		if ( y + rows > ring_height ) {
+			first = ring_height - y;
+		}
+	}
+	GLCD_DisplayStringRows(y, col, FONT_SIZE, str, row, first);
+	if ( first < rows ) {
+		GLCD_DisplayStringRows(0, col, FONT_SIZE, str, row + first, rows - first);
+	}
+}
+
+/*
+	Draws a line of the window across the whole screen: its text, then spaces over whatever was there.
+*/
+void draw_line( uint32_t line ) {
+	uint8_t padded[LCD_WIDTH + 1];
+	uint8_t *str = chache[(line + window_start) % CACHE_LINE_CAP];
+	size_t i = 0;
+
+	if ( line <= window_size ) {
+		for ( ; i < LCD_WIDTH && str[i] != 0x0; ++i ) {
+			padded[i] = str[i];
+		}
+	}
+	for ( ; i < LCD_WIDTH; ++i ) {
+		padded[i] = ' ';
+	}
+	padded[LCD_WIDTH] = 0x0;
+
+	draw_rows(line, 0, padded, 0, LINE_PIXELS);
+}
+
+/*
+	The pixel lines of the ring under the last text line, if the lines don't fill it, are kept blank.
+*/
+void draw_gap( void ) {
+	uint8_t spaces[LCD_WIDTH + 1];
+	uint32_t gap = ring_height - LCD_HEIGTH * LINE_PIXELS;
+	size_t i;
+
+	for ( i = 0; i < LCD_WIDTH; ++i ) {
+		spaces[i] = ' ';
+	}
+	spaces[LCD_WIDTH] = 0x0;
+
+	for ( i = 0; i < gap; i += LINE_PIXELS ) {
+		draw_rows(LCD_HEIGTH, 0, spaces, i, (gap - i < LINE_PIXELS) ? gap - i : LINE_PIXELS);
+	}
+}
+
 /*
 	Referesh the screen based on the stored characer in the linked list.
 */
 
 void refresh_lcd( void ) {
 	size_t	i = 0;
-	GLCD_Clear(BGC);
-	
-	for (i = 0; i <= window_size; ++i ) {
-		GLCD_DisplayString  (i, 0, 1, chache[(i + window_start) % CACHE_LINE_CAP ]);
+
+	for (i = 0; i < LCD_HEIGTH; ++i ) {
+		draw_line(i);
+	}
+}
+
+/*
+	Shows the window after window_start moved one line: down (the text goes up) or up. The screen scrolls
+	a line and only the line that comes in is drawn, with the blank gap under the last line behind it.
+*/
+void scroll_lcd( int down ) {
+	if ( !ring_height ) {
+		refresh_lcd();
+		return;
 	}
+
+	if ( down ) {
+		ring_top = (ring_top + LINE_PIXELS) % ring_height;
+		GLCD_ScrollVertical(LINE_PIXELS);
+		draw_line(LCD_HEIGTH - 1);
+	} else {
+		ring_top = (ring_top + ring_height - LINE_PIXELS) % ring_height;
+		GLCD_ScrollVertical(ring_height - LINE_PIXELS);
+		draw_line(0);
+	}
+	draw_gap();
 }
 
 /*
@@ -80,12 +174,13 @@ void append_char( uint8_t _char ) {
 			--cache_size;
 		}
 			
+		chache[last_line()][0] = 0x0;
 		if ( window_size >= LCD_HEIGTH - 1 ) {
 			window_start = ( window_start + 1 ) % CACHE_LINE_CAP;
-			--window_size;
-			refresh_lcd();
+			scroll_lcd(1);
+		} else {
+			++window_size;
 		}
-		++window_size;
 		
 		
 	}
@@ -93,8 +188,10 @@ void append_char( uint8_t _char ) {
 	if ( _char == '\n' ) {			
 			last_col_cahche = LCD_WIDTH + 1;
 	}else{
+		uint8_t str[2] = { _char, 0x0 };
+
 		last_line_to_append = window_size;
-		GLCD_DisplayChar ( last_line_to_append , last_col_cahche, FONT_SIZE, _char);
+		draw_rows(last_line_to_append, last_col_cahche, str, 0, LINE_PIXELS);
 
 		chache[last_line()][last_col_cahche] = _char;
 		++last_col_cahche;
@@ -126,13 +223,13 @@ void print_string( uint8_t *str_ptr ) {
 void moveUp( void ) {
 	
 	if ( window_start != cache_start ) {
-		window_start = (window_start - 1) % CACHE_LINE_CAP;		
+		window_start = (window_start + CACHE_LINE_CAP - 1) % CACHE_LINE_CAP;		
 
 		if ( window_size < LCD_HEIGTH - 1 ) {
 			++window_size;
 		}
 
-		refresh_lcd();
+		scroll_lcd(0);
 	}
 	
 }
@@ -146,7 +243,7 @@ void moveDown( void ) {
 			--window_size;
 		}
 
-		refresh_lcd();
+		scroll_lcd(1);
 	}
 	
 }
@@ -3,8 +3,12 @@
 
 #define BGC 		Black
 #define TXC 		White
-#define LCD_WIDTH	20
-#define LCD_HEIGTH	10
+#ifndef LCD_WIDTH
+#define LCD_WIDTH	20	//Text columns on the screen: 15 on a portrait one
+#endif
+#ifndef LCD_HEIGTH
+#define LCD_HEIGTH	10	//Text lines on the screen: 13 on a portrait one
+#endif
 #define null_ptr 	((void *) 0)
 #define FONT_SIZE 	1
 
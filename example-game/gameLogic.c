@@ -56,12 +56,17 @@ void enemyShoot(actor* enemy)
 //definitely screw this up with both being task 1 or something
 void animate(void *args)
 {
+	//this thread's own random stream, so enemy shots don't go through the non-reentrant rand()
+	RngStream enemyRng;
+	rng_seed(&enemyRng, osKernelGetSysTimerCount(), RNG_STREAM_ENEMY);
+	
 	while(1)
 	{
 		printEnemy(enemy);
 		
 		//see if there is shooting to do
-		if(rand() > ENEMY_SHOT_CHANCE && lasers[ENEMY_LASER]->dir == 0)
+		//same odds as rand() > ENEMY_SHOT_CHANCE, with RAND_MAX + 1 a power of two
+		if((rng_next(&enemyRng) & RAND_MAX) > ENEMY_SHOT_CHANCE && lasers[ENEMY_LASER]->dir == 0)
 			enemyShoot(enemy);
 		
 		if(player->dir != 0) //we don't want to print more than we need. The print logic is a bit more complex than for enemies
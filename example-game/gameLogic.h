@@ -6,6 +6,7 @@
 #include <stdio.h>
 #include "GLCD.h"
 #include "spece.h"
+#include "rng.h"
 #include <cmsis_os2.h>
 #include <os_tick.h>
 
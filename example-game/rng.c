@@ -0,0 +1,84 @@
+/*----------------------------------------------------------------------------
+* Name:    rng.c
+* Purpose: xoshiro128** streams and unbiased bounded integers
+* Note(s): See rng.h
+*----------------------------------------------------------------------------*/
+#include "rng.h"
+
+static __inline uint32_t rotl (uint32_t x, int k) {
+	return (x << k) | (x >> (32 - k));
+}
+
+/* splitmix32 step, used to spread a seed over the whole state                */
+static uint32_t splitmix (uint32_t *x) {
+	uint32_t z = (*x += 0x9E3779B9UL);
+
+	z = (z ^ (z >> 16)) * 0x85EBCA6BUL;
+	z = (z ^ (z >> 13)) * 0xC2B2AE35UL;
+	return z ^ (z >> 16);
+}
+
+/*******************************************************************************
+* Seed a stream                                                                *
+*   Parameter:    seed:   common seed (ADC noise, or the one in a trace)       *
+*                 stream: stream id, mixed in so streams never overlap in      *
+*                         practice even with the same seed                     *
+*******************************************************************************/
+void rng_seed (RngStream *r, uint32_t seed, uint32_t stream) {
+	uint32_t x = seed ^ (stream * 0x632BE5ABUL);
+	int i;
+
+	for (i = 0; i < 4; i++)
+		r->s[i] = splitmix(&x);
+
+	/* The all-zero state is the one state xoshiro never leaves               */
+	if ((r->s[0] | r->s[1] | r->s[2] | r->s[3]) == 0)
+		r->s[0] = 1;
+}
+
+/*******************************************************************************
+* Next 32 random bits                                                          *
+*******************************************************************************/
+uint32_t rng_next (RngStream *r) {
+	uint32_t *s = r->s;
+	uint32_t result = rotl(s[1] * 5, 7) * 9;
+	uint32_t t = s[1] << 9;
+
+	s[2] ^= s[0];
+	s[3] ^= s[1];
+	s[1] ^= s[2];
+	s[0] ^= s[3];
+	s[2] ^= t;
+	s[3] = rotl(s[3], 11);
+
+	return result;
+}
+
+/*******************************************************************************
+* Uniform integer in [0, bound) without modulo bias (Lemire's method)          *
+*   Return:       0 if bound is 0                                              *
+*******************************************************************************/
+uint32_t rng_below (RngStream *r, uint32_t bound) {
+	uint64_t m = (uint64_t)rng_next(r) * bound;
+	uint32_t low = (uint32_t)m;
+
+	/* Reject the few products that would make some results more likely;
+	   the threshold division only runs in that rare case                    */
+	if (low < bound) {
+		uint32_t threshold = (0U - bound) % bound;
+
+		while (low < threshold) {
+			m = (uint64_t)rng_next(r) * bound;
+			low = (uint32_t)m;
+		}
+	}
+
+	return (uint32_t)(m >> 32);
+}
+
+/*******************************************************************************
+* Uniform integer in [low, high], both inclusive                               *
+*******************************************************************************/
+int32_t rng_range (RngStream *r, int32_t low, int32_t high) {
+	return low + (int32_t)rng_below(r, (uint32_t)(high - low) + 1);
+}
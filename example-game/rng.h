@@ -0,0 +1,31 @@
+/*----------------------------------------------------------------------------
+* Name:    rng.h
+* Purpose: Small, fast pseudo random number generator with independent streams
+* Note(s): xoshiro128** (32-bit, no multiply-heavy state update, so it is
+*          cheap on the Cortex-M3). All state lives in the RngStream, so
+*          every thread or subsystem owns its own stream and nothing is
+*          shared: reentrant under RTX without locks, unlike rand().
+*          Pure C, also built into the host tools.
+*----------------------------------------------------------------------------*/
+#ifndef __RNG_H
+#define __RNG_H
+
+#include <stdint.h>
+
+typedef struct {
+	uint32_t s[4];
+} RngStream;
+
+/* Stream ids: the same seed gives unrelated sequences for different ids      */
+enum {
+	RNG_STREAM_SPAWN = 0,       /* Golf: ball and hole placement           */
+	RNG_STREAM_TELEPORT,        /* Golf: teleporter destinations          */
+	RNG_STREAM_ENEMY            /* Space game: enemy shots                 */
+};
+
+void     rng_seed  (RngStream *r, uint32_t seed, uint32_t stream);
+uint32_t rng_next  (RngStream *r);
+uint32_t rng_below (RngStream *r, uint32_t bound);
+int32_t  rng_range (RngStream *r, int32_t low, int32_t high);
+
+#endif /* __RNG_H */
@@ -0,0 +1,86 @@
+/*----------------------------------------------------------------------------
+* Name:    spsc_ring.h
+* Purpose: Lock-free single producer / single consumer ring buffer
+* Note(s): One side may be an interrupt handler. No locks are taken; the
+*          producer only writes head, the consumer only writes tail and the
+*          data accesses are ordered against them with DMB barriers.
+*          The capacity must be a power of two so wrapping is a mask.
+*----------------------------------------------------------------------------*/
+#ifndef __SPSC_RING_H
+#define __SPSC_RING_H
+
+#include <stdint.h>
+#include <string.h>
+#include <lpc17xx.h>
+
+typedef struct {
+	volatile uint32_t head;     /* Next slot to write, producer only       */
+	volatile uint32_t tail;     /* Next slot to read, consumer only        */
+	volatile uint32_t dropped;  /* Pushes refused because the ring was full */
+	uint32_t mask;              /* Capacity - 1                            */
+	uint32_t elemSize;          /* Size of one element in bytes            */
+	uint8_t *data;
+} SpscRing;
+
+/* Defines a ring named `name` holding `capacity` elements of `type`.
+   Fails to compile if capacity is not a power of two.                       */
+#define SPSC_RING_DEFINE(name, type, capacity)                                      \
+	typedef char name##_capacity_must_be_pow2[((capacity) & ((capacity) - 1)) == 0 ? 1 : -1]; \
+	static type name##_storage[(capacity)];                                         \
+	SpscRing name = { 0, 0, 0, (capacity) - 1, sizeof(type), (uint8_t *)name##_storage }
+
+/*******************************************************************************
+* Number of elements currently in the ring (exact for either side)             *
+*******************************************************************************/
+static __inline uint32_t spsc_count (const SpscRing *r) {
+
+	return r->head - r->tail;
+}
+
+/*******************************************************************************
+* Producer side: copy one element in                                           *
+*   Return:       1 on success, 0 if the ring was full (counted in dropped)    *
+*******************************************************************************/
+static __inline uint8_t spsc_push (SpscRing *r, const void *item) {
+	uint32_t head = r->head;
+
+	if (head - r->tail > r->mask) {
+		r->dropped++;
+		return 0;
+	}
+
+	if (r->elemSize == 1) {
+		r->data[head & r->mask] = *(const uint8_t *)item;
+	} else {
+		memcpy(&r->data[(head & r->mask) * r->elemSize], item, r->elemSize);
+	}
+
+	__DMB();                    /* Element visible before it is published  */
+	r->head = head + 1;
+	return 1;
+}
+
+/*******************************************************************************
+* Consumer side: copy one element out                                          *
+*   Return:       1 on success, 0 if the ring was empty                        *
+*******************************************************************************/
+static __inline uint8_t spsc_pop (SpscRing *r, void *item) {
+	uint32_t tail = r->tail;
+
+	if (r->head == tail) {
+		return 0;
+	}
+	__DMB();                    /* Read head before the element behind it  */
+
+	if (r->elemSize == 1) {
+		*(uint8_t *)item = r->data[tail & r->mask];
+	} else {
+		memcpy(item, &r->data[(tail & r->mask) * r->elemSize], r->elemSize);
+	}
+
+	__DMB();                    /* Element read before the slot is freed   */
+	r->tail = tail + 1;
+	return 1;
+}
+
+#endif /* __SPSC_RING_H */
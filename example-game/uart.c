@@ -21,6 +21,7 @@
 #include "lpc17xx.h"
 //#include "type.h"
 #include "uart.h"
+#include "spsc_ring.h"
 
 extern uint32_t SystemCoreClock;
 
@@ -28,103 +29,79 @@ extern uint32_t SystemCoreClock;
 volatile int ITM_RxBuffer = ITM_RXBUFFER_EMPTY;  /*  CMSIS Debug Input        */
 //#endif
 
-volatile uint32_t UART0Status, UART1Status;
-volatile uint8_t UART0TxEmpty = 1, UART1TxEmpty = 1;
-volatile uint8_t UART0Buffer[BUFSIZE], UART1Buffer[BUFSIZE];
-volatile uint32_t UART0Count = 0, UART1Count = 0;
-
-volatile uint8_t RcvLock0; 
-volatile uint8_t SndLock0; 
-
-volatile uint8_t RcvLock1; 
-volatile uint8_t SndLock1; 
+/* RX is produced by the ISR and consumed by UARTRecieve, TX is produced by
+   UARTSend (every caller through UARTPush, one at a time) and consumed by the
+   ISR. Overflow drops the new byte and counts it in the ring instead of
+   discarding everything received so far.                                   */
+SPSC_RING_DEFINE(UART0RxRing, uint8_t, BUFSIZE);
+SPSC_RING_DEFINE(UART1RxRing, uint8_t, BUFSIZE);
+SPSC_RING_DEFINE(UART0TxRing, uint8_t, BUFSIZE);
+SPSC_RING_DEFINE(UART1TxRing, uint8_t, BUFSIZE);
 
 volatile int i = 0;
 
-void Free(volatile uint8_t *tbl){
-	*tbl = 0;
-}
-
-uint8_t Lock(volatile uint8_t *tbl){
-	// Get the lock status and see if it is already locked
-	if (__LDREXW(tbl) == 0) {
-		// if not locked, try set lock to 1
-		return  (__STREXW(1, tbl) != 0) ;
-	} else {
-		return(1); // return fail status
-	}
-}
-
-uint8_t LockRcv(uint8_t portNum){
-	if(portNum > 1)
-		return 0x1;
-	return Lock(portNum == 0? &RcvLock0 : &RcvLock1);
-}
-
-uint8_t LockSnd(uint8_t portNum){
-	if(portNum > 1)
-		return 0x1;
-	return Lock(portNum == 0? &SndLock0 : &SndLock1);
-}
-
-void FreeRcv(uint8_t portNum){
-	if(portNum > 1)
-		return;
-	Free( portNum == 0? &RcvLock0 : &RcvLock1 );
-}
-
-void FreeSnd(uint8_t portNum){
-	if(portNum > 1)
-		return;
-	Free( portNum == 0? &SndLock0 : &SndLock1 );
-}
+#define TX_FIFO_DEPTH	16
 
+/* Longest UARTSend waits for a slot in a full TX ring: a few million cycles,
+   tens of ms at 100 MHz, well past the 1.4 ms a 16 byte FIFO takes to drain
+   at 115200 baud, so only a transmitter that has stopped times out        */
+#define TX_WAIT_LOOPS	(1UL << 21)
 
 /*****************************************************************************
-** Function name:		UART0_IRQHandler
+** Function name:		UARTService
 **
-** Descriptions:		UART0 interrupt handler
+** Descriptions:		Common UART interrupt work: drain the RX FIFO into the
+**						RX ring and refill the TX FIFO from the TX ring
 **
-** parameters:			None
+** parameters:			UART registers, RX ring and TX ring of the port
 ** Returned value:		None
 ** 
 *****************************************************************************/
-void UART0_IRQHandler (void) 
+static void UARTService( LPC_UART_TypeDef *LPC_UART, SpscRing *rx, SpscRing *tx )
 {
-	uint8_t IIRValue, LSRValue;
+	uint8_t IIRValue, c;
+	uint32_t n;
 
-	IIRValue = LPC_UART0->IIR;
+	IIRValue = LPC_UART->IIR;
 
 	IIRValue >>= 1;			/* skip pending bit in IIR */
 	IIRValue &= 0x07;			/* check bit 1~3, interrupt identification */
 
-	LSRValue = LPC_UART0->LSR;
-
-	if ( LSRValue & LSR_RDR )	/* Receive Data Ready */	
+	/* Receive Data Ready: read RBR until the FIFO is empty, this also clears
+	   the RDA and CTI interrupts */
+	while ( LPC_UART->LSR & LSR_RDR )
 	{
-		/* If no error on RLS, normal ready, save into the data buffer. */
-		/* Note: read RBR will clear the interrupt */
-		UART0Buffer[UART0Count] = LPC_UART0->RBR;
-		UART0Count++;
-		if ( UART0Count == BUFSIZE )
-		{
-		UART0Count = 0;		/* buffer overflow */
-		}
+		c = LPC_UART->RBR;
+		spsc_push(rx, &c);
 	}
 
 	if ( IIRValue == IIR_THRE )	/* THRE, transmit holding register empty */
 	{
-	/* THRE interrupt */
-		LSRValue = LPC_UART0->LSR;		/* Check status in the LSR to see if
-									valid data in U0THR or not */
-		if ( LSRValue & LSR_THRE ){
-			UART0TxEmpty = 1;
+		/* THR is empty, so the whole TX FIFO can be refilled */
+		for ( n = 0; n < TX_FIFO_DEPTH && spsc_pop(tx, &c); ++n )
+		{
+			LPC_UART->THR = c;
 		}
-		else{
-			UART0TxEmpty = 0;
+
+		if ( n == 0 )
+		{
+			LPC_UART->IER &= ~IER_THRE;	/* Nothing left to send */
 		}
 	}
+}
 
+/*****************************************************************************
+** Function name:		UART0_IRQHandler
+**
+** Descriptions:		UART0 interrupt handler
+**
+** parameters:			None
+** Returned value:		None
+** 
+*****************************************************************************/
+void UART0_IRQHandler (void) 
+{
+	UARTService( (LPC_UART_TypeDef *)LPC_UART0, &UART0RxRing, &UART0TxRing );
 }
 
 /*****************************************************************************
@@ -138,40 +115,7 @@ void UART0_IRQHandler (void)
 *****************************************************************************/
 void UART1_IRQHandler (void) 
 {
-
-	uint8_t IIRValue, LSRValue;
-
-	IIRValue = LPC_UART1->IIR;
-
-	IIRValue >>= 1;			/* skip pending bit in IIR */
-	IIRValue &= 0x07;			/* check bit 1~3, interrupt identification */
-
-	LSRValue = LPC_UART1->LSR;
-
-	if ( LSRValue & LSR_RDR )	/* Receive Data Ready */	
-	{
-		/* If no error on RLS, normal ready, save into the data buffer. */
-		/* Note: read RBR will clear the interrupt */
-		UART1Buffer[UART1Count] = LPC_UART1->RBR;
-		UART1Count++;
-		if ( UART1Count == BUFSIZE ){
-		UART0Count = 0;		/* buffer overflow */
-		}
-	}
-
-	if ( IIRValue == IIR_THRE )	/* THRE, transmit holding register empty */
-	{
-	/* THRE interrupt */
-		LSRValue = LPC_UART1->LSR;		/* Check status in the LSR to see if
-									valid data in U0THR or not */
-		if ( LSRValue & LSR_THRE ){
-			UART1TxEmpty = 1;
-		}
-		else{
-			UART1TxEmpty = 0;
-		}
-	}
-
+	UARTService( (LPC_UART_TypeDef *)LPC_UART1, &UART1RxRing, &UART1TxRing );
 }
 
 /* By default, the PCLKSELx value is zero, thus, the PCLK for
@@ -236,11 +180,7 @@ uint32_t UARTInit( uint32_t PortNum, uint32_t baudrate )
 
 	 	NVIC_EnableIRQ(UART0_IRQn);
 
-		//LPC_UART0->IER = IER_RBR | IER_THRE | IER_RLS;	/* Enable UART0 interrupt */
-		//LPC_UART0->IER =  IER_THRE ;//| IER_RLS;			/* Disable RBR */
-
-		FreeRcv(0);
-		FreeSnd(0);
+		LPC_UART0->IER = IER_RBR;	/* RX always goes into the ring, THRE is enabled on demand */
 		return (TRUE);
 	}
 	else if ( PortNum == 1 )
@@ -264,21 +204,63 @@ uint32_t UARTInit( uint32_t PortNum, uint32_t baudrate )
 
 	 	NVIC_EnableIRQ(UART1_IRQn);
 
-		//LPC_UART1->IER = IER_RBR | IER_THRE | IER_RLS;	/* Enable UART1 interrupt */
-
-		FreeRcv(1);
-		FreeSnd(1);
+		LPC_UART1->IER = IER_RBR;	/* RX always goes into the ring, THRE is enabled on demand */
 
 		return (TRUE);
 	}
 	return( FALSE ); 
 }
 
+/*****************************************************************************
+** Function name:		UARTPush
+**
+** Descriptions:		Put one byte in the TX ring of a port and, if the
+**						transmitter is idle, prime its FIFO. Runs with
+**						interrupts masked: the ring has one producer slot and
+**						printf, the trace and interrupt handlers all send, so
+**						this is the lock that makes them one producer, and it
+**						also keeps the port ISR (the consumer) out while the
+**						FIFO is primed here
+**
+** parameters:			UART registers, TX ring and the byte
+** Returned value:		1 if queued, 0 if the ring was full (counted in
+**						the ring's dropped, like an RX overflow)
+** 
+*****************************************************************************/
+static uint8_t UARTPush( LPC_UART_TypeDef *LPC_UART, SpscRing *tx, uint8_t c )
+{
+	uint32_t primask = __get_PRIMASK();
+	uint8_t queued;
+	uint32_t n;
+
+	__disable_irq();
+	queued = spsc_push(tx, &c);
+
+	/* If the transmitter is idle no THRE interrupt will come, so prime the
+	   FIFO here */
+	if ( queued && !(LPC_UART->IER & IER_THRE) ) {
+		if ( LPC_UART->LSR & LSR_THRE ) {
+			for ( n = 0; n < TX_FIFO_DEPTH && spsc_pop(tx, &c); ++n )
+				LPC_UART->THR = c;
+		}
+		LPC_UART->IER |= IER_THRE;
+	}
+	__set_PRIMASK(primask);
+
+	return queued;
+}
+
 /*****************************************************************************
 ** Function name:		UARTSend
 **
-** Descriptions:		Send a block of data to the UART 0 port based
-**						on the data length
+** Descriptions:		Send a block of data to the UART 0-1 port based
+**						on the data length. While the TX ring is full a
+**						thread waits for the ISR to make room, for at most
+**						TX_WAIT_LOOPS; from an interrupt handler, or with
+**						interrupts masked, the ISR cannot run, so the byte
+**						is dropped (and counted) instead of spinning forever.
+**						After a timeout the rest of the block is dropped
+**						without waiting again
 **
 ** parameters:			portNum, buffer pointer, and data length
 ** Returned value:		None
@@ -288,47 +270,36 @@ uint32_t UARTInit( uint32_t PortNum, uint32_t baudrate )
 void UARTSend( uint32_t portNum, uint8_t *BufferPtr, uint32_t Length )
 {
 	LPC_UART_TypeDef *LPC_UART;
-	volatile unsigned char *UARTTxEmpty;				//ASK Douglas
-	uint8_t *localBufferPtr;
-	uint32_t localLength;
+	SpscRing *txRing;
+	uint32_t wait;
+	uint8_t canWait;
 
 	if((portNum >> 1 ) != 0)
 		return;
 
-	localLength = Length;
-	localBufferPtr = BufferPtr;
-	UARTTxEmpty = (portNum == 0 ? &UART0TxEmpty : &UART1TxEmpty);
+	txRing = (portNum == 0 ? &UART0TxRing : &UART1TxRing);
 	LPC_UART = (portNum == 0 ? (LPC_UART_TypeDef *)LPC_UART0 : (LPC_UART_TypeDef *)LPC_UART1 );
-
-	//Enable interupt
-	LPC_UART->IER |=  IER_THRE;
-
-	while( LockSnd(portNum));
-
-	while ( localLength != 0 ){
-		/* THRE status, contain valid data */
-		while ( !(*UARTTxEmpty & 0x01) );
-		LPC_UART->THR = *localBufferPtr;
-		*UARTTxEmpty = 0;	/* not empty in the THR until it shifts out */
-		localBufferPtr++;
-		localLength--;
+	canWait = ( __get_IPSR() == 0 && __get_PRIMASK() == 0 );
+
+	while ( Length != 0 ){
+		/* Wait for the ISR to make room rather than dropping output */
+		for ( wait = 0; canWait && spsc_count(txRing) > txRing->mask; ++wait ) {
+			if ( wait == TX_WAIT_LOOPS ) {
+				canWait = 0;	/* Transmitter stalled: drop the rest */
+			}
+		}
+		UARTPush(LPC_UART, txRing, *BufferPtr);
+		BufferPtr++;
+		Length--;
 	}
 
-	FreeSnd(portNum);
-
-	//Reanble other interpts
-	LPC_UART->IER &= ~IER_THRE;
-
 	return;
 }
 
 void UARTSendChar( uint32_t portNum, uint8_t character)
 {
 	#ifdef __RTGT_UART
-		LPC_UART_TypeDef *LPC_UART;
-		LPC_UART = (portNum == 0 ? (LPC_UART_TypeDef *)LPC_UART0 : (LPC_UART_TypeDef *)LPC_UART1 );
-		while (!(LPC_UART->LSR & 0x20));
-		LPC_UART->THR = character;
+		UARTSend(portNum, &character, 1);
 	#else
 		ITM_SendChar(character);
 	#endif
@@ -336,57 +307,54 @@ void UARTSendChar( uint32_t portNum, uint8_t character)
 }
 
 
+/*****************************************************************************
+** Function name:		UARTTxDropped
+**
+** Descriptions:		Bytes UARTSend has dropped on the UART 0-1 port since
+**						startup: sent from an interrupt handler or with
+**						interrupts masked while the TX ring was full, or after
+**						the transmitter stalled for TX_WAIT_LOOPS. Any of them
+**						means the output on that port is missing bytes
+**
+** parameters:			portNum
+** Returned value:		number of bytes dropped
+** 
+*****************************************************************************/
+uint32_t UARTTxDropped( uint32_t portNum )
+{
+	if((portNum >> 1 ) != 0)
+		return 0;
+
+	return (portNum == 0 ? UART0TxRing.dropped : UART1TxRing.dropped);
+}
+
 /*****************************************************************************
 ** Function name:		UARTRecieve
 **
-** Descriptions:		Recieve a block of data to the UART 0-1 port based
-**						on the data length
+** Descriptions:		Recieve a block of data from the UART 0-1 port. Waits
+**						for at least one byte, then returns whatever is
+**						buffered up to Length
 **
 ** parameters:			portNum, buffer pointer, and data length
-** Returned value:		integer showing status
+** Returned value:		number of bytes received
 ** 
 *****************************************************************************/
 uint32_t UARTRecieve( uint32_t portNum, uint8_t *BufferPtr, uint32_t Length )
 {
-
-	LPC_UART_TypeDef *LPC_UART;
-	volatile uint32_t *UARTCount;				//ASK Douglas
-	volatile uint8_t *UARTBuffer;
-	uint8_t *rcvdBufferPtr;
-	uint32_t rcvd_len, i;
+	SpscRing *rxRing;
+	uint32_t rcvd_len;
 
 	if((portNum >> 1 ) != 0)
 		return 0;
 
-	rcvd_len = 0x0;
-	rcvdBufferPtr = BufferPtr;
-	UARTCount = (portNum == 0 ? &UART0Count : &UART1Count);
-	UARTBuffer = (portNum == 0 ? UART0Buffer : UART1Buffer);
-	LPC_UART = (portNum == 0 ? (LPC_UART_TypeDef *)LPC_UART0 : (LPC_UART_TypeDef *)LPC_UART1 );
-
-	*UARTCount = 0x0;
-
-	//Enable interupt
-	LPC_UART->IER |=  IER_RBR;
+	rxRing = (portNum == 0 ? &UART0RxRing : &UART1RxRing);
 
 	//busy waiting
+	while( spsc_count(rxRing) == 0 );
 
-	while( *UARTCount == 0 );
-
-
-	//This part has to be put in the critical section
-	while(LockRcv(portNum));
-
-	//Reanble other interpts
-	LPC_UART->IER &= ~IER_RBR;			/* Disable RBR */
-
-
-	for(i = 0; i < *UARTCount; ++i)
-		rcvdBufferPtr[rcvd_len++] = UARTBuffer[i];
-
-	*UARTCount = 0;
-
-	FreeRcv(portNum);
+	rcvd_len = 0x0;
+	while ( rcvd_len < Length && spsc_pop(rxRing, &BufferPtr[rcvd_len]) )
+		rcvd_len++;
 
 	return rcvd_len;
 }
@@ -394,14 +362,9 @@ uint32_t UARTRecieve( uint32_t portNum, uint8_t *BufferPtr, uint32_t Length )
 uint8_t UARTReceiveChar( uint32_t portNum)
 {
 	#ifdef __RTGT_UART
-		/*uint8_t ret[1];
-		if (UARTRecieve(portNum, ret, 1) == 1)
-			return ret[0];
-		return 0x0;	*/
-		LPC_UART_TypeDef *LPC_UART;
-		LPC_UART = (portNum == 0 ? (LPC_UART_TypeDef *)LPC_UART0 : (LPC_UART_TypeDef *)LPC_UART1 );
-		while (!(LPC_UART->LSR & 0x01));
-		return (LPC_UART->RBR);
+		uint8_t ret[1];
+		UARTRecieve(portNum, ret, 1);
+		return ret[0];
 	#else
 		while (ITM_CheckChar() != 1) __NOP();
 		return (ITM_ReceiveChar());
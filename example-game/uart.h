@@ -58,6 +58,7 @@ void UART1_IRQHandler( void );
 uint32_t UARTInit( uint32_t portNum, uint32_t Baudrate );
 
 void     UARTSend(    uint32_t portNum, uint8_t *BufferPtr, uint32_t Length );
+uint32_t UARTTxDropped( uint32_t portNum );
 uint32_t UARTRecieve( uint32_t portNum, uint8_t *BufferPtr, uint32_t Length );
 
 void     UARTSendChar(    uint32_t portNum, uint8_t character );
@@ -1,33 +1,26 @@
 #include "gameLogic.h"
+#include "snapshot.h"
+#include "uart.h"
+#ifdef AI_DEMO
+#include "solver.h"
+#endif
 
 #include <stdbool.h>
-#include <math.h>
 
 //==============================
 //========= CONSTANTS ========== 
 //==============================
 
-// Define PI as M_PI 
-# ifndef M_PI
-# define M_PI 3.14159265358979323846
-# endif
-
 // Power Mutex and Data
-const uint32_t MAX_POWER = 8;
-const uint32_t MIN_POWER = 2;
-
-// Acceleration Constant
-const double ACCEL = 0.1;
-
-// Used to convert raw pot value to in-game angle. Note: 90 degrees means straight up; -95 - 90 = -185
-const int MAP_CONVERSION_ANGLE = -185; 
+const uint32_t MAX_POWER = SHOT_MAX_POWER;
+const uint32_t MIN_POWER = SHOT_MIN_POWER;
 
 // Losing Condition: If the player goes beyond 20 hits or attempts
 const int MAX_GOLF_SCORE = 20;
 
 // LCD Constants
-const uint32_t LCD_HEIGHT = 240;  // y-axis
-const uint32_t LCD_WIDTH = 320;  // x-axis
+const uint32_t LCD_HEIGHT = COURSE_HEIGHT;  // y-axis
+const uint32_t LCD_WIDTH = COURSE_WIDTH;  // x-axis
 
 // Sizes and bitmaps
 const uint32_t BALL_SIZE = 5;
@@ -36,16 +29,36 @@ const uint32_t ENV_SIZE = 5;
 const uint32_t BALL_GLCD_WIDTH = 3;
 const uint32_t ENVIRONMENT_GLCD_WIDTH = 3;
 
-// Hardcoded Teleporter Position
-const uint32_t TELEPORTER_X = 100;
-const uint32_t TELEPORTER_Y = 150;
+// Period of the score report timer service (in ticks)
+const uint32_t SCORE_PERIOD = 1000;
+
+#ifdef AI_DEMO
+// Solver time per shot and pause between the AI's shots (in ticks)
+const uint32_t AI_SOLVE_BUDGET = 200;
+const uint32_t AI_SHOT_PAUSE = 1000;
+#endif
+
+// Ticks between two checks of the aim preview
+const uint32_t PREVIEW_PERIOD = 20;
+
+// Ticks between two HUD updates
+const uint32_t HUD_PERIOD = 50;
+
+// Frame budget of the script thread, in LCD SPI bytes and in time: 2 ms of SPI at 12.5 MHz. A ball step
+// costs about 1-2 KB, so the HUD and the preview are put off to frames that have room for them.
+const uint32_t FRAME_BUDGET_BYTES = 3125;
+const uint32_t FRAME_BUDGET_US = 2000;
+
+// Course to play, from the courses compiled into courseData.c
+#ifndef COURSE_INDEX
+#define COURSE_INDEX 0
+#endif
 
 //==============================
 //====== MUTEX, THREAD IDs =====
 //==============================
 
 extern osThreadId_t hitBallID;
-extern osThreadId_t writeScoreID;
 
 // Mutex to access the Ball 
 extern osMutexId_t ballMutex;
@@ -63,267 +76,597 @@ extern osMutexId_t scoreMutex;
 
 Ball *golfBall;
 Environment *hole;
-Environment *teleporter;
+Environment *teleporter;  // the first teleporter of the course
+
+// Walls, hazards, teleporters and holes of the course being played (points into flash)
+Course gameCourse;
 
 // Note: the direction is kept in degrees and is not converted in accordance to the map. It must be updated immediately before using.
 uint32_t prevPlayerDirection = 0;  // value to add hysteresis to prevent jittering in the pot output
 
+// Random streams; spawnRng is only used before the kernel starts, teleportRng only on the script thread
+RngStream spawnRng;
+RngStream teleportRng;
+
 // Golf Score Mutex and Data
 int golfScore;  
 
+// Raw input events, one ring per input thread (producer) to inputScript (consumer)
+SPSC_RING_DEFINE(buttonEvents, InputEvent, 8);
+SPSC_RING_DEFINE(powerEvents, InputEvent, 8);
+SPSC_RING_DEFINE(angleEvents, InputEvent, 16);
+
+// Hits accepted by inputScript, waiting for ballScript; both ends are on the script thread
+SPSC_RING_DEFINE(inputEvents, InputEvent, 8);
+
+// Score reporting service, stopped when the game ends
+Service *scoreService;
+
+// Script slots of the game sequences that are stopped when the game ends
+Script *ballScriptSlot;
+Script *teleportScriptSlot;
+Script *previewScriptSlot;
+Script *hudScriptSlot;
+#ifdef AI_DEMO
+Script *aiScriptSlot;
+#endif
+
 // Bitmap for the Ball, Hole, and Teleporter
 char ballBitmap[] = {0x38, 0x38, 0x38}; // 3 x 8 
 char holeBitmap[] = {0x38, 0x38, 0x38}; // 3 x 8
 char teleporterBitmap[] = {0x38, 0x38, 0x38}; // 3 x 8
 
+// What the hole and the teleporters look like: 9 x 9, 2 bits per pixel, drawn over the lit box of their bitmaps
+// (the same box as the ball's). Index 0 is transparent.
+static const uint8_t holePixels[] = {
+	0x05, 0x54, 0x00,  // ..11111..
+	0x1A, 0xA9, 0x00,  // .1222221.
+	0x6A, 0xAA, 0x40,  // 122222221
+	0x6A, 0xEA, 0x40,  // 122232221
+	0x6A, 0xEA, 0x40,  // 122232221
+	0x6A, 0xAA, 0x40,  // 122222221
+	0x6A, 0xAA, 0x40,  // 122222221
+	0x1A, 0xA9, 0x00,  // .1222221.
+	0x05, 0x54, 0x00,  // ..11111..
+};
+static const uint8_t teleporterPixels[] = {
+	0x05, 0x54, 0x00,  // ..11111..
+	0x16, 0xA5, 0x00,  // .1122211.
+	0x5B, 0xF9, 0x40,  // 112333211
+	0x6F, 0x7E, 0x40,  // 123313321
+	0x6D, 0x5E, 0x40,  // 123111321
+	0x6F, 0x7E, 0x40,  // 123313321
+	0x5B, 0xF9, 0x40,  // 112333211
+	0x16, 0xA5, 0x00,  // .1122211.
+	0x05, 0x54, 0x00,  // ..11111..
+};
+static const IndexedImage holeImage = { COURSE_BALL_W, COURSE_BALL_H, 2, true, holePixels };
+static const IndexedImage teleporterImage = { COURSE_BALL_W, COURSE_BALL_H, 2, true, teleporterPixels };
+
+// Rim, inside and pin of the hole
+static const unsigned short HOLE_PALETTE[4] = { 0, DarkGrey, Black, White };
+
+// Rim, ring and core of the teleporters; each one of the course is told apart by its palette
+#define TELEPORTER_PALETTES 4
+static const unsigned short TELEPORTER_PALETTE[TELEPORTER_PALETTES][4] = {
+	{ 0, Maroon,   Red,     Yellow },
+	{ 0, Purple,   Magenta, White  },
+	{ 0, Navy,     Cyan,    White  },
+	{ 0, DarkGrey, Yellow,  Red    },
+};
+
 
 // ================================
 // ====== GAME MECHANICS ==========
 // ================================
 
 
+// Seeds every random stream of the game from one seed (ADC noise, or the seed of a replayed trace)
+void seedGame(uint32_t seed) {
+	rng_seed(&spawnRng, seed, RNG_STREAM_SPAWN);
+	rng_seed(&teleportRng, seed, RNG_STREAM_TELEPORT);
+}
+
 // Initializes in-game elements. Called before threads are created and the kernel is initialized.
 // (1) Golf Score
 // (2) Golf golfBall State
 // (3) Hole State
 void setupGame(void) {
+  const CourseHeader *info;
+  uint32_t courseIndex = COURSE_INDEX;
+  uint32_t holeIndex;
+
   golfScore = 0;
+
+  // COURSE (the first one if COURSE_INDEX is not a valid course)
+  if (courseIndex >= NUM_COURSES || !parseCourse(COURSE_DATA[courseIndex], COURSE_SIZES[courseIndex], &gameCourse)) {
+    courseIndex = 0;
+    parseCourse(COURSE_DATA[0], COURSE_SIZES[0], &gameCourse);
+  }
+  info = gameCourse.header;
   
-  // TELEPORTER	
+  // TELEPORTER (a course without one keeps it off the screen)
   teleporter = malloc(sizeof(Environment));
   teleporter->bitmap = teleporterBitmap;
-  teleporter->pos.x = TELEPORTER_X;
-  teleporter->pos.y = TELEPORTER_Y;
+  teleporter->pos.x = (info->teleporterCount > 0) ? gameCourse.teleporters[0].entry.x : -LCD_WIDTH;
+  teleporter->pos.y = (info->teleporterCount > 0) ? gameCourse.teleporters[0].entry.y : -LCD_HEIGHT;
 	
+  // HOLE: one of the course's holes
+  hole = malloc(sizeof(Environment));
+  hole->bitmap = holeBitmap;
+  holeIndex = rng_below(&spawnRng, info->holeCount);
+  hole->pos.x = gameCourse.holes[holeIndex].x;
+  hole->pos.y = gameCourse.holes[holeIndex].y;
+
   // BALL
-  golfBall = malloc(sizeof(golfBall));
+  golfBall = malloc(sizeof(Ball));
   golfBall->bitmap = ballBitmap;
   golfBall->power = MIN_POWER;
+  golfBall->direction = 0;
+  golfBall->xVelocity = 0;
+  golfBall->yVelocity = 0;
+  setLEDLevel(golfBall->power);
 	
-  // Ball location cannot be the same as the Teleporter location, which is fixed
-
-  do {
-	golfBall->pos.x = rand() % ((LCD_WIDTH - BALL_SIZE) - BALL_SIZE + 1) + BALL_SIZE;
-	golfBall->pos.y = rand() % ((LCD_HEIGHT - BALL_SIZE) - BALL_SIZE + 1) + BALL_SIZE;
-  } while (golfBall->pos.x != teleporter->pos.x && golfBall->pos.y != teleporter->pos.y);
+  // Fixed spawn from the course, or a random one that touches no wall, hole, teleporter or hazard
+  if (info->spawn.x != COURSE_RANDOM) {
+    golfBall->pos.x = info->spawn.x;
+    golfBall->pos.y = info->spawn.y;
+  } else {
+    do {
+	  golfBall->pos.x = rng_range(&spawnRng, BALL_SIZE, LCD_WIDTH - BALL_SIZE);
+	  golfBall->pos.y = rng_range(&spawnRng, BALL_SIZE, LCD_HEIGHT - BALL_SIZE);
+    } while (courseSolidAt(&gameCourse, golfBall->pos) || courseTriggerAt(&gameCourse, golfBall->pos));
+  }
 
-  // HOLE
-  hole = malloc(sizeof(Environment));
-  hole->bitmap = holeBitmap;
+	// Background layer: the course, the teleporters and the hole on top
+	sceneReset(&gameCourse);
+	for (int i = 0; i < info->teleporterCount; ++i) {
+		Pos entry = { gameCourse.teleporters[i].entry.x + COURSE_BALL_X, gameCourse.teleporters[i].entry.y + COURSE_BALL_Y };
+		sceneAddImage(entry, &teleporterImage, TELEPORTER_PALETTE[i % TELEPORTER_PALETTES]);
+	}
+	Pos holeBox = { hole->pos.x + COURSE_BALL_X, hole->pos.y + COURSE_BALL_Y };
+	sceneAddImage(holeBox, &holeImage, HOLE_PALETTE);
+	drawScene();
 
-  // Hole location cannot be same as golfBall or the teleporter location when spawned
-  do {
-    hole->pos.x = rand() % ((LCD_WIDTH - ENV_SIZE) - ENV_SIZE + 1) + ENV_SIZE;
-    hole->pos.y = rand() % ((LCD_HEIGHT - ENV_SIZE) - ENV_SIZE + 1) + ENV_SIZE;
-  } while ((hole->pos.x == golfBall->pos.x && hole->pos.y == golfBall->pos.y) || 
-           (hole->pos.x == teleporter->pos.x && hole->pos.y == teleporter->pos.y));
+	// HUD strip over the course, drawn in full the first time
+	hudUpdate(golfScore, golfBall->power, golfBall->direction);
 	
-	// Draw the still ball
+	// Draw the still ball over it
 	GLCD_SetTextColor(White);
 	drawSpriteAt(golfBall->pos.x, golfBall->pos.y, ballBitmap, BALL_GLCD_WIDTH);
 	
-	// Draw the hole
-	GLCD_SetTextColor(Black);
-	drawSpriteAt(hole->pos.x, hole->pos.y, holeBitmap, ENVIRONMENT_GLCD_WIDTH);
-  
-	// Draw teleporter
-  	GLCD_SetTextColor(Red);
-	drawSpriteAt(teleporter->pos.x, teleporter->pos.y, teleporterBitmap, ENVIRONMENT_GLCD_WIDTH);
+	// Spawn checkpoints, so a replay can tell straight away whether it is playing the same course
+	traceCheck(0, TRACE_COURSE, courseIndex);
+	traceCheck(0, TRACE_BALL_POS, TRACE_PACK_POS(golfBall->pos.x, golfBall->pos.y));
+	traceCheck(0, TRACE_HOLE_POS, TRACE_PACK_POS(hole->pos.x, hole->pos.y));
+	traceCheck(0, TRACE_TELEPORTER_POS, TRACE_PACK_POS(teleporter->pos.x, teleporter->pos.y));
+
+	// First copy for the lock-free readers; the kernel is not running yet so no lock is needed
+	publishSnapshot();
 }
 
 
-void checkEndGame(void *args) {
+// -->> SCRIPT: END OF GAME <<--
+// MUTEX: scoreMutex, ballMutex
+// Waits for the win or lose condition, then stops the other game sequences and reports the result once
+bool endGameScript(Script *s) {
+	static int score;
+	static bool won;
+	static GameSnapshot snap;
+
+	SCRIPT_BEGIN(s);
+
 	while (1) {
 		osMutexAcquire(scoreMutex, osWaitForever);
-		int score = golfScore;
+		score = golfScore;
 		osMutexRelease(scoreMutex);
 
-		osMutexAcquire(ballMutex, osWaitForever);
-		
-		// Terminate all threads responsible for drawing on the LCD
-		// And erase the ball from the game
-		
-		if (inHole(BALL_GLCD_WIDTH, ENVIRONMENT_GLCD_WIDTH) || score > MAX_GOLF_SCORE) {
-
-			unsigned char loseText[6] = "LOSE!";
-			unsigned char winText[5] = "WIN!";
-			
-			// Erase the golf ball
-			GLCD_SetTextColor(Green);
-			drawSpriteAt(golfBall->pos.x, golfBall->pos.y, ballBitmap, 3);
-			
-			osThreadTerminate(hitBallID);
-			osThreadTerminate(writeScoreID);
-
-			printf("%s", (score > MAX_GOLF_SCORE) ? loseText : winText);
+		// Read-only check, so use the snapshot rather than contending with the physics writer for ballMutex
+		readSnapshot(&snap);
+		won = spritesOverlap(snap.ball, BALL_GLCD_WIDTH, snap.hole, ENVIRONMENT_GLCD_WIDTH);
+
+		if (won || score > MAX_GOLF_SCORE) {
+			break;
 		}
-		
-		osMutexRelease(ballMutex);
+
+		SCRIPT_NEXT_TICK(s);
 	}
+
+	// Stop everything that moves or draws the ball, then erase it from the game
+	stopScript(ballScriptSlot);
+	stopScript(teleportScriptSlot);
+	stopScript(previewScriptSlot);
+	stopScript(hudScriptSlot);
+#ifdef AI_DEMO
+	stopScript(aiScriptSlot);
+#else
+	osThreadTerminate(hitBallID);
+#endif
+	stopService(scoreService);
+
+	osMutexAcquire(ballMutex, osWaitForever);
+	clearPreview();
+	eraseBallAt(golfBall->pos);
+	hudUpdate(score, golfBall->power, golfBall->direction);
+	osMutexRelease(ballMutex);
+
+	traceFinish(currentScriptTick(), score, won);
+
+	printf("%s\n", (score > MAX_GOLF_SCORE) ? "LOSE!" : "WIN!");
+	printServiceStats();
+	printf("preview dots written: %u\n", previewDotWrites);
+	printf("background pixels restored: %u\n", sceneRestoredPixels);
+	printf("LCD SPI bytes: %u\n", GLCD_SpiBytes);
+	printf("HUD pixels written: %u (at most %u per update)\n", hudPixelWrites, hudMaxUpdatePixels);
+	printf("UART bytes dropped: %u (UART0), %u (UART1)\n", UARTTxDropped(0), UARTTxDropped(1));
+	printFrameStats();
+
+	// The result over the whole screen, decoded from flash straight to the LCD
+	osMutexAcquire(ballMutex, osWaitForever);
+	drawRleImage(0, 0, (score > MAX_GOLF_SCORE) ? &loseImage : &winImage);
+	osMutexRelease(ballMutex);
+
+	SCRIPT_END(s);
 }
 
-void teleportBall(void *args) {
-  while (1) {		
-	// Randomly teleport ball to a different location. It is possible for the ball to return to the same spot or in the hole itself.
-	if (inTeleporter(BALL_GLCD_WIDTH, ENVIRONMENT_GLCD_WIDTH)) {
+// -->> SCRIPT: TELEPORTER <<--
+// MUTEX: ballMutex
+// PROTECTED DATA: golfBall->pos, golfBall->xVelocity, golfBall->yVelocity
+bool teleportScript(Script *s) {
+	SCRIPT_BEGIN(s);
+
+	while (1) {
 		osMutexAcquire(ballMutex, osWaitForever);
 
-	    // DON'T Redraw the teleporter, since collision with the ball overwrites parts the sprite 
-		// This is a game feature; the teleporter should disappear so the user has to memorize its location if 
-		// collision happens frequently enough to erase it off the map
-		
-		GLCD_SetTextColor(Green);	
-	    // Clear the ball at the teleporter location
-		drawSpriteAt(golfBall->pos.x, golfBall->pos.y, ballBitmap, BALL_GLCD_WIDTH);
-		
-		golfBall->pos.x = rand() % ((LCD_WIDTH - ENV_SIZE) - ENV_SIZE + 1) + ENV_SIZE;
-		golfBall->pos.y = rand() % ((LCD_HEIGHT - ENV_SIZE) - ENV_SIZE + 1) + ENV_SIZE;
-		golfBall->xVelocity = 0;
-		golfBall->yVelocity = 0;
-	
+		// Teleport the ball to the exit of the teleporter it hit. Teleporters without a fixed exit send it to a random spot off the walls;
+		// it is possible for the ball to return to the same spot or in the hole itself.
+		int index = courseTeleporterAt(&gameCourse, golfBall->pos, BALL_GLCD_WIDTH, ENVIRONMENT_GLCD_WIDTH);
+		if (index >= 0) {
+			const CourseTeleporter *pair = &gameCourse.teleporters[index];
+
+			// Clear the ball at the teleporter location; the teleporter under it is redrawn with the background
+			eraseBallAt(golfBall->pos);
+
+			if (pair->exit.x != COURSE_RANDOM) {
+				golfBall->pos.x = pair->exit.x;
+				golfBall->pos.y = pair->exit.y;
+			} else {
+				do {
+					golfBall->pos.x = rng_range(&teleportRng, ENV_SIZE, LCD_WIDTH - ENV_SIZE);
+					golfBall->pos.y = rng_range(&teleportRng, ENV_SIZE, LCD_HEIGHT - ENV_SIZE);
+				} while (courseSolidAt(&gameCourse, golfBall->pos));
+			}
+			traceCheck(currentScriptTick(), TRACE_BALL_POS, TRACE_PACK_POS(golfBall->pos.x, golfBall->pos.y));
+
+			// Zeroing the velocity ends a flight that is in progress on its next step
+			golfBall->xVelocity = 0;
+			golfBall->yVelocity = 0;
+
+			GLCD_SetTextColor(White);
+			drawSpriteAt(golfBall->pos.x, golfBall->pos.y, ballBitmap, BALL_GLCD_WIDTH);
+
+			publishSnapshot();
+		}
+
 		osMutexRelease(ballMutex);
-    } 
-  }
+
+		SCRIPT_NEXT_TICK(s);
+	}
+
+	SCRIPT_END(s);
 }
 
+// Applies one input to the game. Runs on the script thread, at the start of a script tick, which is
+// what makes a game reproducible from its inputs.
+// MUTEX: ballMutex
+// PROTECTED DATA: golfBall->power, golfBall->direction
+void applyInput(uint8_t type, int32_t value) {
+	InputEvent event = { osKernelGetTickCount(), type, value };
 
-void drawPixelsAt(int x, int y, int limit) {
-	for (int i = 0; i < limit; ++i) {
-		for (int j = 0; j < limit; ++j) {
-			GLCD_PutPixel(x + i, y + j);
-		}
+	switch (type) {
+		case INPUT_HIT:
+			spsc_push(&inputEvents, &event);
+			break;
+
+		case INPUT_POWER:
+			osMutexAcquire(ballMutex, osWaitForever);
+			if ((value < 0 && golfBall->power > MIN_POWER) || (value > 0 && golfBall->power < MAX_POWER)) {
+				golfBall->power += value;
+				setLEDLevel(golfBall->power);
+				publishSnapshot();
+			}
+			osMutexRelease(ballMutex);
+			break;
+
+		case INPUT_ANGLE:
+			osMutexAcquire(ballMutex, osWaitForever);
+			golfBall->direction = value;
+			publishSnapshot();
+			osMutexRelease(ballMutex);
+			break;
 	}
 }
 
-void drawSpriteAt(int x, int y, char *bitmap, int bitmap_size) {
-	// Print the sprite left to right, with x being the vertical component, y the horizontal
-	// Given the orientation of the screen, joystick, and button
-	
-	int spriteIndex = bitmap_size - 1;
-	int spriteShift = 0;
-	
-	for (int i = (bitmap_size - 1) * SPRITE_SCALE; i >= 0; i -= SPRITE_SCALE) {
-		spriteShift = 0;
-		for (int j = 0; j < SPRITE_COLS*SPRITE_SCALE; j+=SPRITE_SCALE) {
-			if ((bitmap[spriteIndex] >> spriteShift) & 1) {
-				
-				drawPixelsAt(x + ((bitmap_size - 1) * SPRITE_SCALE - i), y + j, SPRITE_SCALE);
+// Records a live input in the trace, then applies it
+void playInput(uint8_t type, int32_t value) {
+	traceInput(currentScriptTick(), type, value);
+	applyInput(type, value);
+}
+
+// -->> SCRIPT: INPUTS <<--
+// Started first, so every tick's inputs are applied before any other script runs.
+// Takes the events of the input threads, or the recorded ones while a trace is replayed.
+bool inputScript(Script *s) {
+	static InputEvent event;
+	static TraceRecord record;
+
+	SCRIPT_BEGIN(s);
+
+	while (1) {
+		if (traceMode == TRACE_REPLAYING) {
+			// Live inputs are dropped; the trace supplies them
+			while (spsc_pop(&angleEvents, &event));
+			while (spsc_pop(&powerEvents, &event));
+			while (spsc_pop(&buttonEvents, &event));
+
+			while (traceNextInput(currentScriptTick(), &record)) {
+				applyInput(record.type, record.value);
+			}
+		} else {
+			// Aim first, so a hit in the same tick uses the new angle and power
+			while (spsc_pop(&angleEvents, &event)) {
+				playInput(event.type, event.value);
+			}
+			while (spsc_pop(&powerEvents, &event)) {
+				playInput(event.type, event.value);
+			}
+			while (spsc_pop(&buttonEvents, &event)) {
+				playInput(event.type, event.value);
 			}
-			
-			spriteShift++; // Bitmap column coordinate
 		}
-		
-		spriteIndex--; // Bitmap row coordinate
+
+		SCRIPT_NEXT_TICK(s);
 	}
+
+	SCRIPT_END(s);
 }
 
-// =============================
-// ======= Serial Output =======
-// =============================
+// -->> SCRIPT: BALL FLIGHT <<--
+// MUTEX: ballMutex
+// Waits for a hit from the input events, then moves the ball one physics step per tick until it stops
+bool ballScript(Script *s) {
+	static InputEvent event;
+	static Pos shotStart;
+
+	SCRIPT_BEGIN(s);
 
-// -->> SERIAL OUTPUT <<--
-// MUTEX: scoreMutex
-// PROTECTED DATA: golfScore
-void writeGolfScore(void *args) {
 	while (1) {
+		while (!spsc_pop(&inputEvents, &event) || event.type != INPUT_HIT) {
+			SCRIPT_NEXT_TICK(s);
+		}
+
+		// Increment the golf score every time the ball is hit
 		osMutexAcquire(scoreMutex, osWaitForever);
-		printf("Golf Score: %d\n", golfScore);
+		golfScore++;
 		osMutexRelease(scoreMutex);
-		osDelay(1000U);
+
+		osMutexAcquire(ballMutex, osWaitForever);
+		// Erase the aim preview and the still ball, putting back the background under them
+		clearPreview();
+		eraseBallAt(golfBall->pos);
+
+		shotStart = golfBall->pos;
+		launchBall();
+		publishSnapshot();
+		osMutexRelease(ballMutex);
+
+		// Move the ball bitmap, i.e. animate the ball moving
+		while (stepBall()) {
+			if (inHazard()) {
+				// Water: one penalty stroke and the ball goes back to where the shot was played from
+				osMutexAcquire(scoreMutex, osWaitForever);
+				golfScore++;
+				osMutexRelease(scoreMutex);
+
+				osMutexAcquire(ballMutex, osWaitForever);
+				eraseBallAt(golfBall->pos);
+
+				golfBall->pos = shotStart;
+				traceCheck(currentScriptTick(), TRACE_BALL_POS, TRACE_PACK_POS(golfBall->pos.x, golfBall->pos.y));
+
+				// Ends the flight on the next step, like a teleport
+				golfBall->xVelocity = 0;
+				golfBall->yVelocity = 0;
+				publishSnapshot();
+				osMutexRelease(ballMutex);
+			}
+
+			SCRIPT_NEXT_TICK(s);
+		}
+
+		// Once the ball has stopped, it is now safe to redraw the still ball.
+		osMutexAcquire(ballMutex, osWaitForever);
+		GLCD_SetTextColor(White);
+		drawSpriteAt(golfBall->pos.x, golfBall->pos.y, ballBitmap, BALL_GLCD_WIDTH);
+		osMutexRelease(ballMutex);
+
+		// The button does nothing while the ball is moving, so drop presses made during the flight
+		while (spsc_pop(&inputEvents, &event));
 	}
+
+	SCRIPT_END(s);
 }
 
+// -->> SCRIPT: AIM PREVIEW <<--
+// MUTEX: ballMutex
+// While the ball is at rest, keeps the dotted path of the next shot in line with the pot and joystick.
+// updatePreview only recomputes and redraws when the ball, angle or power actually changed.
+// Deferrable: its cost follows the number of dots the frame quality allows.
+bool previewScript(Script *s) {
+	SCRIPT_BEGIN(s);
 
-// =============================
-// =========== LEDs ============
-// =============================
+	while (1) {
+		osMutexAcquire(ballMutex, osWaitForever);
+		if (spsc_count(&inputEvents) == 0 && ballStopped(golfBall->xVelocity, golfBall->yVelocity)) {
+			updatePreview(golfBall->pos, golfBall->direction, golfBall->power, hole->pos, BALL_GLCD_WIDTH);
+		}
+		osMutexRelease(ballMutex);
+		setScriptCost(s, previewCost());
 
-// Initialize the LED pin directions (set as outputs)
-void initLEDs(void) { 
-  LPC_GPIO1->FIODIR |= 1<<28; 
-  LPC_GPIO1->FIODIR |= 1<<29; 
-  LPC_GPIO1->FIODIR |= 1<<31; 
-  
-  LPC_GPIO2->FIODIR |= 1<<2; 
-  LPC_GPIO2->FIODIR |= 1<<3; 
-  LPC_GPIO2->FIODIR |= 1<<4; 
-  LPC_GPIO2->FIODIR |= 1<<5; 
-  LPC_GPIO2->FIODIR |= 1<<6;
+		SCRIPT_WAIT_TICKS(s, PREVIEW_PERIOD);
+	}
+
+	SCRIPT_END(s);
 }
 
+// -->> SCRIPT: HUD <<--
+// MUTEX: scoreMutex, ballMutex
+// Keeps the HUD strip in line with the strokes, power and aim. hudUpdate only redraws what changed, at most
+// HUD_MAX_PIXELS pixels; the ball is redrawn if it sits under the strip, since the update wrote over it.
+bool hudScript(Script *s) {
+	static int strokes;
 
-// -->> LEDs <<-- 
-// MUTEX: ballMutex
-// PROTECTED DATA: golfball->power
-// Updates LEDs depending on Power Level
-void updateLEDs(void *args) {
-  while (1) {
-      // Initialize array of ints to store
-      bool ledsOn[MAX_POWER] = {false, false, false, false, false, false, false, false};
-      
-      osMutexAcquire(ballMutex, osWaitForever);
-      for (int i = 0; i < golfBall->power; ++i) {
-        ledsOn[i] = true;
-      }
-      osMutexRelease(ballMutex);
+	SCRIPT_BEGIN(s);
 
-      // LEDs are ordered from P.28 on the left to P.6 on the right
+	while (1) {
+		osMutexAcquire(scoreMutex, osWaitForever);
+		strokes = golfScore;
+		osMutexRelease(scoreMutex);
 
-      //--- GPIO 1 LEDs ---//
-      // First LED
-      if (ledsOn[0]) {
-        LPC_GPIO1->FIOSET |= (1 << 28);
-      } else {
-        LPC_GPIO1->FIOCLR |= (1 << 28);
-      }
+		osMutexAcquire(ballMutex, osWaitForever);
+		if (hudUpdate(strokes, golfBall->power, golfBall->direction) > 0 &&
+		    hudCovers(golfBall->pos, BALL_GLCD_WIDTH * SPRITE_SCALE, SPRITE_COLS * SPRITE_SCALE)) {
+			GLCD_SetTextColor(White);
+			drawSpriteAt(golfBall->pos.x, golfBall->pos.y, ballBitmap, BALL_GLCD_WIDTH);
+		}
+		osMutexRelease(ballMutex);
 
-      // Second LED
-      if (ledsOn[1]) {
-        LPC_GPIO1->FIOSET |= (1 << 29);
-      } else {
-        LPC_GPIO1->FIOCLR |= (1 << 29);
-      }
+		SCRIPT_WAIT_TICKS(s, HUD_PERIOD);
+	}
 
-      // Third LED
-      if (ledsOn[2]) {
-        LPC_GPIO1->FIOSET |= (1 << 31);
-      } else {
-        LPC_GPIO1->FIOCLR |= (1 << 31);
-      }
+	SCRIPT_END(s);
+}
 
-      //--- GPIO2 LEDs --//
-      if (ledsOn[3]) {
-        LPC_GPIO2->FIOSET |= (1 << 2);
-      } else {
-        LPC_GPIO2->FIOCLR |= (1 << 2);
-      }
+#ifdef AI_DEMO
+// -->> SCRIPT: AI PLAYER <<--
+// Replaces the input threads in the demo build: plans the fewest-stroke route from wherever the ball rests,
+// aims and sets the power of its first shot, then hits through the same inputs as the pot, joystick and button.
+// The solver runs on the script thread but is bounded by AI_SOLVE_BUDGET, and only while the ball is still.
+bool aiScript(Script *s) {
+	static GameSnapshot snap;
+	static SolverConfig cfg;
+	static ShotPlan plan;
+	static InputEvent event;
 
-      if (ledsOn[4]) {
-        LPC_GPIO2->FIOSET |= (1 << 3);
-      } else {
-        LPC_GPIO2->FIOCLR |= (1 << 3);
-      }
+	SCRIPT_BEGIN(s);
 
-      if (ledsOn[5]) {
-        LPC_GPIO2->FIOSET |= (1 << 4);
-      } else {
-        LPC_GPIO2->FIOCLR |= (1 << 4);
-      }
+	while (1) {
+		SCRIPT_WAIT_TICKS(s, AI_SHOT_PAUSE);
+
+		// Wait for the previous shot to be played out
+		while (1) {
+			readSnapshot(&snap);
+			if (spsc_count(&buttonEvents) == 0 && spsc_count(&inputEvents) == 0 &&
+			    ballStopped(snap.xVelocity, snap.yVelocity)) {
+				break;
+			}
+			SCRIPT_NEXT_TICK(s);
+		}
 
-      if (ledsOn[6]) {
-        LPC_GPIO2->FIOSET |= (1 << 5);
-      } else {
-        LPC_GPIO2->FIOCLR |= (1 << 5);
-      }
+		cfg.course = &gameCourse;
+		cfg.hole = snap.hole;
+		cfg.teleporter = snap.teleporter;
+		cfg.ballSize = BALL_GLCD_WIDTH;
+		cfg.holeSize = ENVIRONMENT_GLCD_WIDTH;
+		cfg.teleporterSize = ENVIRONMENT_GLCD_WIDTH;
+		cfg.maxStrokes = SOLVER_MAX_STROKES;
+		cfg.clock = osKernelGetTickCount;
+		cfg.budget = AI_SOLVE_BUDGET;
+
+		// Replanned before every shot, so a plan cut short by the budget still heads for the closest spot it
+		// found, or failing that makes the longest legal shot toward the hole
+		solveShots(&cfg, snap.ball, &plan);
+
+		// No legal shot at all from here (every one ends in water or a teleporter): keep waiting rather than
+		// playing one
+		if (plan.strokes == 0) {
+			continue;
+		}
 
-      if (ledsOn[7]) {
-        LPC_GPIO2->FIOSET |= (1 << 6);
-      } else {
-        LPC_GPIO2->FIOCLR |= (1 << 6);
-      }
-	  }
+		// Sent through the input threads' rings (those threads are not started in this build), so the
+		// shot is applied and recorded by inputScript like a player's
+		event.tick = osKernelGetTickCount();
+		event.type = INPUT_ANGLE;
+		event.value = plan.shots[0].angle;
+		spsc_push(&angleEvents, &event);
+
+		event.type = INPUT_POWER;
+		while (snap.power != plan.shots[0].power) {
+			event.value = (snap.power < plan.shots[0].power) ? 1 : -1;
+			spsc_push(&powerEvents, &event);
+			snap.power += event.value;
+		}
+
+		event.type = INPUT_HIT;
+		event.value = 0;
+		spsc_push(&buttonEvents, &event);
+	}
+
+	SCRIPT_END(s);
+}
+#endif
+
+// Cost meter of the frame budget
+static uint32_t frameSpiBytes(void) {
+	return GLCD_SpiBytes;
+}
+
+// Schedules the game sequences on the script thread. Called before the kernel is started.
+// The sprite moves (ball, teleport) always run; the HUD and the preview wait for a frame with room.
+void startGameScripts(void) {
+	setFrameBudget(frameSpiBytes, FRAME_BUDGET_BYTES, FRAME_BUDGET_US);
+
+	startScript(inputScript, NULL);
+	ballScriptSlot = startScript(ballScript, NULL);
+	teleportScriptSlot = startScript(teleportScript, NULL);
+	previewScriptSlot = startScript(previewScript, NULL);
+	setScriptCost(previewScriptSlot, previewCost());
+	hudScriptSlot = startScript(hudScript, NULL);
+	setScriptCost(hudScriptSlot, HUD_MAX_SPI_BYTES);
+	startScript(endGameScript, NULL);
+#ifdef AI_DEMO
+	aiScriptSlot = startScript(aiScript, NULL);
+#endif
+}
+
+
+// Erases the ball sprite at `pos`, putting back the background it covered
+void eraseBallAt(Pos pos) {
+	eraseSprite(pos, ballBitmap, BALL_GLCD_WIDTH);
+}
+
+
+// =============================
+// ======= Serial Output =======
+// =============================
+
+// -->> SERIAL OUTPUT <<--
+// SERVICE: runs every SCORE_PERIOD ticks on the timer thread
+// MUTEX: scoreMutex
+// PROTECTED DATA: golfScore
+void writeGolfScore(void) {
+	// Timer callbacks must not block, so skip this report if the score is being updated
+	if (osMutexAcquire(scoreMutex, 0) == osOK) {
+		printf("Golf Score: %d\n", golfScore);
+		osMutexRelease(scoreMutex);
+	}
 }
 
+// Registers the score report as a timer service. Called after the kernel is initialized.
+void startGameServices(void) {
+	scoreService = registerService("score", writeGolfScore, SCORE_PERIOD);
+	startServices();
+}
 
 
 // ===========================================
@@ -332,8 +675,7 @@ void updateLEDs(void *args) {
 
 
 //  -->> JOYSTICK <<--
-// MUTEX: ballMutex
-// PROTECTED DATA: golfBall->power
+// Sends power changes to inputScript, which applies them to golfBall->power
 void readPowerInput(void *args) {
   unsigned int lastStateP26;
   unsigned int currStateP26;
@@ -349,30 +691,23 @@ void readPowerInput(void *args) {
       // Joystick was pulled down, toward P.26 label and current state is not the same as previous state
       // State check is done to 
       if (currStateP26 && currStateP26 != lastStateP26) {
-        osMutexAcquire(ballMutex, osWaitForever);
-        if (golfBall->power > MIN_POWER) {
-		  osDelay(150);		// Delay changes power level so it is slow enough for user control. 150 is a nice value.
-          golfBall->power--;
-        }
-        osMutexRelease(ballMutex);
+        InputEvent event = { osKernelGetTickCount(), INPUT_POWER, -1 };
+        spsc_push(&powerEvents, &event);
+        osDelay(150);		// Delay changes power level so it is slow enough for user control. 150 is a nice value.
       }
 
       // Joytick was pushed up, toward P.24 label and current state is not the same as previous state
       else if (currStateP24 && currStateP24 != lastStateP24) {
-        osMutexAcquire(ballMutex, osWaitForever);
-        if (golfBall->power < MAX_POWER) {
-			osDelay(150);
-          golfBall->power++;
-        }
-        osMutexRelease(ballMutex);
+        InputEvent event = { osKernelGetTickCount(), INPUT_POWER, 1 };
+        spsc_push(&powerEvents, &event);
+        osDelay(150);
       }
   }
 }
 
 
 //  -->> POTENTIOMETER <<--
-// MUTEX: ballMutex
-// PROTECTED DATA: golfBall->direction
+// Sends angle changes to inputScript, which applies them to golfBall->direction
 void readDirectionInput(void *args) {
   while (1) {
     // Read current angle of potentiometer
@@ -389,17 +724,19 @@ void readDirectionInput(void *args) {
 
     // Update golfBall direction if potentiometer direction changes
     if (currAngle - prevPlayerDirection > 5) {  // add a hysteresis to prevent unwanted jitter 
-		osMutexAcquire(ballMutex, osWaitForever);
+		InputEvent event = { osKernelGetTickCount(), INPUT_ANGLE, currAngle };
 
-		golfBall -> direction = currAngle;
-		prevPlayerDirection = currAngle;
+		// Only remember the angle once it is queued, so a full ring is retried on the next reading
+		if (spsc_push(&angleEvents, &event)) {
+			prevPlayerDirection = currAngle;
+		}
 		//printf("%d\n", currAngle + MAP_CONVERSION_ANGLE);
-		osMutexRelease(ballMutex);
     } 
   }
 }
 
 // -->> PUSH BUTTON << --
+// Only polls the button; the shot itself is played by ballScript
 void hitBall(void *args) {
 	unsigned int lastButtonState;
 	unsigned int currButtonState;
@@ -408,26 +745,8 @@ void hitBall(void *args) {
 		currButtonState = !(LPC_GPIO2->FIOPIN & (1<<10));
 		
 		if (currButtonState && currButtonState != lastButtonState) {
-			// Increment the golf score every time the ball is hit
-			osMutexAcquire(scoreMutex, osWaitForever);
-			golfScore++;
-			osMutexRelease(scoreMutex);
-			
-			// Ball draw and logic ops
-			osMutexAcquire(ballMutex, osWaitForever);
-			// Erase the still ball by simply writing to all '1' locations in the bitmap with bg colour
-			GLCD_SetTextColor(Green);
-			drawSpriteAt(golfBall->pos.x, golfBall->pos.y, ballBitmap, BALL_GLCD_WIDTH);
-			
-			// Move the ball bitmap, i.e. animate the ball moving 
-			launchBall();
-			
-			// Once the ball has stopped, launchBall() will return. At this point, it is now safe to redraw the still ball.
-			// Draw the still ball.
-			GLCD_SetTextColor(White);
-			drawSpriteAt(golfBall->pos.x, golfBall->pos.y, ballBitmap, BALL_GLCD_WIDTH);
-			
-			osMutexRelease(ballMutex);
+			InputEvent event = { osKernelGetTickCount(), INPUT_HIT, 0 };
+			spsc_push(&buttonEvents, &event);
 		}
 		
 		lastButtonState = currButtonState;
@@ -439,125 +758,52 @@ void hitBall(void *args) {
 // ============== GAME  PHYSICS ==============
 // ===========================================
 
+// Sets the initial ball velocity from the current angle and power
+// MUTEX: ballMutex must be held by the caller
 void launchBall(void) {	
-	// Get angle, power, current position
-	double xPrevPos = golfBall->pos.x;
-	double yPrevPos = golfBall->pos.y;
-	
-	//printf("Before: %lf\n", golfBall->direction - MAP_CONVERSION_ANGLE);
-	double angle = convertAngle(golfBall->direction);
-	//printf("After: %lf\n", angle);
-	
-	uint32_t power = golfBall->power;
+	launchVelocity(golfBall->direction, golfBall->power, &golfBall->xVelocity, &golfBall->yVelocity);
 	
-	// Set initial ball velocity
-	golfBall->xVelocity = 2* power * cos(angle*2); // double the power to scale it to a velocity suitable for golf course size
-	golfBall->yVelocity = 2* power * sin(angle*2);
-	
-			
 	// printf("Vx: %d\n", golfBall->xVelocity);
 	// printf("Vy: %d\n", golfBall->yVelocity);
-	
-	while (abs(golfBall->xVelocity) != 0  && abs(golfBall->yVelocity) != 0) {
-		
-		//*** Erase the ball at the previous position ***//
-		GLCD_SetTextColor(Green);
-		drawSpriteAt(xPrevPos, yPrevPos, ballBitmap, 3);
-		
-		// Determine if the ball is out of bounds based on the min and max width and height of the LCD 
-		int xTemp = golfBall->pos.x + golfBall->xVelocity; 
-		int yTemp = golfBall->pos.y + golfBall->yVelocity;
-		
-		bool xLessMin = xTemp <= 0;
-		bool xMoreMax = xTemp >= LCD_WIDTH;
-		bool yLessMin = yTemp <= 0;
-		bool yMoreMax = yTemp >= LCD_HEIGHT;
-		
-		// x out of bounds
-		if (xLessMin || xMoreMax) {
-			golfBall->pos.x = (xLessMin) ? 0: LCD_WIDTH;
-		} else {
-			golfBall->pos.x = xTemp;
-		}
-		
-	 // printf("Vx: %d\n", golfBall->xVelocity);
-	  //printf("Vy: %d\n", golfBall->yVelocity);
-
-		// y out of bounds
-		if (yLessMin || yMoreMax) {
-			golfBall->pos.y = (yLessMin) ? 0 : LCD_HEIGHT;
-		} else {
-			golfBall->pos.y = yTemp;
-		}
-						
-		//*** Draw the ball at the current position ***//
-		GLCD_SetTextColor(White);
-		drawSpriteAt(golfBall->pos.x, golfBall->pos.y, ballBitmap, 3);
-		
-		
-		// Update the velocity at the new position
-		golfBall->xVelocity = (golfBall->xVelocity < 0) ? golfBall->xVelocity + ACCEL : golfBall->xVelocity - ACCEL;
-		golfBall->yVelocity = (golfBall->yVelocity < 0) ? golfBall->yVelocity + ACCEL : golfBall->yVelocity - ACCEL;
-				
-		// Change the direction of the current velocity based on the position of the ball
-		// Run bounce algorithm
-		if (xLessMin || xMoreMax) {
-			golfBall->xVelocity = golfBall->xVelocity * -1;
-		}
-		
-		if (yLessMin || yMoreMax) {
-			golfBall->yVelocity = golfBall->yVelocity * -1;
-		}
-		
-		// Set previous position as the current position for the next cycle
-		xPrevPos = golfBall->pos.x;
-		yPrevPos = golfBall->pos.y;
-	}
 }
 
-bool inHole(int sizeBall, int sizeHole) {
-	// Extract coordinates of the golfBall
-	int xTopBall = golfBall->pos.x;
-	int yTopBall = golfBall->pos.y;
+// Advances the ball by one physics step and redraws it. Returns false once the ball has stopped.
+// MUTEX: ballMutex
+bool stepBall(void) {
+	osMutexAcquire(ballMutex, osWaitForever);
 	
-	int xBotBall = golfBall->pos.x + SPRITE_COLS * SPRITE_SCALE;
-	int yBotBall = golfBall->pos.y + sizeBall * SPRITE_SCALE;
-
-	// Extract coordinates of the hole
-	int xTopHole = hole->pos.x;
-	int yTopHole = hole->pos.y;
+	if (ballStopped(golfBall->xVelocity, golfBall->yVelocity)) {
+		osMutexRelease(ballMutex);
+		return false;
+	}
 	
-	int xBotHole = hole->pos.x + SPRITE_COLS * SPRITE_SCALE;
-	int yBotHole = hole->pos.y + sizeHole * SPRITE_SCALE;
+	//*** Erase the ball at the previous position ***//
+	eraseBallAt(golfBall->pos);
+	
+	stepCourse(&gameCourse, &golfBall->pos, &golfBall->xVelocity, &golfBall->yVelocity);
+					
+	//*** Draw the ball at the current position ***//
+	GLCD_SetTextColor(White);
+	drawSpriteAt(golfBall->pos.x, golfBall->pos.y, ballBitmap, 3);
 	
-  // If this returns true, then the golfBall is in the hole
-	return (xTopBall < xBotHole && 
-          xBotBall > xTopHole &&
-          yTopBall < yBotHole &&
-          yBotBall > yTopHole);
+	publishSnapshot();
+	osMutexRelease(ballMutex);
+	return true;
 }
 
+// If this returns true, then the golfBall is in the hole
+bool inHole(int sizeBall, int sizeHole) {
+	return spritesOverlap(golfBall->pos, sizeBall, hole->pos, sizeHole);
+}
 
+// If this returns true, then the golfBall is in one of the course's teleporters
 bool inTeleporter(int sizeBall, int sizeTeleporter) {
-  // Extract coordinates of the golfBall
-	int xTopBall = golfBall->pos.x;
-	int yTopBall = golfBall->pos.y;
-	
-	int xBotBall = golfBall->pos.x + SPRITE_COLS * SPRITE_SCALE;
-	int yBotBall = golfBall->pos.y + sizeBall * SPRITE_SCALE;
-
-	// Extract coordinates of the teleporter
-	int xTopTeleporter = teleporter->pos.x;
-	int yTopTeleporter = teleporter->pos.y;
+	return courseTeleporterAt(&gameCourse, golfBall->pos, sizeBall, sizeTeleporter) >= 0;
+}
 
-	int xBotTeleporter = teleporter->pos.x + SPRITE_COLS * SPRITE_SCALE;
-	int yBotTeleporter = teleporter->pos.y + sizeTeleporter * SPRITE_SCALE;
-	
-  // If this returns true, then the golfBall is in the teleporter
-	return (xTopBall < xBotTeleporter && 
-          xBotBall > xTopTeleporter &&
-          yTopBall < yBotTeleporter &&
-          yBotBall > yTopTeleporter);
+// If this returns true, then the golfBall is in the water
+bool inHazard(void) {
+	return courseHazardAt(&gameCourse, golfBall->pos);
 }
 
 
@@ -569,12 +815,6 @@ bool inTeleporter(int sizeBall, int sizeTeleporter) {
 // ===========================================
 
 
-// Converts the angle (degrees) obtained from potentiometer into radians and positions it correctly w.r.t. map orientation
-double convertAngle(int32_t rawAngle) {
-    return (rawAngle + MAP_CONVERSION_ANGLE) * -M_PI / 180 ;
-}
-
-
 // Converts an array of binary values to its decimal value
 uint32_t convertBinaryArrayToDecimal(uint32_t *bits, uint32_t arraySize) {
   int result = 0;
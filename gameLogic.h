@@ -6,22 +6,27 @@
 #include <stdio.h>
 #include "GLCD.h"
 #include "spece.h"
+#include "physics.h"
+#include "script.h"
+#include "spsc_ring.h"
+#include "service.h"
+#include "leds.h"
+#include "preview.h"
+#include "trace.h"
+#include "rng.h"
+#include "course.h"
+#include "scene.h"
+#include "hud.h"
+#include "blit.h"
 #include <cmsis_os2.h>
 #include <os_tick.h>
 
-// Struct to store the (x, y) coordinates of in-game sprites
-typedef struct { 
-  int x;
-  int y;
-} Pos;
-
 // Struct for the Ball sprite
 typedef struct {
 	Pos pos;
-	Pos arrowPos[2];
 	char *bitmap;
 	
-	int xVelocity;
+	int xVelocity;    // in 1/VELOCITY_ONE pixels per step
 	int yVelocity;
 	
 	double direction;
@@ -29,6 +34,19 @@ typedef struct {
 	
 } Ball;
 
+// Input events passed from the input threads to the game scripts (same values as the trace records)
+typedef enum {
+	INPUT_HIT = TRACE_HIT,
+	INPUT_POWER = TRACE_POWER,   // value: +1 / -1
+	INPUT_ANGLE = TRACE_ANGLE    // value: raw pot angle
+} InputType;
+
+typedef struct {
+	uint32_t tick;
+	uint8_t type;
+	int16_t value;
+} InputEvent;
+
 // Struct to store environment objects, i.e. the Hole and the Teleporter
 typedef struct {
 	Pos pos;
@@ -36,9 +54,15 @@ typedef struct {
 	
 } Environment;
 
-//***** LEDs and Power Mechanism *****//
-void initLEDs(void);
-void updateLEDs(void *args);
+// The course being played, parsed from flash by setupGame
+extern Course gameCourse;
+
+// Title, win and lose screens (screenData.c, made from screens/ by tools/imagec)
+extern const RleImage titleImage;
+extern const RleImage winImage;
+extern const RleImage loseImage;
+
+//***** Power Mechanism (LEDs are driven by leds.c) *****//
 void readPowerInput(void *args);
 
 //***** POTENTIOMETER and Angle Mechanism *****//
@@ -48,19 +72,33 @@ void readDirectionInput(void *args);
 //***** PUSHBUTTON, Ball Control, and In-Game Functionality *****//	
 void hitBall(void *args);
 void launchBall(void);
-void teleportBall(void *args);
+bool stepBall(void);
 bool inTeleporter(int sizeBall, int sizeTeleporter);
+bool inHazard(void);
+
+//***** GAME SCRIPTS (run on the script thread) *****//
+void applyInput(uint8_t type, int32_t value);
+void playInput(uint8_t type, int32_t value);
+bool inputScript(Script *s);
+bool ballScript(Script *s);
+bool teleportScript(Script *s);
+bool endGameScript(Script *s);
+bool previewScript(Script *s);
+bool hudScript(Script *s);
+#ifdef AI_DEMO
+bool aiScript(Script *s);
+#endif
+void startGameScripts(void);
 
 //***** SETUP, LOSE AND WIN CONDITION *****//
+void seedGame(uint32_t seed);
 void setupGame(void);
-void writeGolfScore(void *args);
-void checkEndGame(void *args);
+void writeGolfScore(void);
+void startGameServices(void);
 bool inHole(int ball_size, int hole_size);
 
-//***** DRAWING and HELPER FUNCTIONS *****//
-void drawPixelsAt(int x, int y, int limit);
-void drawSpriteAt(int x, int y, char *bitmap, int bitmap_size);
-double convertAngle(int32_t rawAngle);
+//***** DRAWING and HELPER FUNCTIONS (drawing primitives are in blit.h) *****//
+void eraseBallAt(Pos pos);
 uint32_t convertBinaryArrayToDecimal(uint32_t *bits, uint32_t arraySize);
 
 #endif
@@ -0,0 +1,97 @@
+#include "hud.h"
+#include "gameLogic.h"
+
+#include <string.h>
+
+// Colours of the strip
+#define HUD_TEXT White
+#define HUD_BACK Black
+#define HUD_BAR Yellow
+
+// The driver's 6 x 8 font: pixel i of a row is bit i, rows run top down
+extern const unsigned char Font_6x8_h[];
+
+// What is on the screen: the text (spaces under the bar) and the filled bar columns
+static char shownText[HUD_COLS + 1];
+static int shownBar;
+static bool shownValid = false;
+
+uint32_t hudPixelWrites = 0;
+uint32_t hudMaxUpdatePixels = 0;
+
+
+// Draws the columns of the bar between two levels: filled when it grows, background when it shrinks
+static uint32_t drawBarDelta(int from, int to) {
+	int lo = (from < to) ? from : to;
+	int hi = (from < to) ? to : from;
+
+	if (lo == hi) {
+		return 0;
+	}
+	GLCD_SetTextColor(HUD_BAR);
+	GLCD_SetBackColor(HUD_BACK);
+	GLCD_Bargraph(HUD_BAR_X + lo, HUD_BAR_Y, hi - lo, HUD_BAR_H, (to > from) ? 1024 : 0);
+	return (hi - lo) * HUD_BAR_H;
+}
+
+// Brings the strip in line with the game and returns the pixels that took. The first call draws it all.
+// MUTEX: ballMutex must be held by the caller (it owns the LCD)
+uint32_t hudUpdate(int strokes, uint32_t power, int32_t angle) {
+	char text[HUD_COLS + 1];
+	int bar;
+	uint32_t pixels = 0;
+
+	if (strokes < 0) strokes = 0;
+	if (strokes > 99) strokes = 99;
+	snprintf(text, sizeof(text), "S%02d%*sA%03d", strokes, HUD_COLS - 7, "", shotHeadingDegrees(angle));
+	bar = (power - SHOT_MIN_POWER) * HUD_BAR_W / (SHOT_MAX_POWER - SHOT_MIN_POWER);
+
+	GLCD_SetTextColor(HUD_TEXT);
+	GLCD_SetBackColor(HUD_BACK);
+	if (!shownValid) {
+		GLCD_DisplayString(0, 0, 0, (unsigned char *)text);
+		pixels = HUD_WIDTH * HUD_HEIGHT;
+		shownBar = 0;
+	} else {
+		// Only the characters that differ; the ones under the bar are always spaces
+		for (int col = 0; col < HUD_COLS; ++col) {
+			if (text[col] != shownText[col]) {
+				GLCD_DisplayChar(0, col, 0, text[col]);
+				pixels += HUD_CHAR_W * HUD_CHAR_H;
+			}
+		}
+	}
+	memcpy(shownText, text, sizeof(text));
+
+	pixels += drawBarDelta(shownBar, bar);
+	shownBar = bar;
+
+	if (shownValid && pixels > hudMaxUpdatePixels) {
+		hudMaxUpdatePixels = pixels;
+	}
+	shownValid = true;
+	hudPixelWrites += pixels;
+	return pixels;
+}
+
+// Colour of the strip at a screen pixel, if the pixel is in the strip and it has been drawn
+bool hudPixelAt(int x, int y, unsigned short *colour) {
+	unsigned int c;
+
+	if (!shownValid || x < 0 || y < 0 || x >= HUD_WIDTH || y >= HUD_HEIGHT) {
+		return false;
+	}
+
+	if (x >= HUD_BAR_X && x < HUD_BAR_X + HUD_BAR_W && y >= HUD_BAR_Y && y < HUD_BAR_Y + HUD_BAR_H) {
+		*colour = (x - HUD_BAR_X < shownBar) ? HUD_BAR : HUD_BACK;
+	} else {
+		c = (unsigned char)shownText[x / HUD_CHAR_W] - 32;
+		*colour = ((Font_6x8_h[c * HUD_CHAR_H + y] >> (x % HUD_CHAR_W)) & 1) ? HUD_TEXT : HUD_BACK;
+	}
+	return true;
+}
+
+// True if a w x h box at pos overlaps the strip
+bool hudCovers(Pos pos, int w, int h) {
+	return pos.x < HUD_WIDTH && pos.x + w > 0 && pos.y < HUD_HEIGHT && pos.y + h > 0;
+}
@@ -0,0 +1,40 @@
+#ifndef GAME_HUD
+#define GAME_HUD
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "physics.h"
+
+// On-screen HUD: a strip in the top left corner with the strokes, a power bar and the aim angle, in the
+// 6 x 8 font. It is drawn in full once; after that an update only redraws the characters that changed and
+// the bar columns between the old and the new power, filled like GLCD_Bargraph fills them. So an update
+// never costs more than HUD_MAX_PIXELS pixels.
+// The strip is the top of the background layer (scene.c): a sprite moving over it puts it back when erased.
+
+#define HUD_CHAR_W 6
+#define HUD_CHAR_H 8
+#define HUD_COLS 17                             // "S12 [power bar] A135"
+
+#define HUD_BAR_X (4 * HUD_CHAR_W)             // columns 4 to 11
+#define HUD_BAR_Y 1
+#define HUD_BAR_W (8 * HUD_CHAR_W)
+#define HUD_BAR_H (HUD_CHAR_H - 2)
+
+#define HUD_WIDTH (HUD_COLS * HUD_CHAR_W)
+#define HUD_HEIGHT HUD_CHAR_H
+
+// Two stroke digits, three angle digits and the whole bar
+#define HUD_MAX_PIXELS (5 * HUD_CHAR_W * HUD_CHAR_H + HUD_BAR_W * HUD_BAR_H)
+
+// The same update in LCD SPI bytes: two per pixel, plus setting up a window for each character and the bar
+#define HUD_MAX_SPI_BYTES (HUD_MAX_PIXELS * 2 + 6 * 40)
+
+uint32_t hudUpdate(int strokes, uint32_t power, int32_t angle);
+bool hudPixelAt(int x, int y, unsigned short *colour);
+bool hudCovers(Pos pos, int w, int h);
+
+// Pixels the HUD has written since startup, and the most written by one update after the first
+extern uint32_t hudPixelWrites;
+extern uint32_t hudMaxUpdatePixels;
+
+#endif
@@ -0,0 +1,175 @@
+#include "leds.h"
+
+#include <lpc17xx.h>
+
+#define GPIO1_LED_MASK ((1UL << 28) | (1UL << 29) | (1UL << 31))
+#define GPIO2_LED_MASK (0x1FUL << 2)
+
+typedef struct {
+	uint32_t gpio1Set;
+	uint32_t gpio1Clr;
+	uint32_t gpio2Set;
+	uint32_t gpio2Clr;
+} LedMasks;
+
+// Port masks for every level, so a level change is one FIOSET and one FIOCLR store per port
+#define LEVEL(set1, set2) { (set1), GPIO1_LED_MASK & ~(set1), (set2), GPIO2_LED_MASK & ~(set2) }
+
+static const LedMasks ledLevels[NUM_LEDS + 1] = {
+	LEVEL(0,                           0),
+	LEVEL(1UL << 28,                   0),
+	LEVEL((1UL << 28) | (1UL << 29),   0),
+	LEVEL(GPIO1_LED_MASK,              0),
+	LEVEL(GPIO1_LED_MASK,              0x01UL << 2),
+	LEVEL(GPIO1_LED_MASK,              0x03UL << 2),
+	LEVEL(GPIO1_LED_MASK,              0x07UL << 2),
+	LEVEL(GPIO1_LED_MASK,              0x0FUL << 2),
+	LEVEL(GPIO1_LED_MASK,              0x1FUL << 2),
+};
+
+// Pin of each LED, used to add the one partially lit LED on top of a full level
+static const uint32_t ledPin1[NUM_LEDS] = { 1UL << 28, 1UL << 29, 1UL << 31, 0, 0, 0, 0, 0 };
+static const uint32_t ledPin2[NUM_LEDS] = { 0, 0, 0, 1UL << 2, 1UL << 3, 1UL << 4, 1UL << 5, 1UL << 6 };
+
+//==============================
+//===== BIT-ANGLE DIMMING ======
+//==============================
+
+// None of P1.28/29/31 or P2.6 is a PWM1 output, so brightness uses binary code modulation from TIMER1 instead.
+// A refresh cycle is LED_PLANES bit planes; plane k lasts (1 << k) units and shows the LEDs whose brightness
+// has bit k set. The ISR only writes the precomputed masks of the next plane, and the timer is switched off
+// whenever every LED is fully on or off, so a steady whole level costs no CPU at all.
+
+#define LED_PLANES 4                     // 16 brightness steps per LED, see LED_STEPS
+#define LED_UNIT_US 64                   // shortest plane; full cycle is 15 units (~1 ms)
+
+static LedMasks planes[LED_PLANES];      // owned by the ISR while the timer runs
+static uint32_t plane = 0;
+static uint32_t unitTicks;
+
+static volatile uint32_t currentBrightness = 0;  // in 1/LED_STEPS of an LED
+static volatile uint32_t targetBrightness = 0;
+
+volatile uint32_t ledRegisterWrites = 0;
+
+
+static void writeMasks(const LedMasks *masks) {
+	// FIOSET/FIOCLR only act on the bits written as 1, so plain stores are enough (no read-modify-write)
+	LPC_GPIO1->FIOSET = masks->gpio1Set;
+	LPC_GPIO1->FIOCLR = masks->gpio1Clr;
+	LPC_GPIO2->FIOSET = masks->gpio2Set;
+	LPC_GPIO2->FIOCLR = masks->gpio2Clr;
+
+	ledRegisterWrites += 4;
+}
+
+// Builds the plane masks for a brightness: all full LEDs in every plane, plus the partial LED in the planes
+// matching the bits of its fraction
+static void buildPlanes(uint32_t brightness) {
+	uint32_t full = brightness / LED_STEPS;
+	uint32_t fraction = brightness % LED_STEPS;
+
+	for (int k = 0; k < LED_PLANES; ++k) {
+		uint32_t set1 = ledLevels[full].gpio1Set;
+		uint32_t set2 = ledLevels[full].gpio2Set;
+
+		if (full < NUM_LEDS && ((fraction >> k) & 1)) {
+			set1 |= ledPin1[full];
+			set2 |= ledPin2[full];
+		}
+
+		planes[k].gpio1Set = set1;
+		planes[k].gpio1Clr = GPIO1_LED_MASK & ~set1;
+		planes[k].gpio2Set = set2;
+		planes[k].gpio2Clr = GPIO2_LED_MASK & ~set2;
+	}
+}
+
+static void stopTimer(void) {
+	LPC_TIM1->TCR = 0;
+	LPC_TIM1->IR = 1;
+}
+
+static void startTimer(void) {
+	plane = LED_PLANES - 1;              // first interrupt starts a fresh cycle at plane 0
+	LPC_TIM1->TCR = 2;                   // reset counter
+	LPC_TIM1->MR0 = unitTicks;
+	LPC_TIM1->TCR = 1;
+}
+
+// Ends a refresh cycle: step the animation by one brightness step and decide whether dimming is still needed
+static void endCycle(void) {
+	uint32_t current = currentBrightness;
+	uint32_t target = targetBrightness;
+
+	if (current < target) {
+		current++;
+	} else if (current > target) {
+		current--;
+	}
+	currentBrightness = current;
+
+	if (current == target && current % LED_STEPS == 0) {
+		stopTimer();
+		writeMasks(&ledLevels[current / LED_STEPS]);
+	} else {
+		buildPlanes(current);
+	}
+}
+
+void TIMER1_IRQHandler(void) {
+	LPC_TIM1->IR = 1;                    // clear MR0 interrupt
+
+	plane = (plane + 1) % LED_PLANES;
+	if (plane == 0) {
+		endCycle();
+		if (LPC_TIM1->TCR == 0) {
+			return;
+		}
+	}
+
+	writeMasks(&planes[plane]);
+	LPC_TIM1->MR0 += unitTicks << plane;
+}
+
+
+// Initialize the LED pin directions (set as outputs), turn them all off and set up TIMER1 for dimming
+void initLEDs(void) {
+	LPC_GPIO1->FIODIR |= GPIO1_LED_MASK;
+	LPC_GPIO2->FIODIR |= GPIO2_LED_MASK;
+
+	// Power on TIMER1, PCLK = CCLK / 4 by default
+	LPC_SC->PCONP |= 1 << 2;
+	unitTicks = (SystemCoreClock / 4 / 1000000) * LED_UNIT_US;
+
+	stopTimer();
+	LPC_TIM1->PR = 0;
+	LPC_TIM1->MCR = 1;                   // interrupt on MR0, keep counting
+	NVIC_EnableIRQ(TIMER1_IRQn);
+
+	currentBrightness = 0;
+	targetBrightness = 0;
+	writeMasks(&ledLevels[0]);
+}
+
+// Fades the meter towards `brightness` (in 1/LED_STEPS of an LED) by one step per refresh cycle.
+// Values that are not whole LEDs stay dimmed for as long as they are set.
+void setLEDBrightness(uint32_t brightness) {
+	if (brightness > NUM_LEDS * LED_STEPS) {
+		brightness = NUM_LEDS * LED_STEPS;
+	}
+
+	// Mask the timer IRQ so the ISR cannot switch itself off between the target update and the check
+	NVIC_DisableIRQ(TIMER1_IRQn);
+	targetBrightness = brightness;
+	if (LPC_TIM1->TCR == 0 && currentBrightness != brightness) {
+		buildPlanes(currentBrightness);
+		startTimer();
+	}
+	NVIC_EnableIRQ(TIMER1_IRQn);
+}
+
+// Lights the first `level` LEDs, animating from the current level
+void setLEDLevel(uint32_t level) {
+	setLEDBrightness(level * LED_STEPS);
+}
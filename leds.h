@@ -0,0 +1,20 @@
+#ifndef LED_BANK
+#define LED_BANK
+
+#include <stdint.h>
+
+// The eight power LEDs: P1.28, P1.29, P1.31 on GPIO1 and P2.2 - P2.6 on GPIO2, left to right
+#define NUM_LEDS 8
+
+// Brightness steps per LED for dimming; brightness values are in 1/LED_STEPS of an LED
+#define LED_STEPS 16
+
+void initLEDs(void);
+void setLEDLevel(uint32_t level);
+void setLEDBrightness(uint32_t brightness);
+void TIMER1_IRQHandler(void);
+
+// Number of GPIO register stores made by the LED driver
+extern volatile uint32_t ledRegisterWrites;
+
+#endif
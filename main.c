@@ -4,7 +4,50 @@ osMutexId_t ballMutex;
 osMutexId_t scoreMutex;
 
 osThreadId_t hitBallID;
-osThreadId_t writeScoreID;
+
+// Collects a seed from the least significant bit of repeated pot readings (ADC noise)
+static uint32_t adcNoiseSeed(void) {
+	uint32_t seed = 0;
+
+	for (int i = 0; i < 32; ++i) {
+		LPC_ADC->ADCR |= 1<<24;
+		while (!(LPC_ADC->ADGDR & (1<<31)));
+		seed = (seed << 1) | ((LPC_ADC->ADGDR >> 4) & 1);
+	}
+
+	return seed;
+}
+
+// Inputs that take the title down: the joystick (P1.20, P1.23-26) and the push button (P2.10), all active low
+#define TITLE_JOYSTICK_PINS ((1 << 20) | (0xF << 23))
+#define TITLE_BUTTON_PINS (1 << 10)
+
+// Longest the title stays up without an input (ms)
+#define TITLE_MS 3000
+
+static bool titleInputHeld(void) {
+	return (~LPC_GPIO1->FIOPIN & TITLE_JOYSTICK_PINS) || (~LPC_GPIO2->FIOPIN & TITLE_BUTTON_PINS);
+}
+
+// Keeps the title up until the first joystick or button input, or for TITLE_MS, then waits (as long again at most)
+// for that input to be released so it does not also play. The kernel is not running yet, so SysTick is polled for
+// milliseconds with its interrupt off, and left stopped for RTX to set up.
+static void showTitle(void) {
+	uint32_t ms;
+
+	SysTick->LOAD = SystemCoreClock / 1000 - 1;
+	SysTick->VAL = 0;
+	SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_ENABLE_Msk;
+
+	for (ms = 0; ms < TITLE_MS && !titleInputHeld(); ) {
+		ms += (SysTick->CTRL & SysTick_CTRL_COUNTFLAG_Msk) ? 1 : 0;
+	}
+	for (ms = 0; ms < TITLE_MS && titleInputHeld(); ) {
+		ms += (SysTick->CTRL & SysTick_CTRL_COUNTFLAG_Msk) ? 1 : 0;
+	}
+
+	SysTick->CTRL = 0;
+}
 
 int main()
 {
@@ -14,10 +57,9 @@ int main()
 	// Configure the LEDs as outputs
 	initLEDs();
 
-	// Initialize the GLCD
+	// Initialize the GLCD, with the title screen up while the game is set up and until the player is ready
 	GLCD_Init();
-	GLCD_Clear(Green);
-	GLCD_SetTextColor(Green);
+	drawRleImage(0, 0, &titleImage);
 	
 	// Setting up and enabling the ADC
 	LPC_PINCON->PINSEL1 &= ~(1<<18);
@@ -34,19 +76,42 @@ int main()
 	ballMutex = osMutexNew(NULL);
 	scoreMutex = osMutexNew(NULL);
 	
-	// Set up the Actors (Hole and Ball)
+	// Seed the game, recording the seed or taking it from the trace being replayed
+#if defined(TRACE_REPLAY) || defined(TRACE_REPLAY_FAST)
+	seedGame(traceStart(TRACE_REPLAYING, 0));
+#elif defined(TRACE_RECORD)
+	seedGame(traceStart(TRACE_RECORDING, adcNoiseSeed()));
+#else
+	seedGame(traceStart(TRACE_OFF, adcNoiseSeed()));
+#endif
+
+#ifdef TRACE_REPLAY_FAST
+	setScriptFastForward(true);
+#endif
+
+	// Leave the title up until the player is ready
+	showTitle();
+
+	// Set up the Actors (Hole and Ball) on the course, drawn over the fairway colour
+	GLCD_Clear(Green);
+	GLCD_SetTextColor(Green);
 	setupGame();
+	
+	// Ball flight, teleporter and end of game all run as scripts on a single thread
+	startGameScripts();
 
 	osKernelInitialize();
 	
-	// Create the threads
+	// Score output is periodic, so it runs on a timer rather than its own thread
+	startGameServices();
+	
+	// Create the threads (only for work that blocks or polls)
+#ifndef AI_DEMO
 	osThreadNew(readPowerInput, NULL, NULL);
-	osThreadNew(updateLEDs, NULL, NULL);
 	osThreadNew(readDirectionInput, NULL, NULL);
 	hitBallID = osThreadNew(hitBall, NULL, NULL); 
-	osThreadNew(checkEndGame, NULL, NULL);
-	osThreadNew(teleportBall, NULL, NULL);
-	osThreadNew(writeGolfScore, NULL, NULL);
+#endif
+	osThreadNew(runScripts, NULL, NULL);
 	
 	osKernelStart();
 
@@ -0,0 +1,127 @@
+#include "physics.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+// Define PI as M_PI 
+# ifndef M_PI
+# define M_PI 3.14159265358979323846
+# endif
+
+// Used to convert raw pot value to in-game angle. Note: 90 degrees means straight up; -95 - 90 = -185
+const int MAP_CONVERSION_ANGLE = -185; 
+
+
+// Converts the angle (degrees) obtained from potentiometer into radians and positions it correctly w.r.t. map orientation
+double convertAngle(int32_t rawAngle) {
+    return (rawAngle + MAP_CONVERSION_ANGLE) * -M_PI / 180 ;
+}
+
+// Direction (radians, screen axes: y grows down) the ball leaves in for a raw pot angle. The pot's half turn
+// covers the full circle, so the heading is twice the converted angle
+double shotHeading(int32_t rawAngle) {
+	return convertAngle(rawAngle) * 2;
+}
+
+// Radians to whole degrees, 0 to 359
+static int wholeDegrees(double radians) {
+	int degrees = (int)lround(radians * 180 / M_PI) % 360;
+
+	return (degrees < 0) ? degrees + 360 : degrees;
+}
+
+// The same heading in whole degrees, 0 to 359, as the HUD shows it
+int shotHeadingDegrees(int32_t rawAngle) {
+	return wholeDegrees(shotHeading(rawAngle));
+}
+
+// Direction from one spot to another in whole degrees, on the same axes as shotHeadingDegrees
+int directionDegrees(Pos from, Pos to) {
+	return wholeDegrees(atan2(to.y - from.y, to.x - from.x));
+}
+
+// Initial ball velocity (in 1/VELOCITY_ONE pixels per step) for a shot at the given raw pot angle and power
+void launchVelocity(int32_t rawAngle, uint32_t power, int *xVelocity, int *yVelocity) {
+	double heading = shotHeading(rawAngle);
+
+	*xVelocity = 2* power * cos(heading) * VELOCITY_ONE; // double the power to scale it to a velocity suitable for golf course size
+	*yVelocity = 2* power * sin(heading) * VELOCITY_ONE;
+}
+
+// The ball stops once friction has slowed it below a pixel per step on both axes (or its velocity was zeroed)
+bool ballStopped(int xVelocity, int yVelocity) {
+	return abs(xVelocity) < STOP_SPEED && abs(yVelocity) < STOP_SPEED;
+}
+
+// Pixels moved in one step at this velocity, rounded to nearest, the same way for both directions
+int velocityPixels(int velocity) {
+	int pixels = (abs(velocity) + VELOCITY_ONE / 2) >> VELOCITY_SHIFT;
+	return (velocity < 0) ? -pixels : pixels;
+}
+
+// One step of friction on a velocity component; works on the magnitude so both directions slow down alike
+int applyFriction(int velocity, uint32_t friction) {
+	int speed = abs(velocity);
+
+	speed -= (int)(((uint32_t)speed * friction) >> FRICTION_SHIFT);
+	return (velocity < 0) ? -speed : speed;
+}
+
+// Moves the ball by one step, bounces it off the course edges and applies the friction of the ground it rolled on
+void stepPhysicsFriction(Pos *pos, int *xVelocity, int *yVelocity, uint32_t friction) {
+	// Determine if the ball is out of bounds based on the min and max width and height of the LCD 
+	int xTemp = pos->x + velocityPixels(*xVelocity); 
+	int yTemp = pos->y + velocityPixels(*yVelocity);
+	
+	bool xLessMin = xTemp <= 0;
+	bool xMoreMax = xTemp >= COURSE_WIDTH;
+	bool yLessMin = yTemp <= 0;
+	bool yMoreMax = yTemp >= COURSE_HEIGHT;
+	
+	// x out of bounds
+	if (xLessMin || xMoreMax) {
+		pos->x = (xLessMin) ? 0: COURSE_WIDTH;
+	} else {
+		pos->x = xTemp;
+	}
+
+	// y out of bounds
+	if (yLessMin || yMoreMax) {
+		pos->y = (yLessMin) ? 0 : COURSE_HEIGHT;
+	} else {
+		pos->y = yTemp;
+	}
+	
+	// Slow the ball down along its direction of travel
+	*xVelocity = applyFriction(*xVelocity, friction);
+	*yVelocity = applyFriction(*yVelocity, friction);
+			
+	// Change the direction of the current velocity based on the position of the ball
+	// Run bounce algorithm
+	if (xLessMin || xMoreMax) {
+		*xVelocity = *xVelocity * -1;
+	}
+	
+	if (yLessMin || yMoreMax) {
+		*yVelocity = *yVelocity * -1;
+	}
+}
+
+// One step on the fairway, i.e. the open field
+void stepPhysics(Pos *pos, int *xVelocity, int *yVelocity) {
+	stepPhysicsFriction(pos, xVelocity, yVelocity, FRICTION_FAIRWAY);
+}
+
+// Axis-aligned overlap test between two sprites given their top corners and bitmap sizes
+bool spritesOverlap(Pos a, int sizeA, Pos b, int sizeB) {
+	int xBotA = a.x + SPRITE_COLS * SPRITE_SCALE;
+	int yBotA = a.y + sizeA * SPRITE_SCALE;
+
+	int xBotB = b.x + SPRITE_COLS * SPRITE_SCALE;
+	int yBotB = b.y + sizeB * SPRITE_SCALE;
+
+	return (a.x < xBotB && 
+          xBotA > b.x &&
+          a.y < yBotB &&
+          yBotA > b.y);
+}
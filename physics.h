@@ -0,0 +1,51 @@
+#ifndef GAME_PHYSICS
+#define GAME_PHYSICS
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "spece.h"
+
+// Ball physics shared by the game and the host tools (tools/). Nothing in here touches the hardware or the RTOS.
+
+// Course size, the same as the LCD in landscape
+#define COURSE_WIDTH 320   // x-axis
+#define COURSE_HEIGHT 240  // y-axis
+
+// Shot grid: the pot reads 0..341 (4095 / 12) and the joystick sets the power
+#define SHOT_NUM_ANGLES 342
+#define SHOT_MIN_POWER 2
+#define SHOT_MAX_POWER 8
+
+// Velocities are in 1/VELOCITY_ONE pixels per step, so friction can take fractions of a pixel off them.
+// Positions stay in whole pixels; each step moves the ball by its velocity rounded to the nearest pixel.
+#define VELOCITY_SHIFT 8
+#define VELOCITY_ONE (1 << VELOCITY_SHIFT)
+
+// Friction is the fraction of the speed lost per step, in 1/FRICTION_ONE. Both components lose the same
+// fraction, so it acts along the velocity vector and never bends the path.
+#define FRICTION_SHIFT 16
+#define FRICTION_ONE (1 << FRICTION_SHIFT)
+#define FRICTION_FAIRWAY 7864      // 12 %: a full-power shot rolls about 130 pixels
+
+// Below this on both axes the ball would no longer move a pixel per step, so it has stopped
+#define STOP_SPEED (VELOCITY_ONE / 2)
+
+// Struct to store the (x, y) coordinates of in-game sprites
+typedef struct { 
+  int x;
+  int y;
+} Pos;
+
+double convertAngle(int32_t rawAngle);
+double shotHeading(int32_t rawAngle);
+int shotHeadingDegrees(int32_t rawAngle);
+void launchVelocity(int32_t rawAngle, uint32_t power, int *xVelocity, int *yVelocity);
+int directionDegrees(Pos from, Pos to);
+bool ballStopped(int xVelocity, int yVelocity);
+int velocityPixels(int velocity);
+int applyFriction(int velocity, uint32_t friction);
+void stepPhysicsFriction(Pos *pos, int *xVelocity, int *yVelocity, uint32_t friction);
+void stepPhysics(Pos *pos, int *xVelocity, int *yVelocity);
+bool spritesOverlap(Pos a, int sizeA, Pos b, int sizeB);
+
+#endif
@@ -0,0 +1,127 @@
+#include "preview.h"
+#include "gameLogic.h"
+
+// Dots currently on screen and the inputs they were computed from
+static Pos shownDots[PREVIEW_MAX_DOTS];
+static int shownCount = 0;
+
+static bool shownValid = false;
+static Pos shownBall;
+static int32_t shownAngle;
+static uint32_t shownPower;
+static int shownLimit;
+
+uint32_t previewDotWrites = 0;
+
+
+// True if the dot would land on a sprite; those dots are left out so erasing them never damages the sprite
+static bool dotOnSprite(Pos dot, Pos sprite, int spriteSize) {
+	return dot.x + PREVIEW_DOT_SIZE > sprite.x && dot.x < sprite.x + spriteSize * SPRITE_SCALE &&
+	       dot.y + PREVIEW_DOT_SIZE > sprite.y && dot.y < sprite.y + SPRITE_COLS * SPRITE_SCALE;
+}
+
+static bool containsDot(const Pos *dots, int count, Pos dot) {
+	for (int i = 0; i < count; ++i) {
+		if (dots[i].x == dot.x && dots[i].y == dot.y) {
+			return true;
+		}
+	}
+	return false;
+}
+
+// Puts back the background under a dot
+static void eraseDot(Pos dot) {
+	restoreBackground(dot.x, dot.y, PREVIEW_DOT_SIZE, PREVIEW_DOT_SIZE);
+	previewDotWrites++;
+}
+
+// Dots the preview shows at the current frame quality: all of them down to a quarter when frames run over budget
+int previewDotLimit(void) {
+	return PREVIEW_MAX_DOTS * frameQuality() / FRAME_QUALITY_MAX;
+}
+
+// Most an update can cost at the current frame quality: every dot shown erased and every new one drawn
+uint32_t previewCost(void) {
+	return 2 * previewDotLimit() * PREVIEW_DOT_SPI_BYTES;
+}
+
+// Runs the game physics (with the course walls) from `ball` and keeps one dot per step, at the centre of the
+// ball bitmap, up to `limit` dots
+static int tracePath(Pos ball, int32_t angle, uint32_t power, Pos hole, int spriteSize, Pos *dots, int limit) {
+	int vx, vy, count = 0, bounces = 0;
+	Pos pos = ball;
+
+	launchVelocity(angle, power, &vx, &vy);
+	while (!ballStopped(vx, vy) && count < limit) {
+		int prevVx = vx, prevVy = vy;
+
+		stepCourse(&gameCourse, &pos, &vx, &vy);
+
+		// A bounce flips the sign of one velocity component (slowing down never crosses zero)
+		if ((prevVx > 0 && vx < 0) || (prevVx < 0 && vx > 0) || (prevVy > 0 && vy < 0) || (prevVy < 0 && vy > 0)) {
+			if (++bounces > PREVIEW_BOUNCES) {
+				break;
+			}
+		}
+
+		Pos dot = { pos.x + spriteSize * SPRITE_SCALE / 2, pos.y + SPRITE_COLS * SPRITE_SCALE / 2 };
+		if (dotOnSprite(dot, ball, spriteSize) || dotOnSprite(dot, hole, spriteSize) || containsDot(dots, count, dot) ||
+		    hudCovers(dot, PREVIEW_DOT_SIZE, PREVIEW_DOT_SIZE)) {
+			continue;
+		}
+		dots[count++] = dot;
+	}
+
+	return count;
+}
+
+// Recomputes the preview if the ball, angle, power or frame quality changed and patches the LCD with the difference.
+// Returns true if anything was recomputed.
+// MUTEX: ballMutex must be held by the caller (it owns the LCD)
+bool updatePreview(Pos ball, int32_t angle, uint32_t power, Pos hole, int spriteSize) {
+	Pos dots[PREVIEW_MAX_DOTS];
+	int limit = previewDotLimit();
+	int count;
+
+	if (shownValid && angle == shownAngle && power == shownPower && ball.x == shownBall.x && ball.y == shownBall.y &&
+	    limit == shownLimit) {
+		return false;
+	}
+
+	count = tracePath(ball, angle, power, hole, spriteSize, dots, limit);
+
+	// Erase the dots that moved, then draw the new ones
+	for (int i = 0; i < shownCount; ++i) {
+		if (!containsDot(dots, count, shownDots[i])) {
+			eraseDot(shownDots[i]);
+		}
+	}
+
+	GLCD_SetTextColor(Yellow);
+	for (int i = 0; i < count; ++i) {
+		if (!containsDot(shownDots, shownCount, dots[i])) {
+			drawPixelsAt(dots[i].x, dots[i].y, PREVIEW_DOT_SIZE);
+			previewDotWrites++;
+		}
+		shownDots[i] = dots[i];
+	}
+
+	shownCount = count;
+	shownBall = ball;
+	shownAngle = angle;
+	shownPower = power;
+	shownLimit = limit;
+	shownValid = true;
+	return true;
+}
+
+// Erases the whole preview, e.g. right before the ball is launched over it
+// MUTEX: ballMutex must be held by the caller
+void clearPreview(void) {
+	for (int i = 0; i < shownCount; ++i) {
+		eraseDot(shownDots[i]);
+	}
+
+	shownCount = 0;
+	shownValid = false;
+}
@@ -0,0 +1,27 @@
+#ifndef AIM_PREVIEW
+#define AIM_PREVIEW
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "physics.h"
+
+// Dotted overlay of the path the ball would take if it were hit now, up to PREVIEW_BOUNCES bounces.
+// Only the dots that differ from the previous preview are erased or drawn, so small aim changes cost
+// a handful of pixel writes instead of a full redraw.
+
+#define PREVIEW_BOUNCES 2
+#define PREVIEW_MAX_DOTS 48
+#define PREVIEW_DOT_SIZE 2      // dots are PREVIEW_DOT_SIZE x PREVIEW_DOT_SIZE pixels
+
+// Worst LCD SPI cost of drawing or erasing one dot, a pixel at a time
+#define PREVIEW_DOT_SPI_BYTES 80
+
+bool updatePreview(Pos ball, int32_t angle, uint32_t power, Pos hole, int spriteSize);
+void clearPreview(void);
+int previewDotLimit(void);
+uint32_t previewCost(void);
+
+// Number of dots drawn or erased on the LCD since startup
+extern uint32_t previewDotWrites;
+
+#endif
@@ -0,0 +1,229 @@
+#include "scene.h"
+#include "gameLogic.h"
+
+// A sprite of the background layer: a one-colour bitmap, or an indexed image (bitmap NULL)
+typedef struct {
+	Pos pos;
+	char *bitmap;
+	int bitmapSize;
+	unsigned short colour;
+	const IndexedImage *image;
+	const unsigned short *palette;
+} SceneSprite;
+
+static const Course *sceneCourse;
+static SceneSprite statics[SCENE_MAX_STATIC];
+static int staticCount = 0;
+
+uint32_t sceneRestoredPixels = 0;
+
+// Colour of each TerrainType
+static const unsigned short TERRAIN_COLOUR[4] = { Green, Olive, Cyan, Blue };
+
+
+// Starts a new background: the given course and no static sprites yet
+void sceneReset(const Course *course) {
+	sceneCourse = course;
+	staticCount = 0;
+}
+
+// Adds a sprite to the background layer, on top of the ones already there. Returns false if the layer is full.
+bool sceneAddStatic(Pos pos, char *bitmap, int bitmapSize, unsigned short colour) {
+	if (staticCount >= SCENE_MAX_STATIC) {
+		return false;
+	}
+	statics[staticCount].pos = pos;
+	statics[staticCount].bitmap = bitmap;
+	statics[staticCount].bitmapSize = bitmapSize;
+	statics[staticCount].colour = colour;
+	statics[staticCount].image = NULL;
+	statics[staticCount].palette = NULL;
+	staticCount++;
+	return true;
+}
+
+// Adds an indexed image, drawn with the given palette, to the background layer. Returns false if the layer is full.
+bool sceneAddImage(Pos pos, const IndexedImage *image, const unsigned short *palette) {
+	if (!sceneAddStatic(pos, NULL, 0, 0)) {
+		return false;
+	}
+	statics[staticCount - 1].image = image;
+	statics[staticCount - 1].palette = palette;
+	return true;
+}
+
+// True if drawSpriteAt(pos, bitmap, bitmapSize) lights the pixel: bitmap rows run along x, last row first,
+// and each bit is a SPRITE_SCALE x SPRITE_SCALE block
+static bool spritePixel(Pos pos, const char *bitmap, int bitmapSize, int x, int y) {
+	int dx = x - pos.x;
+	int dy = y - pos.y;
+
+	if (dx < 0 || dy < 0 || dx >= bitmapSize * SPRITE_SCALE || dy >= SPRITE_COLS * SPRITE_SCALE) {
+		return false;
+	}
+	return (bitmap[bitmapSize - 1 - dx / SPRITE_SCALE] >> (dy / SPRITE_SCALE)) & 1;
+}
+
+// True if drawImageAt(pos, image) draws the pixel; its colour is then in *colour
+static bool imagePixel(Pos pos, const IndexedImage *image, const unsigned short *palette, int x, int y,
+		unsigned short *colour) {
+	int dx = x - pos.x;
+	int dy = y - pos.y;
+	int index;
+
+	if (dx < 0 || dy < 0 || dx >= image->w || dy >= image->h) {
+		return false;
+	}
+	index = imageIndexAt(image, dx, dy);
+	if (index == 0 && image->transparent) {
+		return false;
+	}
+	*colour = palette[index];
+	return true;
+}
+
+static bool pixelInRect(int x, int y, const CourseRect *r) {
+	return x >= r->x && x < r->x + r->w && y >= r->y && y < r->y + r->h;
+}
+
+// Colour of the background at a screen pixel, topmost layer first: the HUD strip, static sprites, water,
+// walls, terrain. The same order they are painted in, bottom first (the HUD after drawScene).
+unsigned short sceneBackgroundAt(int x, int y) {
+	const CourseHeader *info = sceneCourse->header;
+	unsigned short colour;
+	int b;
+
+	if (hudPixelAt(x, y, &colour)) {
+		return colour;
+	}
+
+	for (int i = staticCount - 1; i >= 0; --i) {
+		if (statics[i].image) {
+			if (imagePixel(statics[i].pos, statics[i].image, statics[i].palette, x, y, &colour)) {
+				return colour;
+			}
+		} else if (spritePixel(statics[i].pos, statics[i].bitmap, statics[i].bitmapSize, x, y)) {
+			return statics[i].colour;
+		}
+	}
+
+	for (int i = 0; i < info->hazardCount; ++i) {
+		if (pixelInRect(x, y, &sceneCourse->hazards[i])) {
+			return Blue;
+		}
+	}
+
+	// Only the walls of the pixel's bucket can cover it
+	b = (y >> COURSE_BUCKET_SHIFT) * COURSE_BUCKETS_W + (x >> COURSE_BUCKET_SHIFT);
+	for (int k = sceneCourse->bucketStart[b]; k < sceneCourse->bucketStart[b + 1]; ++k) {
+		if (pixelInRect(x, y, &sceneCourse->walls[sceneCourse->bucketWalls[k]])) {
+			return DarkGrey;
+		}
+	}
+
+	return TERRAIN_COLOUR[courseTerrainCell(sceneCourse, x >> COURSE_TERRAIN_SHIFT, y >> COURSE_TERRAIN_SHIFT)];
+}
+
+
+// Draws the whole background layer over the screen cleared to the fairway colour, once per game: terrain,
+// walls and water as rectangles, then the static sprites
+void drawScene(void) {
+	const CourseHeader *info = sceneCourse->header;
+	int cell = 1 << COURSE_TERRAIN_SHIFT;
+
+	if (info->terrains & ~(1 << TERRAIN_FAIRWAY)) {
+		for (int cy = 0; cy <= (COURSE_HEIGHT - 1) >> COURSE_TERRAIN_SHIFT; ++cy) {
+			for (int cx = 0; cx <= (COURSE_WIDTH - 1) >> COURSE_TERRAIN_SHIFT; ++cx) {
+				int terrain = courseTerrainCell(sceneCourse, cx, cy);
+
+				if (terrain != TERRAIN_FAIRWAY) {
+					GLCD_SetTextColor(TERRAIN_COLOUR[terrain]);
+					drawRect(cx * cell, cy * cell, cell, cell);
+				}
+			}
+		}
+	}
+
+	for (int i = 0; i < info->wallCount + info->hazardCount; ++i) {
+		bool wall = i < info->wallCount;
+		const CourseRect *r = wall ? &sceneCourse->walls[i] : &sceneCourse->hazards[i - info->wallCount];
+
+		GLCD_SetTextColor(wall ? DarkGrey : Blue);
+		drawRect(r->x, r->y, r->w, r->h);
+	}
+
+	for (int i = 0; i < staticCount; ++i) {
+		if (statics[i].image) {
+			drawImageAt(statics[i].pos.x, statics[i].pos.y, statics[i].image, statics[i].palette);
+		} else {
+			GLCD_SetTextColor(statics[i].colour);
+			drawSpriteAt(statics[i].pos.x, statics[i].pos.y, statics[i].bitmap, statics[i].bitmapSize);
+		}
+	}
+}
+
+// Puts the background back in a rectangle of the screen, from the background description. A rectangle of one
+// colour (a ball block over the fairway, say) is filled as one span; otherwise each row's runs of one colour are.
+void restoreBackground(int x, int y, int w, int h) {
+	unsigned short colour;
+	bool uniform = true;
+	int x1, y1;
+
+	// Only the screen itself is drawn; it is the size of the course
+	x1 = (x + w > COURSE_WIDTH) ? COURSE_WIDTH : x + w;
+	y1 = (y + h > COURSE_HEIGHT) ? COURSE_HEIGHT : y + h;
+	if (x < 0) x = 0;
+	if (y < 0) y = 0;
+	if (x >= x1 || y >= y1) {
+		return;
+	}
+
+	colour = sceneBackgroundAt(x, y);
+	for (int j = y; j < y1 && uniform; ++j) {
+		for (int i = x; i < x1 && uniform; ++i) {
+			uniform = sceneBackgroundAt(i, j) == colour;
+		}
+	}
+	sceneRestoredPixels += (x1 - x) * (y1 - y);
+
+	if (uniform) {
+		GLCD_SetTextColor(colour);
+		drawRect(x, y, x1 - x, y1 - y);
+		return;
+	}
+
+	for (int j = y; j < y1; ++j) {
+		for (int i = x; i < x1; ) {
+			int start = i;
+
+			colour = sceneBackgroundAt(i, j);
+			while (i < x1 && sceneBackgroundAt(i, j) == colour) {
+				i++;
+			}
+			GLCD_SetTextColor(colour);
+			drawRect(start, j, i - start, 1);
+		}
+	}
+}
+
+// Erases a sprite drawn with drawSpriteAt: only its lit blocks are rewritten, with the background under them.
+// Like drawSpriteAt, each bit gives one band of SPRITE_SCALE lines and every run of lit blocks in it is restored
+// as one rectangle.
+void eraseSprite(Pos pos, char *bitmap, int bitmapSize) {
+	for (int bit = 0; bit < SPRITE_COLS; ++bit) {
+		for (int row = 0; row < bitmapSize; ) {
+			int start;
+
+			if (!((bitmap[bitmapSize - 1 - row] >> bit) & 1)) {
+				row++;
+				continue;
+			}
+			start = row;
+			while (row < bitmapSize && ((bitmap[bitmapSize - 1 - row] >> bit) & 1)) {
+				row++;
+			}
+			restoreBackground(pos.x + start * SPRITE_SCALE, pos.y + bit * SPRITE_SCALE, (row - start) * SPRITE_SCALE,
+			                  SPRITE_SCALE);
+		}
+	}
+}
@@ -0,0 +1,31 @@
+#ifndef GAME_SCENE
+#define GAME_SCENE
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "physics.h"
+#include "course.h"
+#include "blit.h"
+
+// Layered drawing. The background layer is everything that never moves: the course (terrain, walls, water)
+// and the static sprites on it (hole, teleporters), with the HUD strip (hud.c) on top. It is drawn once,
+// and is otherwise only kept as its description, so the colour of any background pixel can be worked out
+// without reading the LCD back over SPI.
+// Sprites that move (the ball, the preview dots) are drawn on top; erasing one puts back exactly the
+// background pixels it covered, so a ball rolling over the hole or a teleporter no longer wipes it out.
+
+#define SCENE_MAX_STATIC (COURSE_MAX_TELEPORTERS + 1)   // the teleporters and the hole
+
+void sceneReset(const Course *course);
+bool sceneAddStatic(Pos pos, char *bitmap, int bitmapSize, unsigned short colour);
+bool sceneAddImage(Pos pos, const IndexedImage *image, const unsigned short *palette);
+unsigned short sceneBackgroundAt(int x, int y);
+
+void drawScene(void);
+void restoreBackground(int x, int y, int w, int h);
+void eraseSprite(Pos pos, char *bitmap, int bitmapSize);
+
+// Background pixels rewritten by restoreBackground and eraseSprite since startup
+extern uint32_t sceneRestoredPixels;
+
+#endif
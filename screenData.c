@@ -0,0 +1,925 @@
+// Generated by tools/imagec from: screens/title.txt screens/win.txt screens/lose.txt
+// Do not edit; edit the pictures and run imagec -c again.
+
+#include "blit.h"
+
+// screens/title.txt: 320 x 240, 13 colours, 3921 bytes (2.6% of 16 bpp)
+static const unsigned short titleImagePalette[13] = {
+	0x001F, 0xFFE0, 0x7BE0, 0x031F, 0x041F, 0x04DF, 0xFFFF, 0xF800,
+	0x05DF, 0x065F, 0x05E0, 0x07E0, 0x0000,
+};
+static const uint8_t titleImageData[3921] = {
+	0x54, 0x4B, 0x00, 0x17, 0x01, 0x17, 0x00, 0x17, 0x01, 0x0F, 0x00, 0x07, 0x01, 0x27, 0x00, 0x27,
+	0x01, 0x40, 0x8F, 0x00, 0x17, 0x01, 0x17, 0x00, 0x17, 0x01, 0x0F, 0x00, 0x07, 0x01, 0x27, 0x00,
+	0x27, 0x01, 0x40, 0x8F, 0x00, 0x17, 0x01, 0x17, 0x00, 0x17, 0x01, 0x0F, 0x00, 0x07, 0x01, 0x27,
+	0x00, 0x27, 0x01, 0x40, 0x8F, 0x00, 0x17, 0x01, 0x17, 0x00, 0x17, 0x01, 0x0F, 0x00, 0x07, 0x01,
+	0x27, 0x00, 0x27, 0x01, 0x40, 0x8F, 0x00, 0x17, 0x01, 0x03, 0x02, 0x13, 0x00, 0x17, 0x01, 0x03,
+	0x02, 0x0B, 0x00, 0x07, 0x01, 0x03, 0x02, 0x23, 0x00, 0x27, 0x01, 0x03, 0x02, 0x40, 0x8B, 0x00,
+	0x17, 0x01, 0x03, 0x02, 0x13, 0x00, 0x17, 0x01, 0x03, 0x02, 0x0B, 0x00, 0x07, 0x01, 0x03, 0x02,
+	0x23, 0x00, 0x27, 0x01, 0x03, 0x02, 0x40, 0x8B, 0x00, 0x17, 0x01, 0x03, 0x02, 0x13, 0x00, 0x17,
+	0x01, 0x03, 0x02, 0x0B, 0x00, 0x07, 0x01, 0x03, 0x02, 0x23, 0x00, 0x27, 0x01, 0x03, 0x02, 0x40,
+	0x8B, 0x00, 0x17, 0x01, 0x03, 0x02, 0x13, 0x00, 0x17, 0x01, 0x03, 0x02, 0x0B, 0x00, 0x07, 0x01,
+	0x03, 0x02, 0x23, 0x00, 0x27, 0x01, 0x03, 0x02, 0x40, 0x83, 0x00, 0x07, 0x01, 0x03, 0x00, 0x13,
+	0x02, 0x07, 0x01, 0x07, 0x00, 0x07, 0x01, 0x03, 0x00, 0x13, 0x02, 0x07, 0x01, 0x07, 0x00, 0x07,
+	0x01, 0x03, 0x02, 0x23, 0x00, 0x07, 0x01, 0x23, 0x02, 0x40, 0x83, 0x00, 0x07, 0x01, 0x03, 0x00,
+	0x13, 0x02, 0x07, 0x01, 0x07, 0x00, 0x07, 0x01, 0x03, 0x00, 0x13, 0x02, 0x07, 0x01, 0x07, 0x00,
+	0x07, 0x01, 0x03, 0x02, 0x23, 0x00, 0x07, 0x01, 0x23, 0x02, 0x40, 0x83, 0x00, 0x07, 0x01, 0x03,
+	0x00, 0x13, 0x02, 0x07, 0x01, 0x07, 0x00, 0x07, 0x01, 0x03, 0x00, 0x13, 0x02, 0x07, 0x01, 0x07,
+	0x00, 0x07, 0x01, 0x03, 0x02, 0x23, 0x00, 0x07, 0x01, 0x23, 0x02, 0x40, 0x83, 0x00, 0x07, 0x01,
+	0x03, 0x00, 0x13, 0x02, 0x07, 0x01, 0x07, 0x00, 0x07, 0x01, 0x03, 0x00, 0x13, 0x02, 0x07, 0x01,
+	0x07, 0x00, 0x07, 0x01, 0x03, 0x02, 0x23, 0x00, 0x07, 0x01, 0x23, 0x02, 0x3F, 0x00, 0x40, 0x43,
+	0x03, 0x07, 0x01, 0x03, 0x02, 0x13, 0x03, 0x07, 0x01, 0x03, 0x02, 0x03, 0x03, 0x07, 0x01, 0x03,
+	0x02, 0x13, 0x03, 0x07, 0x01, 0x03, 0x02, 0x03, 0x03, 0x07, 0x01, 0x03, 0x02, 0x23, 0x03, 0x07,
+	0x01, 0x03, 0x02, 0x40, 0xA3, 0x03, 0x07, 0x01, 0x03, 0x02, 0x13, 0x03, 0x07, 0x01, 0x03, 0x02,
+	0x03, 0x03, 0x07, 0x01, 0x03, 0x02, 0x13, 0x03, 0x07, 0x01, 0x03, 0x02, 0x03, 0x03, 0x07, 0x01,
+	0x03, 0x02, 0x23, 0x03, 0x07, 0x01, 0x03, 0x02, 0x40, 0xA3, 0x03, 0x07, 0x01, 0x03, 0x02, 0x13,
+	0x03, 0x07, 0x01, 0x03, 0x02, 0x03, 0x03, 0x07, 0x01, 0x03, 0x02, 0x13, 0x03, 0x07, 0x01, 0x03,
+	0x02, 0x03, 0x03, 0x07, 0x01, 0x03, 0x02, 0x23, 0x03, 0x07, 0x01, 0x03, 0x02, 0x40, 0xA3, 0x03,
+	0x07, 0x01, 0x03, 0x02, 0x13, 0x03, 0x07, 0x01, 0x03, 0x02, 0x03, 0x03, 0x07, 0x01, 0x03, 0x02,
+	0x13, 0x03, 0x07, 0x01, 0x03, 0x02, 0x03, 0x03, 0x07, 0x01, 0x03, 0x02, 0x23, 0x03, 0x07, 0x01,
+	0x03, 0x02, 0x40, 0xA3, 0x03, 0x07, 0x01, 0x03, 0x02, 0x17, 0x03, 0x07, 0x02, 0x03, 0x03, 0x07,
+	0x01, 0x03, 0x02, 0x13, 0x03, 0x07, 0x01, 0x03, 0x02, 0x03, 0x03, 0x07, 0x01, 0x03, 0x02, 0x23,
+	0x03, 0x07, 0x01, 0x03, 0x02, 0x40, 0xA3, 0x03, 0x07, 0x01, 0x03, 0x02, 0x17, 0x03, 0x07, 0x02,
+	0x03, 0x03, 0x07, 0x01, 0x03, 0x02, 0x13, 0x03, 0x07, 0x01, 0x03, 0x02, 0x03, 0x03, 0x07, 0x01,
+	0x03, 0x02, 0x23, 0x03, 0x07, 0x01, 0x03, 0x02, 0x40, 0xA3, 0x03, 0x07, 0x01, 0x03, 0x02, 0x17,
+	0x03, 0x07, 0x02, 0x03, 0x03, 0x07, 0x01, 0x03, 0x02, 0x13, 0x03, 0x07, 0x01, 0x03, 0x02, 0x03,
+	0x03, 0x07, 0x01, 0x03, 0x02, 0x23, 0x03, 0x07, 0x01, 0x03, 0x02, 0x40, 0xA3, 0x03, 0x07, 0x01,
+	0x03, 0x02, 0x17, 0x03, 0x07, 0x02, 0x03, 0x03, 0x07, 0x01, 0x03, 0x02, 0x13, 0x03, 0x07, 0x01,
+	0x03, 0x02, 0x03, 0x03, 0x07, 0x01, 0x03, 0x02, 0x23, 0x03, 0x07, 0x01, 0x03, 0x02, 0x40, 0xA3,
+	0x03, 0x07, 0x01, 0x03, 0x02, 0x23, 0x03, 0x07, 0x01, 0x03, 0x02, 0x13, 0x03, 0x07, 0x01, 0x03,
+	0x02, 0x03, 0x03, 0x07, 0x01, 0x03, 0x02, 0x23, 0x03, 0x07, 0x01, 0x03, 0x02, 0x40, 0xA3, 0x03,
+	0x07, 0x01, 0x03, 0x02, 0x23, 0x03, 0x07, 0x01, 0x03, 0x02, 0x13, 0x03, 0x07, 0x01, 0x03, 0x02,
+	0x03, 0x03, 0x07, 0x01, 0x03, 0x02, 0x23, 0x03, 0x07, 0x01, 0x03, 0x02, 0x40, 0xA3, 0x03, 0x07,
+	0x01, 0x03, 0x02, 0x23, 0x03, 0x07, 0x01, 0x03, 0x02, 0x13, 0x03, 0x07, 0x01, 0x03, 0x02, 0x03,
+	0x03, 0x07, 0x01, 0x03, 0x02, 0x23, 0x03, 0x07, 0x01, 0x03, 0x02, 0x40, 0xA3, 0x03, 0x07, 0x01,
+	0x03, 0x02, 0x23, 0x03, 0x07, 0x01, 0x03, 0x02, 0x13, 0x03, 0x07, 0x01, 0x03, 0x02, 0x03, 0x03,
+	0x07, 0x01, 0x03, 0x02, 0x23, 0x03, 0x07, 0x01, 0x03, 0x02, 0x40, 0xA3, 0x03, 0x07, 0x01, 0x03,
+	0x02, 0x03, 0x03, 0x17, 0x01, 0x07, 0x03, 0x07, 0x01, 0x03, 0x02, 0x13, 0x03, 0x07, 0x01, 0x03,
+	0x02, 0x03, 0x03, 0x07, 0x01, 0x03, 0x02, 0x23, 0x03, 0x1F, 0x01, 0x40, 0x8F, 0x03, 0x07, 0x01,
+	0x03, 0x02, 0x03, 0x03, 0x17, 0x01, 0x07, 0x03, 0x07, 0x01, 0x03, 0x02, 0x13, 0x03, 0x07, 0x01,
+	0x03, 0x02, 0x03, 0x03, 0x07, 0x01, 0x03, 0x02, 0x23, 0x03, 0x1F, 0x01, 0x40, 0x8F, 0x03, 0x07,
+	0x01, 0x03, 0x02, 0x03, 0x03, 0x17, 0x01, 0x07, 0x03, 0x07, 0x01, 0x03, 0x02, 0x13, 0x03, 0x07,
+	0x01, 0x03, 0x02, 0x03, 0x03, 0x07, 0x01, 0x03, 0x02, 0x23, 0x03, 0x1F, 0x01, 0x40, 0x8F, 0x03,
+	0x07, 0x01, 0x03, 0x02, 0x03, 0x03, 0x17, 0x01, 0x07, 0x03, 0x07, 0x01, 0x03, 0x02, 0x13, 0x03,
+	0x07, 0x01, 0x03, 0x02, 0x03, 0x03, 0x07, 0x01, 0x03, 0x02, 0x23, 0x03, 0x1F, 0x01, 0x40, 0x8F,
+	0x03, 0x07, 0x01, 0x03, 0x02, 0x03, 0x03, 0x17, 0x01, 0x03, 0x02, 0x03, 0x03, 0x07, 0x01, 0x03,
+	0x02, 0x13, 0x03, 0x07, 0x01, 0x03, 0x02, 0x03, 0x03, 0x07, 0x01, 0x03, 0x02, 0x23, 0x03, 0x1F,
+	0x01, 0x03, 0x02, 0x40, 0x8B, 0x03, 0x07, 0x01, 0x03, 0x02, 0x03, 0x03, 0x17, 0x01, 0x03, 0x02,
+	0x03, 0x03, 0x07, 0x01, 0x03, 0x02, 0x13, 0x03, 0x07, 0x01, 0x03, 0x02, 0x03, 0x03, 0x07, 0x01,
+	0x03, 0x02, 0x23, 0x03, 0x1F, 0x01, 0x03, 0x02, 0x40, 0x8B, 0x03, 0x07, 0x01, 0x03, 0x02, 0x03,
+	0x03, 0x17, 0x01, 0x03, 0x02, 0x03, 0x03, 0x07, 0x01, 0x03, 0x02, 0x13, 0x03, 0x07, 0x01, 0x03,
+	0x02, 0x03, 0x03, 0x07, 0x01, 0x03, 0x02, 0x23, 0x03, 0x1F, 0x01, 0x03, 0x02, 0x40, 0x8B, 0x03,
+	0x07, 0x01, 0x03, 0x02, 0x03, 0x03, 0x17, 0x01, 0x03, 0x02, 0x03, 0x03, 0x07, 0x01, 0x03, 0x02,
+	0x13, 0x03, 0x07, 0x01, 0x03, 0x02, 0x03, 0x03, 0x07, 0x01, 0x03, 0x02, 0x23, 0x03, 0x1F, 0x01,
+	0x03, 0x02, 0x40, 0x8B, 0x03, 0x07, 0x01, 0x03, 0x02, 0x07, 0x03, 0x0B, 0x02, 0x07, 0x01, 0x03,
+	0x02, 0x03, 0x03, 0x07, 0x01, 0x03, 0x02, 0x13, 0x03, 0x07, 0x01, 0x03, 0x02, 0x03, 0x03, 0x07,
+	0x01, 0x03, 0x02, 0x23, 0x03, 0x07, 0x01, 0x1B, 0x02, 0x40, 0x8B, 0x03, 0x07, 0x01, 0x03, 0x02,
+	0x07, 0x03, 0x0B, 0x02, 0x07, 0x01, 0x03, 0x02, 0x03, 0x03, 0x07, 0x01, 0x03, 0x02, 0x13, 0x03,
+	0x07, 0x01, 0x03, 0x02, 0x03, 0x03, 0x07, 0x01, 0x03, 0x02, 0x23, 0x03, 0x07, 0x01, 0x1B, 0x02,
+	0x40, 0x8B, 0x03, 0x07, 0x01, 0x03, 0x02, 0x07, 0x03, 0x0B, 0x02, 0x07, 0x01, 0x03, 0x02, 0x03,
+	0x03, 0x07, 0x01, 0x03, 0x02, 0x13, 0x03, 0x07, 0x01, 0x03, 0x02, 0x03, 0x03, 0x07, 0x01, 0x03,
+	0x02, 0x23, 0x03, 0x07, 0x01, 0x1B, 0x02, 0x40, 0x8B, 0x03, 0x07, 0x01, 0x03, 0x02, 0x07, 0x03,
+	0x0B, 0x02, 0x07, 0x01, 0x03, 0x02, 0x03, 0x03, 0x07, 0x01, 0x03, 0x02, 0x13, 0x03, 0x07, 0x01,
+	0x03, 0x02, 0x03, 0x03, 0x07, 0x01, 0x03, 0x02, 0x23, 0x03, 0x07, 0x01, 0x1B, 0x02, 0x40, 0x47,
+	0x03, 0x40, 0x43, 0x04, 0x07, 0x01, 0x03, 0x02, 0x13, 0x04, 0x07, 0x01, 0x03, 0x02, 0x03, 0x04,
+	0x07, 0x01, 0x03, 0x02, 0x13, 0x04, 0x07, 0x01, 0x03, 0x02, 0x03, 0x04, 0x07, 0x01, 0x03, 0x02,
+	0x23, 0x04, 0x07, 0x01, 0x03, 0x02, 0x40, 0xA3, 0x04, 0x07, 0x01, 0x03, 0x02, 0x13, 0x04, 0x07,
+	0x01, 0x03, 0x02, 0x03, 0x04, 0x07, 0x01, 0x03, 0x02, 0x13, 0x04, 0x07, 0x01, 0x03, 0x02, 0x03,
+	0x04, 0x07, 0x01, 0x03, 0x02, 0x23, 0x04, 0x07, 0x01, 0x03, 0x02, 0x40, 0xA3, 0x04, 0x07, 0x01,
+	0x03, 0x02, 0x13, 0x04, 0x07, 0x01, 0x03, 0x02, 0x03, 0x04, 0x07, 0x01, 0x03, 0x02, 0x13, 0x04,
+	0x07, 0x01, 0x03, 0x02, 0x03, 0x04, 0x07, 0x01, 0x03, 0x02, 0x23, 0x04, 0x07, 0x01, 0x03, 0x02,
+	0x40, 0xA3, 0x04, 0x07, 0x01, 0x03, 0x02, 0x13, 0x04, 0x07, 0x01, 0x03, 0x02, 0x03, 0x04, 0x07,
+	0x01, 0x03, 0x02, 0x13, 0x04, 0x07, 0x01, 0x03, 0x02, 0x03, 0x04, 0x07, 0x01, 0x03, 0x02, 0x23,
+	0x04, 0x07, 0x01, 0x03, 0x02, 0x40, 0xA3, 0x04, 0x07, 0x01, 0x03, 0x02, 0x13, 0x04, 0x07, 0x01,
+	0x03, 0x02, 0x03, 0x04, 0x07, 0x01, 0x03, 0x02, 0x13, 0x04, 0x07, 0x01, 0x03, 0x02, 0x03, 0x04,
+	0x07, 0x01, 0x03, 0x02, 0x23, 0x04, 0x07, 0x01, 0x03, 0x02, 0x40, 0xA3, 0x04, 0x07, 0x01, 0x03,
+	0x02, 0x13, 0x04, 0x07, 0x01, 0x03, 0x02, 0x03, 0x04, 0x07, 0x01, 0x03, 0x02, 0x13, 0x04, 0x07,
+	0x01, 0x03, 0x02, 0x03, 0x04, 0x07, 0x01, 0x03, 0x02, 0x23, 0x04, 0x07, 0x01, 0x03, 0x02, 0x40,
+	0xA3, 0x04, 0x07, 0x01, 0x03, 0x02, 0x13, 0x04, 0x07, 0x01, 0x03, 0x02, 0x03, 0x04, 0x07, 0x01,
+	0x03, 0x02, 0x13, 0x04, 0x07, 0x01, 0x03, 0x02, 0x03, 0x04, 0x07, 0x01, 0x03, 0x02, 0x23, 0x04,
+	0x07, 0x01, 0x03, 0x02, 0x40, 0xA3, 0x04, 0x07, 0x01, 0x03, 0x02, 0x13, 0x04, 0x07, 0x01, 0x03,
+	0x02, 0x03, 0x04, 0x07, 0x01, 0x03, 0x02, 0x13, 0x04, 0x07, 0x01, 0x03, 0x02, 0x03, 0x04, 0x07,
+	0x01, 0x03, 0x02, 0x23, 0x04, 0x07, 0x01, 0x03, 0x02, 0x40, 0xA3, 0x04, 0x07, 0x01, 0x03, 0x02,
+	0x13, 0x04, 0x07, 0x01, 0x03, 0x02, 0x03, 0x04, 0x07, 0x01, 0x03, 0x02, 0x13, 0x04, 0x07, 0x01,
+	0x03, 0x02, 0x03, 0x04, 0x07, 0x01, 0x03, 0x02, 0x23, 0x04, 0x07, 0x01, 0x03, 0x02, 0x40, 0xA3,
+	0x04, 0x07, 0x01, 0x03, 0x02, 0x13, 0x04, 0x07, 0x01, 0x03, 0x02, 0x03, 0x04, 0x07, 0x01, 0x03,
+	0x02, 0x13, 0x04, 0x07, 0x01, 0x03, 0x02, 0x03, 0x04, 0x07, 0x01, 0x03, 0x02, 0x23, 0x04, 0x07,
+	0x01, 0x03, 0x02, 0x40, 0xA3, 0x04, 0x07, 0x01, 0x03, 0x02, 0x13, 0x04, 0x07, 0x01, 0x03, 0x02,
+	0x03, 0x04, 0x07, 0x01, 0x03, 0x02, 0x13, 0x04, 0x07, 0x01, 0x03, 0x02, 0x03, 0x04, 0x07, 0x01,
+	0x03, 0x02, 0x23, 0x04, 0x07, 0x01, 0x03, 0x02, 0x40, 0xA3, 0x04, 0x07, 0x01, 0x03, 0x02, 0x13,
+	0x04, 0x07, 0x01, 0x03, 0x02, 0x03, 0x04, 0x07, 0x01, 0x03, 0x02, 0x13, 0x04, 0x07, 0x01, 0x03,
+	0x02, 0x03, 0x04, 0x07, 0x01, 0x03, 0x02, 0x23, 0x04, 0x07, 0x01, 0x03, 0x02, 0x40, 0xA7, 0x04,
+	0x03, 0x02, 0x17, 0x01, 0x03, 0x04, 0x07, 0x02, 0x07, 0x04, 0x03, 0x02, 0x17, 0x01, 0x03, 0x04,
+	0x07, 0x02, 0x03, 0x04, 0x27, 0x01, 0x07, 0x04, 0x07, 0x01, 0x03, 0x02, 0x40, 0xA7, 0x04, 0x03,
+	0x02, 0x17, 0x01, 0x03, 0x04, 0x07, 0x02, 0x07, 0x04, 0x03, 0x02, 0x17, 0x01, 0x03, 0x04, 0x07,
+	0x02, 0x03, 0x04, 0x27, 0x01, 0x07, 0x04, 0x07, 0x01, 0x03, 0x02, 0x40, 0xA7, 0x04, 0x03, 0x02,
+	0x17, 0x01, 0x03, 0x04, 0x07, 0x02, 0x07, 0x04, 0x03, 0x02, 0x17, 0x01, 0x03, 0x04, 0x07, 0x02,
+	0x03, 0x04, 0x27, 0x01, 0x07, 0x04, 0x07, 0x01, 0x03, 0x02, 0x40, 0xA7, 0x04, 0x03, 0x02, 0x17,
+	0x01, 0x03, 0x04, 0x07, 0x02, 0x07, 0x04, 0x03, 0x02, 0x17, 0x01, 0x03, 0x04, 0x07, 0x02, 0x03,
+	0x04, 0x27, 0x01, 0x07, 0x04, 0x07, 0x01, 0x03, 0x02, 0x40, 0xAB, 0x04, 0x17, 0x01, 0x03, 0x02,
+	0x13, 0x04, 0x17, 0x01, 0x03, 0x02, 0x0B, 0x04, 0x27, 0x01, 0x03, 0x02, 0x03, 0x04, 0x07, 0x01,
+	0x03, 0x02, 0x40, 0xAB, 0x04, 0x17, 0x01, 0x03, 0x02, 0x13, 0x04, 0x17, 0x01, 0x03, 0x02, 0x0B,
+	0x04, 0x27, 0x01, 0x03, 0x02, 0x03, 0x04, 0x07, 0x01, 0x03, 0x02, 0x40, 0xAB, 0x04, 0x17, 0x01,
+	0x03, 0x02, 0x13, 0x04, 0x17, 0x01, 0x03, 0x02, 0x0B, 0x04, 0x27, 0x01, 0x03, 0x02, 0x03, 0x04,
+	0x07, 0x01, 0x03, 0x02, 0x40, 0xAB, 0x04, 0x17, 0x01, 0x03, 0x02, 0x13, 0x04, 0x17, 0x01, 0x03,
+	0x02, 0x0B, 0x04, 0x27, 0x01, 0x03, 0x02, 0x03, 0x04, 0x07, 0x01, 0x03, 0x02, 0x40, 0xAF, 0x04,
+	0x17, 0x02, 0x17, 0x04, 0x17, 0x02, 0x0F, 0x04, 0x27, 0x02, 0x07, 0x04, 0x07, 0x02, 0x40, 0xAF,
+	0x04, 0x17, 0x02, 0x17, 0x04, 0x17, 0x02, 0x0F, 0x04, 0x27, 0x02, 0x07, 0x04, 0x07, 0x02, 0x40,
+	0xAF, 0x04, 0x17, 0x02, 0x17, 0x04, 0x17, 0x02, 0x0F, 0x04, 0x27, 0x02, 0x07, 0x04, 0x07, 0x02,
+	0x40, 0xAF, 0x04, 0x17, 0x02, 0x17, 0x04, 0x17, 0x02, 0x0F, 0x04, 0x27, 0x02, 0x07, 0x04, 0x07,
+	0x02, 0x40, 0x5F, 0x04, 0x45, 0xF7, 0x05, 0x03, 0x06, 0x23, 0x07, 0x41, 0x17, 0x05, 0x03, 0x06,
+	0x23, 0x07, 0x41, 0x17, 0x05, 0x03, 0x06, 0x23, 0x07, 0x41, 0x17, 0x05, 0x03, 0x06, 0x23, 0x07,
+	0x41, 0x17, 0x05, 0x03, 0x06, 0x1F, 0x07, 0x41, 0x1B, 0x05, 0x03, 0x06, 0x1F, 0x07, 0x41, 0x1B,
+	0x05, 0x03, 0x06, 0x1F, 0x07, 0x41, 0x1B, 0x05, 0x03, 0x06, 0x1F, 0x07, 0x41, 0x1B, 0x05, 0x03,
+	0x06, 0x1B, 0x07, 0x41, 0x1F, 0x05, 0x03, 0x06, 0x1B, 0x07, 0x41, 0x1F, 0x05, 0x03, 0x06, 0x1B,
+	0x07, 0x41, 0x1F, 0x05, 0x03, 0x06, 0x1B, 0x07, 0x41, 0x1F, 0x05, 0x03, 0x06, 0x17, 0x07, 0x41,
+	0x23, 0x05, 0x03, 0x06, 0x17, 0x07, 0x41, 0x23, 0x05, 0x03, 0x06, 0x17, 0x07, 0x41, 0x23, 0x05,
+	0x03, 0x06, 0x17, 0x07, 0x41, 0x23, 0x05, 0x03, 0x06, 0x13, 0x07, 0x41, 0x27, 0x05, 0x03, 0x06,
+	0x13, 0x07, 0x41, 0x27, 0x05, 0x03, 0x06, 0x13, 0x07, 0x41, 0x27, 0x05, 0x03, 0x06, 0x13, 0x07,
+	0x41, 0x27, 0x05, 0x03, 0x06, 0x0F, 0x07, 0x41, 0x2B, 0x05, 0x03, 0x06, 0x0F, 0x07, 0x41, 0x2B,
+	0x05, 0x03, 0x06, 0x0F, 0x07, 0x41, 0x2B, 0x05, 0x03, 0x06, 0x0F, 0x07, 0x33, 0x05, 0x40, 0xF7,
+	0x08, 0x03, 0x06, 0x41, 0x3B, 0x08, 0x03, 0x06, 0x41, 0x3B, 0x08, 0x03, 0x06, 0x41, 0x3B, 0x08,
+	0x03, 0x06, 0x41, 0x3B, 0x08, 0x03, 0x06, 0x41, 0x3B, 0x08, 0x03, 0x06, 0x41, 0x3B, 0x08, 0x03,
+	0x06, 0x41, 0x3B, 0x08, 0x03, 0x06, 0x41, 0x3B, 0x08, 0x03, 0x06, 0x41, 0x3B, 0x08, 0x03, 0x06,
+	0x41, 0x3B, 0x08, 0x03, 0x06, 0x41, 0x3B, 0x08, 0x03, 0x06, 0x41, 0x3B, 0x08, 0x03, 0x06, 0x41,
+	0x3B, 0x08, 0x03, 0x06, 0x41, 0x3B, 0x08, 0x03, 0x06, 0x41, 0x3B, 0x08, 0x03, 0x06, 0x41, 0x3B,
+	0x08, 0x03, 0x06, 0x41, 0x3B, 0x08, 0x03, 0x06, 0x41, 0x3B, 0x08, 0x03, 0x06, 0x41, 0x3B, 0x08,
+	0x03, 0x06, 0x41, 0x3B, 0x08, 0x03, 0x06, 0x41, 0x3B, 0x08, 0x03, 0x06, 0x41, 0x3B, 0x08, 0x03,
+	0x06, 0x41, 0x3B, 0x08, 0x03, 0x06, 0x40, 0x43, 0x08, 0x40, 0xF7, 0x09, 0x03, 0x06, 0x41, 0x3B,
+	0x09, 0x03, 0x06, 0x41, 0x3B, 0x09, 0x03, 0x06, 0x41, 0x3B, 0x09, 0x03, 0x06, 0x41, 0x3B, 0x09,
+	0x03, 0x06, 0x41, 0x3B, 0x09, 0x03, 0x06, 0x41, 0x3B, 0x09, 0x03, 0x06, 0x41, 0x3B, 0x09, 0x03,
+	0x06, 0x41, 0x3B, 0x09, 0x03, 0x06, 0x41, 0x3B, 0x09, 0x03, 0x06, 0x41, 0x3B, 0x09, 0x03, 0x06,
+	0x41, 0x3B, 0x09, 0x03, 0x06, 0x41, 0x3B, 0x09, 0x03, 0x06, 0x41, 0x3B, 0x09, 0x03, 0x06, 0x41,
+	0x3B, 0x09, 0x03, 0x06, 0x41, 0x3B, 0x09, 0x03, 0x06, 0x41, 0x3B, 0x09, 0x03, 0x06, 0x41, 0x3B,
+	0x09, 0x03, 0x06, 0x41, 0x3B, 0x09, 0x03, 0x06, 0x41, 0x3B, 0x09, 0x03, 0x06, 0x41, 0x3B, 0x09,
+	0x03, 0x06, 0x41, 0x3B, 0x09, 0x03, 0x06, 0x41, 0x3B, 0x09, 0x03, 0x06, 0x41, 0x3B, 0x09, 0x03,
+	0x06, 0x40, 0x43, 0x09, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B,
+	0x07, 0x0A, 0x03, 0x06, 0x1B, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B,
+	0x27, 0x0A, 0x27, 0x0B, 0x07, 0x0A, 0x03, 0x06, 0x1B, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B,
+	0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x07, 0x0A, 0x03, 0x06, 0x1B, 0x0A, 0x27, 0x0B,
+	0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x07, 0x0A, 0x03, 0x06,
+	0x1B, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B,
+	0x07, 0x0A, 0x03, 0x06, 0x1B, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B,
+	0x27, 0x0A, 0x27, 0x0B, 0x07, 0x0A, 0x03, 0x06, 0x1B, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B,
+	0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x07, 0x0A, 0x03, 0x06, 0x1B, 0x0A, 0x27, 0x0B,
+	0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x07, 0x0A, 0x03, 0x06,
+	0x1B, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B,
+	0x07, 0x0A, 0x03, 0x06, 0x1B, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B,
+	0x27, 0x0A, 0x27, 0x0B, 0x07, 0x0A, 0x03, 0x06, 0x1B, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B,
+	0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x07, 0x0A, 0x03, 0x06, 0x1B, 0x0A, 0x27, 0x0B,
+	0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x07, 0x0A, 0x03, 0x06,
+	0x1B, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B,
+	0x07, 0x0A, 0x03, 0x06, 0x1B, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B,
+	0x27, 0x0A, 0x27, 0x0B, 0x07, 0x0A, 0x03, 0x06, 0x1B, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B,
+	0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x07, 0x0A, 0x03, 0x06, 0x1B, 0x0A, 0x27, 0x0B,
+	0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x07, 0x0A, 0x03, 0x06,
+	0x1B, 0x0A, 0x40, 0x4F, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x07,
+	0x0B, 0x03, 0x06, 0x1B, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27,
+	0x0B, 0x27, 0x0A, 0x07, 0x0B, 0x03, 0x06, 0x1B, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27,
+	0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x07, 0x0B, 0x03, 0x06, 0x1B, 0x0B, 0x27, 0x0A, 0x27,
+	0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x07, 0x0B, 0x03, 0x06, 0x1B,
+	0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x07,
+	0x0B, 0x03, 0x06, 0x1B, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27,
+	0x0B, 0x27, 0x0A, 0x07, 0x0B, 0x03, 0x06, 0x1B, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27,
+	0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x07, 0x0B, 0x03, 0x06, 0x1B, 0x0B, 0x27, 0x0A, 0x27,
+	0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x07, 0x0B, 0x03, 0x06, 0x1B,
+	0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x07,
+	0x0B, 0x03, 0x06, 0x1B, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27,
+	0x0B, 0x27, 0x0A, 0x07, 0x0B, 0x03, 0x06, 0x1B, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27,
+	0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x07, 0x0B, 0x03, 0x06, 0x1B, 0x0B, 0x27, 0x0A, 0x27,
+	0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x07, 0x0B, 0x03, 0x06, 0x1B,
+	0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x1F, 0x0A, 0x0F,
+	0x0C, 0x03, 0x06, 0x0F, 0x0C, 0x0B, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27,
+	0x0A, 0x27, 0x0B, 0x1F, 0x0A, 0x0F, 0x0C, 0x03, 0x06, 0x0F, 0x0C, 0x0B, 0x0B, 0x27, 0x0A, 0x27,
+	0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x1F, 0x0A, 0x0F, 0x0C, 0x03, 0x06, 0x0F,
+	0x0C, 0x0B, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x1F,
+	0x0A, 0x0F, 0x0C, 0x03, 0x06, 0x0F, 0x0C, 0x0B, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27,
+	0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x1B, 0x0A, 0x2B, 0x0C, 0x07, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27,
+	0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x1B, 0x0A, 0x2B, 0x0C, 0x07, 0x0B, 0x27, 0x0A, 0x27,
+	0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x1B, 0x0A, 0x2B, 0x0C, 0x07, 0x0B, 0x27,
+	0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x1B, 0x0A, 0x2B, 0x0C, 0x07,
+	0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x03, 0x06, 0x23, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x1F,
+	0x0A, 0x23, 0x0C, 0x0B, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x03, 0x06, 0x23, 0x0B, 0x27,
+	0x0A, 0x27, 0x0B, 0x1F, 0x0A, 0x23, 0x0C, 0x0B, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x03,
+	0x06, 0x23, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x1F, 0x0A, 0x23, 0x0C, 0x0B, 0x0B, 0x27, 0x0A, 0x27,
+	0x0B, 0x27, 0x0A, 0x03, 0x06, 0x23, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x1F, 0x0A, 0x23, 0x0C, 0x0B,
+	0x0B, 0x40, 0x4F, 0x0A, 0x23, 0x0B, 0x0B, 0x06, 0x1F, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B,
+	0x07, 0x0A, 0x03, 0x0C, 0x1B, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x23, 0x0B, 0x0B, 0x06, 0x1F, 0x0A,
+	0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x07, 0x0A, 0x03, 0x0C, 0x1B, 0x0A, 0x27, 0x0B, 0x27, 0x0A,
+	0x23, 0x0B, 0x0B, 0x06, 0x1F, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x07, 0x0A, 0x03, 0x0C,
+	0x1B, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x23, 0x0B, 0x0B, 0x06, 0x1F, 0x0A, 0x27, 0x0B, 0x27, 0x0A,
+	0x27, 0x0B, 0x07, 0x0A, 0x03, 0x0C, 0x1B, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x1F, 0x0B, 0x13, 0x06,
+	0x1B, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x1F, 0x0B,
+	0x13, 0x06, 0x1B, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A,
+	0x1F, 0x0B, 0x13, 0x06, 0x1B, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B,
+	0x27, 0x0A, 0x1F, 0x0B, 0x13, 0x06, 0x1B, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A,
+	0x27, 0x0B, 0x27, 0x0A, 0x23, 0x0B, 0x0B, 0x06, 0x1F, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B,
+	0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x23, 0x0B, 0x0B, 0x06, 0x1F, 0x0A, 0x27, 0x0B, 0x27, 0x0A,
+	0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x23, 0x0B, 0x0B, 0x06, 0x1F, 0x0A, 0x27, 0x0B,
+	0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x23, 0x0B, 0x0B, 0x06, 0x1F, 0x0A,
+	0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x03, 0x06,
+	0x23, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B,
+	0x03, 0x06, 0x23, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A,
+	0x27, 0x0B, 0x03, 0x06, 0x23, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B,
+	0x27, 0x0A, 0x27, 0x0B, 0x03, 0x06, 0x23, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A,
+	0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A,
+	0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A,
+	0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A,
+	0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A,
+	0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A,
+	0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A,
+	0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A,
+	0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A,
+	0x40, 0x4F, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27,
+	0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27,
+	0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27,
+	0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27,
+	0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27,
+	0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27,
+	0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27,
+	0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27,
+	0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27,
+	0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27,
+	0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27,
+	0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27,
+	0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27,
+	0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27,
+	0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27,
+	0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27,
+	0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27,
+	0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27,
+	0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27,
+	0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27,
+	0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27,
+	0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27,
+	0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27,
+	0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27, 0x0A, 0x27, 0x0B, 0x27,
+	0x0A,
+};
+const RleImage titleImage = { 320, 240, 13, titleImagePalette, titleImageData, 3921 };
+
+// screens/win.txt: 320 x 240, 7 colours, 7250 bytes (4.7% of 16 bpp)
+static const unsigned short winImagePalette[7] = {
+	0x0320, 0x03E0, 0xFFE0, 0x0000, 0xC618, 0xF800, 0xFFFF,
+};
+static const uint8_t winImageData[7250] = {
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x3F, 0x01,
+	0x1F, 0x00, 0x03, 0x01, 0x07, 0x02, 0x13, 0x01, 0x03, 0x00, 0x07, 0x02, 0x0F, 0x00, 0x17, 0x02,
+	0x0B, 0x01, 0x03, 0x00, 0x07, 0x02, 0x13, 0x00, 0x03, 0x01, 0x07, 0x02, 0x13, 0x01, 0x03, 0x00,
+	0x07, 0x02, 0x13, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x03, 0x01, 0x07, 0x02,
+	0x13, 0x01, 0x03, 0x00, 0x07, 0x02, 0x0F, 0x00, 0x17, 0x02, 0x0B, 0x01, 0x03, 0x00, 0x07, 0x02,
+	0x13, 0x00, 0x03, 0x01, 0x07, 0x02, 0x13, 0x01, 0x03, 0x00, 0x07, 0x02, 0x13, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x03, 0x01, 0x07, 0x02, 0x13, 0x01, 0x03, 0x00, 0x07, 0x02,
+	0x0F, 0x00, 0x17, 0x02, 0x0B, 0x01, 0x03, 0x00, 0x07, 0x02, 0x13, 0x00, 0x03, 0x01, 0x07, 0x02,
+	0x13, 0x01, 0x03, 0x00, 0x07, 0x02, 0x13, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00,
+	0x03, 0x01, 0x07, 0x02, 0x13, 0x01, 0x03, 0x00, 0x07, 0x02, 0x0F, 0x00, 0x17, 0x02, 0x0B, 0x01,
+	0x03, 0x00, 0x07, 0x02, 0x13, 0x00, 0x03, 0x01, 0x07, 0x02, 0x13, 0x01, 0x03, 0x00, 0x07, 0x02,
+	0x13, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03,
+	0x0F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x0B, 0x00, 0x17, 0x02, 0x03, 0x03, 0x07, 0x01,
+	0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01,
+	0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00,
+	0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x0B, 0x00,
+	0x17, 0x02, 0x03, 0x03, 0x07, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x00, 0x03, 0x01,
+	0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00,
+	0x07, 0x02, 0x03, 0x03, 0x0B, 0x00, 0x17, 0x02, 0x03, 0x03, 0x07, 0x01, 0x03, 0x00, 0x07, 0x02,
+	0x03, 0x03, 0x0F, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x07, 0x02,
+	0x03, 0x03, 0x0F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x03, 0x01, 0x07, 0x02,
+	0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x0B, 0x00, 0x17, 0x02, 0x03, 0x03,
+	0x07, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03,
+	0x0F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03,
+	0x0F, 0x00, 0x03, 0x03, 0x07, 0x02, 0x0B, 0x03, 0x07, 0x01, 0x03, 0x00, 0x0F, 0x02, 0x0B, 0x00,
+	0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x00,
+	0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01,
+	0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x00, 0x03, 0x03, 0x07, 0x02, 0x0B, 0x03, 0x07, 0x01,
+	0x03, 0x00, 0x0F, 0x02, 0x0B, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00,
+	0x07, 0x02, 0x03, 0x03, 0x0F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x03, 0x01,
+	0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x00, 0x03, 0x03,
+	0x07, 0x02, 0x0B, 0x03, 0x07, 0x01, 0x03, 0x00, 0x0F, 0x02, 0x0B, 0x00, 0x03, 0x01, 0x07, 0x02,
+	0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x00, 0x1F, 0x01, 0x1F, 0x00,
+	0x1F, 0x01, 0x1F, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x07, 0x02,
+	0x03, 0x03, 0x0F, 0x00, 0x03, 0x03, 0x07, 0x02, 0x0B, 0x03, 0x07, 0x01, 0x03, 0x00, 0x0F, 0x02,
+	0x0B, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03,
+	0x0F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03,
+	0x0F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03,
+	0x0F, 0x01, 0x03, 0x00, 0x0F, 0x02, 0x03, 0x03, 0x07, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03,
+	0x0F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03,
+	0x0F, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x0F, 0x02, 0x03, 0x03,
+	0x07, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03,
+	0x0F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03,
+	0x0F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03,
+	0x0F, 0x01, 0x03, 0x00, 0x0F, 0x02, 0x03, 0x03, 0x07, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03,
+	0x0F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03,
+	0x0F, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x0F, 0x02, 0x03, 0x03,
+	0x07, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03,
+	0x0F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03,
+	0x0F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03,
+	0x0F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x07, 0x03, 0x07, 0x02, 0x03, 0x00, 0x03, 0x01, 0x07, 0x02,
+	0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x00, 0x1F, 0x01, 0x1F, 0x00,
+	0x1F, 0x01, 0x1F, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x07, 0x02,
+	0x03, 0x03, 0x0F, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x07, 0x02,
+	0x07, 0x03, 0x07, 0x02, 0x03, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00,
+	0x07, 0x02, 0x03, 0x03, 0x0F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x03, 0x01,
+	0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x00, 0x03, 0x01,
+	0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x07, 0x03, 0x07, 0x02, 0x03, 0x00,
+	0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x00,
+	0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01,
+	0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01,
+	0x03, 0x00, 0x07, 0x02, 0x07, 0x03, 0x07, 0x02, 0x03, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03,
+	0x0F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03,
+	0x0F, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03,
+	0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00,
+	0x07, 0x02, 0x03, 0x03, 0x0F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x03, 0x01,
+	0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x00, 0x03, 0x01,
+	0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x03, 0x00, 0x07, 0x02,
+	0x03, 0x03, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03,
+	0x0F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03,
+	0x0F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03,
+	0x0F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x03, 0x01,
+	0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00,
+	0x07, 0x02, 0x03, 0x03, 0x0F, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00,
+	0x07, 0x02, 0x03, 0x03, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03,
+	0x0F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x03, 0x01, 0x07, 0x02, 0x03, 0x01, 0x03, 0x00,
+	0x07, 0x02, 0x03, 0x03, 0x0F, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00,
+	0x07, 0x02, 0x03, 0x03, 0x07, 0x00, 0x03, 0x03, 0x0F, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00,
+	0x07, 0x02, 0x03, 0x03, 0x0F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x03, 0x01,
+	0x07, 0x02, 0x03, 0x03, 0x03, 0x01, 0x07, 0x02, 0x03, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03,
+	0x0F, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03,
+	0x07, 0x00, 0x03, 0x03, 0x0F, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03,
+	0x0F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03,
+	0x03, 0x01, 0x07, 0x02, 0x03, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x00, 0x03, 0x01,
+	0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x07, 0x00, 0x03, 0x03,
+	0x0F, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x03, 0x01, 0x07, 0x02,
+	0x03, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03,
+	0x0F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x07, 0x00, 0x03, 0x03, 0x0F, 0x02, 0x03, 0x03,
+	0x0F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x03, 0x00,
+	0x07, 0x02, 0x03, 0x03, 0x0F, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00,
+	0x07, 0x02, 0x03, 0x03, 0x0B, 0x00, 0x0F, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x07, 0x02,
+	0x03, 0x03, 0x0F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x03, 0x01, 0x07, 0x02,
+	0x03, 0x03, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x00,
+	0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x0B, 0x00,
+	0x0F, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x03, 0x01, 0x07, 0x02,
+	0x03, 0x03, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03,
+	0x0F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x0B, 0x00, 0x0F, 0x02, 0x03, 0x03, 0x0F, 0x01,
+	0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00,
+	0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x03, 0x00, 0x07, 0x02,
+	0x03, 0x03, 0x0F, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x07, 0x02,
+	0x03, 0x03, 0x0B, 0x00, 0x0F, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03,
+	0x0F, 0x00, 0x1F, 0x01, 0x3F, 0x00, 0x1F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x03, 0x00,
+	0x07, 0x02, 0x03, 0x03, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x07, 0x02,
+	0x03, 0x03, 0x0F, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x03, 0x07, 0x02,
+	0x03, 0x03, 0x0F, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03,
+	0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x00,
+	0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x03, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x00,
+	0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x03, 0x01, 0x07, 0x02,
+	0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x00, 0x03, 0x01, 0x07, 0x02,
+	0x03, 0x03, 0x0F, 0x01, 0x03, 0x03, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x00, 0x03, 0x01, 0x07, 0x02,
+	0x03, 0x03, 0x0F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x03, 0x00, 0x07, 0x02,
+	0x03, 0x03, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01,
+	0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01,
+	0x03, 0x03, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x03, 0x00,
+	0x07, 0x02, 0x03, 0x03, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x07, 0x02,
+	0x03, 0x03, 0x0F, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x07, 0x02,
+	0x03, 0x03, 0x0F, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03,
+	0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x00,
+	0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x00,
+	0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x03, 0x01, 0x07, 0x02,
+	0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x00, 0x03, 0x01, 0x07, 0x02,
+	0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x00, 0x03, 0x01, 0x07, 0x02,
+	0x03, 0x03, 0x0F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x03, 0x00, 0x07, 0x02,
+	0x03, 0x03, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01,
+	0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01,
+	0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x03, 0x00,
+	0x07, 0x02, 0x03, 0x03, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x07, 0x02,
+	0x03, 0x03, 0x0F, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x07, 0x02,
+	0x03, 0x03, 0x0F, 0x00, 0x07, 0x01, 0x07, 0x03, 0x0F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00,
+	0x1F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x03, 0x01,
+	0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x00, 0x03, 0x01,
+	0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x00, 0x07, 0x01,
+	0x07, 0x03, 0x0F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x03, 0x00, 0x07, 0x02,
+	0x03, 0x03, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01,
+	0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01,
+	0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x00, 0x07, 0x01, 0x07, 0x03, 0x0F, 0x01, 0x1F, 0x00,
+	0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x03, 0x00, 0x07, 0x02,
+	0x03, 0x03, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03,
+	0x0F, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03,
+	0x0F, 0x00, 0x07, 0x01, 0x07, 0x03, 0x0F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x03, 0x01, 0x07, 0x02,
+	0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x00, 0x03, 0x01, 0x07, 0x02,
+	0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x00, 0x1F, 0x01, 0x1F, 0x00,
+	0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x03, 0x00, 0x07, 0x02,
+	0x03, 0x03, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03,
+	0x0F, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03,
+	0x0F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x03, 0x00, 0x07, 0x02,
+	0x03, 0x03, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01,
+	0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01,
+	0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00,
+	0x1F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x03, 0x01,
+	0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x00, 0x03, 0x01,
+	0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x07, 0x00, 0x03, 0x03, 0x07, 0x02, 0x03, 0x00,
+	0x03, 0x03, 0x07, 0x02, 0x03, 0x01, 0x07, 0x03, 0x0B, 0x01, 0x17, 0x02, 0x0B, 0x00, 0x03, 0x01,
+	0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x03, 0x04, 0x23, 0x05,
+	0x07, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x07, 0x00, 0x03, 0x03, 0x07, 0x02,
+	0x03, 0x00, 0x03, 0x03, 0x07, 0x02, 0x03, 0x01, 0x07, 0x03, 0x0B, 0x01, 0x17, 0x02, 0x0B, 0x00,
+	0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x03, 0x04,
+	0x23, 0x05, 0x07, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x07, 0x00, 0x03, 0x03,
+	0x07, 0x02, 0x03, 0x00, 0x03, 0x03, 0x07, 0x02, 0x03, 0x01, 0x07, 0x03, 0x0B, 0x01, 0x17, 0x02,
+	0x0B, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03,
+	0x03, 0x04, 0x23, 0x05, 0x07, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x07, 0x00,
+	0x03, 0x03, 0x07, 0x02, 0x03, 0x00, 0x03, 0x03, 0x07, 0x02, 0x03, 0x01, 0x07, 0x03, 0x0B, 0x01,
+	0x17, 0x02, 0x0B, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x07, 0x02,
+	0x03, 0x03, 0x03, 0x04, 0x23, 0x05, 0x07, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x0B, 0x00, 0x07, 0x02, 0x03, 0x03, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x13, 0x01, 0x17, 0x02,
+	0x03, 0x03, 0x07, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x07, 0x02,
+	0x03, 0x03, 0x03, 0x04, 0x1F, 0x05, 0x0B, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x0B, 0x00, 0x07, 0x02, 0x03, 0x03, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x13, 0x01, 0x17, 0x02,
+	0x03, 0x03, 0x07, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x07, 0x02,
+	0x03, 0x03, 0x03, 0x04, 0x1F, 0x05, 0x0B, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x0B, 0x00, 0x07, 0x02, 0x03, 0x03, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x13, 0x01, 0x17, 0x02,
+	0x03, 0x03, 0x07, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x07, 0x02,
+	0x03, 0x03, 0x03, 0x04, 0x1F, 0x05, 0x0B, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x0B, 0x00, 0x07, 0x02, 0x03, 0x03, 0x03, 0x00, 0x07, 0x02, 0x03, 0x03, 0x13, 0x01, 0x17, 0x02,
+	0x03, 0x03, 0x07, 0x00, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x0F, 0x01, 0x03, 0x00, 0x07, 0x02,
+	0x03, 0x03, 0x03, 0x04, 0x1F, 0x05, 0x0B, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x0F, 0x00, 0x07, 0x03, 0x07, 0x00, 0x07, 0x03, 0x17, 0x01, 0x17, 0x03, 0x07, 0x00, 0x07, 0x01,
+	0x07, 0x03, 0x0F, 0x01, 0x07, 0x00, 0x07, 0x03, 0x03, 0x04, 0x1B, 0x05, 0x0F, 0x01, 0x1F, 0x00,
+	0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x0F, 0x00, 0x07, 0x03, 0x07, 0x00, 0x07, 0x03, 0x17, 0x01,
+	0x17, 0x03, 0x07, 0x00, 0x07, 0x01, 0x07, 0x03, 0x0F, 0x01, 0x07, 0x00, 0x07, 0x03, 0x03, 0x04,
+	0x1B, 0x05, 0x0F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x0F, 0x00, 0x07, 0x03,
+	0x07, 0x00, 0x07, 0x03, 0x17, 0x01, 0x17, 0x03, 0x07, 0x00, 0x07, 0x01, 0x07, 0x03, 0x0F, 0x01,
+	0x07, 0x00, 0x07, 0x03, 0x03, 0x04, 0x1B, 0x05, 0x0F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00,
+	0x1F, 0x01, 0x0F, 0x00, 0x07, 0x03, 0x07, 0x00, 0x07, 0x03, 0x17, 0x01, 0x17, 0x03, 0x07, 0x00,
+	0x07, 0x01, 0x07, 0x03, 0x0F, 0x01, 0x07, 0x00, 0x07, 0x03, 0x03, 0x04, 0x1B, 0x05, 0x0F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x0F, 0x00, 0x03, 0x04, 0x17, 0x05, 0x13, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x0F, 0x00, 0x03, 0x04, 0x17, 0x05, 0x13, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x0F, 0x00, 0x03, 0x04, 0x17, 0x05, 0x13, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x0F, 0x00, 0x03, 0x04, 0x17, 0x05, 0x13, 0x01,
+	0x1F, 0x00, 0x3F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x0F, 0x01,
+	0x03, 0x04, 0x13, 0x05, 0x17, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x0F, 0x01, 0x03, 0x04, 0x13, 0x05, 0x17, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x0F, 0x01,
+	0x03, 0x04, 0x13, 0x05, 0x17, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x0F, 0x01, 0x03, 0x04, 0x13, 0x05, 0x17, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x0F, 0x01,
+	0x03, 0x04, 0x0F, 0x05, 0x1B, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x0F, 0x01, 0x03, 0x04, 0x0F, 0x05, 0x1B, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x0F, 0x01,
+	0x03, 0x04, 0x0F, 0x05, 0x1B, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x0F, 0x01, 0x03, 0x04, 0x0F, 0x05, 0x1B, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x0F, 0x01,
+	0x03, 0x04, 0x0B, 0x05, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x0F, 0x01, 0x03, 0x04, 0x0B, 0x05, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x0F, 0x01,
+	0x03, 0x04, 0x0B, 0x05, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x0F, 0x01, 0x03, 0x04, 0x0B, 0x05, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x0F, 0x01,
+	0x03, 0x04, 0x0B, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x0F, 0x01, 0x03, 0x04, 0x0B, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x0F, 0x01,
+	0x03, 0x04, 0x0B, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x0F, 0x01, 0x03, 0x04, 0x0B, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x0F, 0x01,
+	0x03, 0x04, 0x0B, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x0F, 0x01, 0x03, 0x04, 0x0B, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x0F, 0x01,
+	0x03, 0x04, 0x0B, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x0F, 0x01, 0x03, 0x04, 0x0B, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x0F, 0x01,
+	0x03, 0x04, 0x0B, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x0F, 0x01, 0x03, 0x04, 0x0B, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x0F, 0x01,
+	0x03, 0x04, 0x0B, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x0F, 0x01, 0x03, 0x04, 0x0B, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x0F, 0x01,
+	0x03, 0x04, 0x0B, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x0F, 0x01, 0x03, 0x04, 0x0B, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x0F, 0x01,
+	0x03, 0x04, 0x0B, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x0F, 0x01, 0x03, 0x04, 0x0B, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x0F, 0x01,
+	0x03, 0x04, 0x0B, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x0F, 0x01, 0x03, 0x04, 0x0B, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x0F, 0x01,
+	0x03, 0x04, 0x0B, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x0F, 0x01, 0x03, 0x04, 0x0B, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x3F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x0F, 0x00, 0x03, 0x04,
+	0x0B, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x0F, 0x00, 0x03, 0x04, 0x0B, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x0F, 0x00, 0x03, 0x04,
+	0x0B, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x0F, 0x00, 0x03, 0x04, 0x0B, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x0F, 0x00, 0x03, 0x04,
+	0x0B, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x0F, 0x00, 0x03, 0x04, 0x0B, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x0F, 0x00, 0x03, 0x04,
+	0x0B, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x0F, 0x00, 0x03, 0x04, 0x0B, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x0F, 0x00, 0x03, 0x04,
+	0x0B, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x0F, 0x00, 0x03, 0x04, 0x0B, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x0F, 0x00, 0x03, 0x04,
+	0x0B, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x0F, 0x00, 0x03, 0x04, 0x0B, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x0F, 0x00, 0x03, 0x04,
+	0x0B, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x0F, 0x00, 0x03, 0x04, 0x0B, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x0F, 0x00, 0x03, 0x04,
+	0x0B, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x0F, 0x00, 0x03, 0x04, 0x0B, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x0F, 0x00, 0x03, 0x04,
+	0x0B, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x0F, 0x00, 0x03, 0x04, 0x0B, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x0F, 0x00, 0x03, 0x04,
+	0x0B, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x0F, 0x00, 0x03, 0x04, 0x0B, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x0F, 0x00, 0x03, 0x04,
+	0x0B, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x0F, 0x00, 0x03, 0x04, 0x0B, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x0F, 0x00, 0x03, 0x04,
+	0x0B, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x0F, 0x00, 0x03, 0x04, 0x0B, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x03, 0x06, 0x1B, 0x01, 0x0F, 0x00,
+	0x03, 0x04, 0x0B, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00,
+	0x1F, 0x01, 0x1F, 0x00, 0x03, 0x06, 0x1B, 0x01, 0x0F, 0x00, 0x03, 0x04, 0x0B, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x03, 0x06,
+	0x1B, 0x01, 0x0F, 0x00, 0x03, 0x04, 0x0B, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00,
+	0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x03, 0x06, 0x1B, 0x01, 0x0F, 0x00, 0x03, 0x04,
+	0x0B, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x17, 0x00, 0x13, 0x06, 0x13, 0x01, 0x0F, 0x00, 0x03, 0x04, 0x0B, 0x00, 0x1F, 0x01, 0x1F, 0x00,
+	0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x17, 0x00, 0x13, 0x06, 0x13, 0x01,
+	0x0F, 0x00, 0x03, 0x04, 0x0B, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x17, 0x00, 0x13, 0x06, 0x13, 0x01, 0x0F, 0x00, 0x03, 0x04, 0x0B, 0x00,
+	0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x17, 0x00,
+	0x13, 0x06, 0x13, 0x01, 0x0F, 0x00, 0x03, 0x04, 0x0B, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x3F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x0B, 0x01, 0x0B, 0x03, 0x13, 0x06, 0x0B, 0x03, 0x07, 0x00,
+	0x0F, 0x01, 0x03, 0x04, 0x0B, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00,
+	0x1F, 0x01, 0x1F, 0x00, 0x0B, 0x01, 0x0B, 0x03, 0x13, 0x06, 0x0B, 0x03, 0x07, 0x00, 0x0F, 0x01,
+	0x03, 0x04, 0x0B, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x0B, 0x01, 0x0B, 0x03, 0x13, 0x06, 0x0B, 0x03, 0x07, 0x00, 0x0F, 0x01, 0x03, 0x04,
+	0x0B, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00,
+	0x0B, 0x01, 0x0B, 0x03, 0x13, 0x06, 0x0B, 0x03, 0x07, 0x00, 0x0F, 0x01, 0x03, 0x04, 0x0B, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x03, 0x01,
+	0x0F, 0x03, 0x1B, 0x06, 0x0F, 0x03, 0x0F, 0x01, 0x03, 0x04, 0x0B, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x03, 0x01, 0x0F, 0x03, 0x1B, 0x06,
+	0x0F, 0x03, 0x0F, 0x01, 0x03, 0x04, 0x0B, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x03, 0x01, 0x0F, 0x03, 0x1B, 0x06, 0x0F, 0x03, 0x0F, 0x01,
+	0x03, 0x04, 0x0B, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x03, 0x01, 0x0F, 0x03, 0x1B, 0x06, 0x0F, 0x03, 0x0F, 0x01, 0x03, 0x04, 0x0B, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x17, 0x03,
+	0x13, 0x06, 0x17, 0x03, 0x0B, 0x01, 0x03, 0x04, 0x0B, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00,
+	0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x17, 0x03, 0x13, 0x06, 0x17, 0x03, 0x0B, 0x01,
+	0x03, 0x04, 0x0B, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x17, 0x03, 0x13, 0x06, 0x17, 0x03, 0x0B, 0x01, 0x03, 0x04, 0x0B, 0x01, 0x1F, 0x00,
+	0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x17, 0x03, 0x13, 0x06,
+	0x17, 0x03, 0x0B, 0x01, 0x03, 0x04, 0x0B, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x17, 0x03, 0x13, 0x06, 0x17, 0x03, 0x0B, 0x01, 0x03, 0x04,
+	0x0B, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00,
+	0x17, 0x03, 0x13, 0x06, 0x17, 0x03, 0x0B, 0x01, 0x03, 0x04, 0x0B, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x17, 0x03, 0x13, 0x06, 0x17, 0x03,
+	0x0B, 0x01, 0x03, 0x04, 0x0B, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00,
+	0x1F, 0x01, 0x1F, 0x00, 0x17, 0x03, 0x13, 0x06, 0x17, 0x03, 0x0B, 0x01, 0x03, 0x04, 0x0B, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1B, 0x00, 0x23, 0x03,
+	0x03, 0x06, 0x23, 0x03, 0x17, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00,
+	0x1F, 0x01, 0x1B, 0x00, 0x23, 0x03, 0x03, 0x06, 0x23, 0x03, 0x17, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1B, 0x00, 0x23, 0x03, 0x03, 0x06, 0x23, 0x03,
+	0x17, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1B, 0x00,
+	0x23, 0x03, 0x03, 0x06, 0x23, 0x03, 0x17, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x40, 0x43, 0x03, 0x1B, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F,
+	0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x40, 0x43, 0x03, 0x1B, 0x01, 0x1F, 0x00,
+	0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x40, 0x43, 0x03, 0x1B,
+	0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x40,
+	0x43, 0x03, 0x1B, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x40, 0x43, 0x03, 0x1B, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F,
+	0x00, 0x1F, 0x01, 0x1F, 0x00, 0x40, 0x43, 0x03, 0x1B, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00,
+	0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x40, 0x43, 0x03, 0x1B, 0x01, 0x1F, 0x00, 0x1F,
+	0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x40, 0x43, 0x03, 0x1B, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x03, 0x01,
+	0x3B, 0x03, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x03, 0x01, 0x3B, 0x03, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x03, 0x01, 0x3B, 0x03, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x03, 0x01, 0x3B, 0x03, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x3F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x0B, 0x00, 0x2B, 0x03,
+	0x07, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00,
+	0x1F, 0x01, 0x0B, 0x00, 0x2B, 0x03, 0x07, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x0B, 0x00, 0x2B, 0x03, 0x07, 0x01, 0x1F, 0x00,
+	0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x0B, 0x00,
+	0x2B, 0x03, 0x07, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x03, 0x03, 0x1B, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00,
+	0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x03, 0x03, 0x1B, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x03, 0x03, 0x1B, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00,
+	0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x03, 0x03, 0x1B, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x3F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01, 0x1F, 0x00, 0x1F, 0x01,
+	0x1F, 0x00,
+};
+const RleImage winImage = { 320, 240, 7, winImagePalette, winImageData, 7250 };
+
+// screens/lose.txt: 320 x 240, 7 colours, 3127 bytes (2.0% of 16 bpp)
+static const unsigned short loseImagePalette[7] = {
+	0x2104, 0xF800, 0x0000, 0x000F, 0x001F, 0x03EF, 0xFFFF,
+};
+static const uint8_t loseImageData[3127] = {
+	0x68, 0x43, 0x00, 0x07, 0x01, 0x2F, 0x00, 0x17, 0x01, 0x17, 0x00, 0x1F, 0x01, 0x07, 0x00, 0x27,
+	0x01, 0x40, 0x87, 0x00, 0x07, 0x01, 0x2F, 0x00, 0x17, 0x01, 0x17, 0x00, 0x1F, 0x01, 0x07, 0x00,
+	0x27, 0x01, 0x40, 0x87, 0x00, 0x07, 0x01, 0x2F, 0x00, 0x17, 0x01, 0x17, 0x00, 0x1F, 0x01, 0x07,
+	0x00, 0x27, 0x01, 0x40, 0x87, 0x00, 0x07, 0x01, 0x2F, 0x00, 0x17, 0x01, 0x17, 0x00, 0x1F, 0x01,
+	0x07, 0x00, 0x27, 0x01, 0x40, 0x87, 0x00, 0x07, 0x01, 0x03, 0x02, 0x2B, 0x00, 0x17, 0x01, 0x03,
+	0x02, 0x13, 0x00, 0x1F, 0x01, 0x03, 0x02, 0x03, 0x00, 0x27, 0x01, 0x03, 0x02, 0x40, 0x83, 0x00,
+	0x07, 0x01, 0x03, 0x02, 0x2B, 0x00, 0x17, 0x01, 0x03, 0x02, 0x13, 0x00, 0x1F, 0x01, 0x03, 0x02,
+	0x03, 0x00, 0x27, 0x01, 0x03, 0x02, 0x40, 0x83, 0x00, 0x07, 0x01, 0x03, 0x02, 0x2B, 0x00, 0x17,
+	0x01, 0x03, 0x02, 0x13, 0x00, 0x1F, 0x01, 0x03, 0x02, 0x03, 0x00, 0x27, 0x01, 0x03, 0x02, 0x40,
+	0x83, 0x00, 0x07, 0x01, 0x03, 0x02, 0x2B, 0x00, 0x17, 0x01, 0x03, 0x02, 0x13, 0x00, 0x1F, 0x01,
+	0x03, 0x02, 0x03, 0x00, 0x27, 0x01, 0x03, 0x02, 0x40, 0x83, 0x00, 0x07, 0x01, 0x03, 0x02, 0x23,
+	0x00, 0x07, 0x01, 0x03, 0x00, 0x13, 0x02, 0x07, 0x01, 0x07, 0x00, 0x07, 0x01, 0x03, 0x00, 0x1F,
+	0x02, 0x03, 0x00, 0x07, 0x01, 0x23, 0x02, 0x40, 0x83, 0x00, 0x07, 0x01, 0x03, 0x02, 0x23, 0x00,
+	0x07, 0x01, 0x03, 0x00, 0x13, 0x02, 0x07, 0x01, 0x07, 0x00, 0x07, 0x01, 0x03, 0x00, 0x1F, 0x02,
+	0x03, 0x00, 0x07, 0x01, 0x23, 0x02, 0x40, 0x83, 0x00, 0x07, 0x01, 0x03, 0x02, 0x23, 0x00, 0x07,
+	0x01, 0x03, 0x00, 0x13, 0x02, 0x07, 0x01, 0x07, 0x00, 0x07, 0x01, 0x03, 0x00, 0x1F, 0x02, 0x03,
+	0x00, 0x07, 0x01, 0x23, 0x02, 0x40, 0x83, 0x00, 0x07, 0x01, 0x03, 0x02, 0x23, 0x00, 0x07, 0x01,
+	0x03, 0x00, 0x13, 0x02, 0x07, 0x01, 0x07, 0x00, 0x07, 0x01, 0x03, 0x00, 0x1F, 0x02, 0x03, 0x00,
+	0x07, 0x01, 0x23, 0x02, 0x40, 0x83, 0x00, 0x07, 0x01, 0x03, 0x02, 0x23, 0x00, 0x07, 0x01, 0x03,
+	0x02, 0x13, 0x00, 0x07, 0x01, 0x03, 0x02, 0x03, 0x00, 0x07, 0x01, 0x03, 0x02, 0x23, 0x00, 0x07,
+	0x01, 0x03, 0x02, 0x40, 0xA3, 0x00, 0x07, 0x01, 0x03, 0x02, 0x23, 0x00, 0x07, 0x01, 0x03, 0x02,
+	0x13, 0x00, 0x07, 0x01, 0x03, 0x02, 0x03, 0x00, 0x07, 0x01, 0x03, 0x02, 0x23, 0x00, 0x07, 0x01,
+	0x03, 0x02, 0x40, 0xA3, 0x00, 0x07, 0x01, 0x03, 0x02, 0x23, 0x00, 0x07, 0x01, 0x03, 0x02, 0x13,
+	0x00, 0x07, 0x01, 0x03, 0x02, 0x03, 0x00, 0x07, 0x01, 0x03, 0x02, 0x23, 0x00, 0x07, 0x01, 0x03,
+	0x02, 0x40, 0xA3, 0x00, 0x07, 0x01, 0x03, 0x02, 0x23, 0x00, 0x07, 0x01, 0x03, 0x02, 0x13, 0x00,
+	0x07, 0x01, 0x03, 0x02, 0x03, 0x00, 0x07, 0x01, 0x03, 0x02, 0x23, 0x00, 0x07, 0x01, 0x03, 0x02,
+	0x40, 0xA3, 0x00, 0x07, 0x01, 0x03, 0x02, 0x23, 0x00, 0x07, 0x01, 0x03, 0x02, 0x13, 0x00, 0x07,
+	0x01, 0x03, 0x02, 0x03, 0x00, 0x07, 0x01, 0x03, 0x02, 0x23, 0x00, 0x07, 0x01, 0x03, 0x02, 0x40,
+	0xA3, 0x00, 0x07, 0x01, 0x03, 0x02, 0x23, 0x00, 0x07, 0x01, 0x03, 0x02, 0x13, 0x00, 0x07, 0x01,
+	0x03, 0x02, 0x03, 0x00, 0x07, 0x01, 0x03, 0x02, 0x23, 0x00, 0x07, 0x01, 0x03, 0x02, 0x40, 0xA3,
+	0x00, 0x07, 0x01, 0x03, 0x02, 0x23, 0x00, 0x07, 0x01, 0x03, 0x02, 0x13, 0x00, 0x07, 0x01, 0x03,
+	0x02, 0x03, 0x00, 0x07, 0x01, 0x03, 0x02, 0x23, 0x00, 0x07, 0x01, 0x03, 0x02, 0x40, 0xA3, 0x00,
+	0x07, 0x01, 0x03, 0x02, 0x23, 0x00, 0x07, 0x01, 0x03, 0x02, 0x13, 0x00, 0x07, 0x01, 0x03, 0x02,
+	0x03, 0x00, 0x07, 0x01, 0x03, 0x02, 0x23, 0x00, 0x07, 0x01, 0x03, 0x02, 0x40, 0xA3, 0x00, 0x07,
+	0x01, 0x03, 0x02, 0x23, 0x00, 0x07, 0x01, 0x03, 0x02, 0x13, 0x00, 0x07, 0x01, 0x03, 0x02, 0x03,
+	0x00, 0x07, 0x01, 0x03, 0x02, 0x23, 0x00, 0x07, 0x01, 0x03, 0x02, 0x40, 0xA3, 0x00, 0x07, 0x01,
+	0x03, 0x02, 0x23, 0x00, 0x07, 0x01, 0x03, 0x02, 0x13, 0x00, 0x07, 0x01, 0x03, 0x02, 0x03, 0x00,
+	0x07, 0x01, 0x03, 0x02, 0x23, 0x00, 0x07, 0x01, 0x03, 0x02, 0x40, 0xA3, 0x00, 0x07, 0x01, 0x03,
+	0x02, 0x23, 0x00, 0x07, 0x01, 0x03, 0x02, 0x13, 0x00, 0x07, 0x01, 0x03, 0x02, 0x03, 0x00, 0x07,
+	0x01, 0x03, 0x02, 0x23, 0x00, 0x07, 0x01, 0x03, 0x02, 0x40, 0xA3, 0x00, 0x07, 0x01, 0x03, 0x02,
+	0x23, 0x00, 0x07, 0x01, 0x03, 0x02, 0x13, 0x00, 0x07, 0x01, 0x03, 0x02, 0x03, 0x00, 0x07, 0x01,
+	0x03, 0x02, 0x23, 0x00, 0x07, 0x01, 0x03, 0x02, 0x40, 0xA3, 0x00, 0x07, 0x01, 0x03, 0x02, 0x23,
+	0x00, 0x07, 0x01, 0x03, 0x02, 0x13, 0x00, 0x07, 0x01, 0x03, 0x02, 0x07, 0x00, 0x03, 0x02, 0x17,
+	0x01, 0x0F, 0x00, 0x1F, 0x01, 0x40, 0x8F, 0x00, 0x07, 0x01, 0x03, 0x02, 0x23, 0x00, 0x07, 0x01,
+	0x03, 0x02, 0x13, 0x00, 0x07, 0x01, 0x03, 0x02, 0x07, 0x00, 0x03, 0x02, 0x17, 0x01, 0x0F, 0x00,
+	0x1F, 0x01, 0x40, 0x8F, 0x00, 0x07, 0x01, 0x03, 0x02, 0x23, 0x00, 0x07, 0x01, 0x03, 0x02, 0x13,
+	0x00, 0x07, 0x01, 0x03, 0x02, 0x07, 0x00, 0x03, 0x02, 0x17, 0x01, 0x0F, 0x00, 0x1F, 0x01, 0x40,
+	0x8F, 0x00, 0x07, 0x01, 0x03, 0x02, 0x23, 0x00, 0x07, 0x01, 0x03, 0x02, 0x13, 0x00, 0x07, 0x01,
+	0x03, 0x02, 0x07, 0x00, 0x03, 0x02, 0x17, 0x01, 0x0F, 0x00, 0x1F, 0x01, 0x40, 0x8F, 0x00, 0x07,
+	0x01, 0x03, 0x02, 0x23, 0x00, 0x07, 0x01, 0x03, 0x02, 0x13, 0x00, 0x07, 0x01, 0x03, 0x02, 0x0B,
+	0x00, 0x17, 0x01, 0x03, 0x02, 0x0B, 0x00, 0x1F, 0x01, 0x03, 0x02, 0x40, 0x8B, 0x00, 0x07, 0x01,
+	0x03, 0x02, 0x23, 0x00, 0x07, 0x01, 0x03, 0x02, 0x13, 0x00, 0x07, 0x01, 0x03, 0x02, 0x0B, 0x00,
+	0x17, 0x01, 0x03, 0x02, 0x0B, 0x00, 0x1F, 0x01, 0x03, 0x02, 0x40, 0x8B, 0x00, 0x07, 0x01, 0x03,
+	0x02, 0x23, 0x00, 0x07, 0x01, 0x03, 0x02, 0x13, 0x00, 0x07, 0x01, 0x03, 0x02, 0x0B, 0x00, 0x17,
+	0x01, 0x03, 0x02, 0x0B, 0x00, 0x1F, 0x01, 0x03, 0x02, 0x40, 0x8B, 0x00, 0x07, 0x01, 0x03, 0x02,
+	0x23, 0x00, 0x07, 0x01, 0x03, 0x02, 0x13, 0x00, 0x07, 0x01, 0x03, 0x02, 0x0B, 0x00, 0x17, 0x01,
+	0x03, 0x02, 0x0B, 0x00, 0x1F, 0x01, 0x03, 0x02, 0x40, 0x8B, 0x00, 0x07, 0x01, 0x03, 0x02, 0x23,
+	0x00, 0x07, 0x01, 0x03, 0x02, 0x13, 0x00, 0x07, 0x01, 0x03, 0x02, 0x0F, 0x00, 0x13, 0x02, 0x07,
+	0x01, 0x07, 0x00, 0x07, 0x01, 0x1B, 0x02, 0x40, 0x8B, 0x00, 0x07, 0x01, 0x03, 0x02, 0x23, 0x00,
+	0x07, 0x01, 0x03, 0x02, 0x13, 0x00, 0x07, 0x01, 0x03, 0x02, 0x0F, 0x00, 0x13, 0x02, 0x07, 0x01,
+	0x07, 0x00, 0x07, 0x01, 0x1B, 0x02, 0x40, 0x8B, 0x00, 0x07, 0x01, 0x03, 0x02, 0x23, 0x00, 0x07,
+	0x01, 0x03, 0x02, 0x13, 0x00, 0x07, 0x01, 0x03, 0x02, 0x0F, 0x00, 0x13, 0x02, 0x07, 0x01, 0x07,
+	0x00, 0x07, 0x01, 0x1B, 0x02, 0x40, 0x8B, 0x00, 0x07, 0x01, 0x03, 0x02, 0x23, 0x00, 0x07, 0x01,
+	0x03, 0x02, 0x13, 0x00, 0x07, 0x01, 0x03, 0x02, 0x0F, 0x00, 0x13, 0x02, 0x07, 0x01, 0x07, 0x00,
+	0x07, 0x01, 0x1B, 0x02, 0x40, 0x8B, 0x00, 0x07, 0x01, 0x03, 0x02, 0x23, 0x00, 0x07, 0x01, 0x03,
+	0x02, 0x13, 0x00, 0x07, 0x01, 0x03, 0x02, 0x23, 0x00, 0x07, 0x01, 0x03, 0x02, 0x03, 0x00, 0x07,
+	0x01, 0x03, 0x02, 0x40, 0xA3, 0x00, 0x07, 0x01, 0x03, 0x02, 0x23, 0x00, 0x07, 0x01, 0x03, 0x02,
+	0x13, 0x00, 0x07, 0x01, 0x03, 0x02, 0x23, 0x00, 0x07, 0x01, 0x03, 0x02, 0x03, 0x00, 0x07, 0x01,
+	0x03, 0x02, 0x40, 0xA3, 0x00, 0x07, 0x01, 0x03, 0x02, 0x23, 0x00, 0x07, 0x01, 0x03, 0x02, 0x13,
+	0x00, 0x07, 0x01, 0x03, 0x02, 0x23, 0x00, 0x07, 0x01, 0x03, 0x02, 0x03, 0x00, 0x07, 0x01, 0x03,
+	0x02, 0x40, 0xA3, 0x00, 0x07, 0x01, 0x03, 0x02, 0x23, 0x00, 0x07, 0x01, 0x03, 0x02, 0x13, 0x00,
+	0x07, 0x01, 0x03, 0x02, 0x23, 0x00, 0x07, 0x01, 0x03, 0x02, 0x03, 0x00, 0x07, 0x01, 0x03, 0x02,
+	0x40, 0xA3, 0x00, 0x07, 0x01, 0x03, 0x02, 0x23, 0x00, 0x07, 0x01, 0x03, 0x02, 0x13, 0x00, 0x07,
+	0x01, 0x03, 0x02, 0x23, 0x00, 0x07, 0x01, 0x03, 0x02, 0x03, 0x00, 0x07, 0x01, 0x03, 0x02, 0x40,
+	0xA3, 0x00, 0x07, 0x01, 0x03, 0x02, 0x23, 0x00, 0x07, 0x01, 0x03, 0x02, 0x13, 0x00, 0x07, 0x01,
+	0x03, 0x02, 0x23, 0x00, 0x07, 0x01, 0x03, 0x02, 0x03, 0x00, 0x07, 0x01, 0x03, 0x02, 0x40, 0xA3,
+	0x00, 0x07, 0x01, 0x03, 0x02, 0x23, 0x00, 0x07, 0x01, 0x03, 0x02, 0x13, 0x00, 0x07, 0x01, 0x03,
+	0x02, 0x23, 0x00, 0x07, 0x01, 0x03, 0x02, 0x03, 0x00, 0x07, 0x01, 0x03, 0x02, 0x40, 0xA3, 0x00,
+	0x07, 0x01, 0x03, 0x02, 0x23, 0x00, 0x07, 0x01, 0x03, 0x02, 0x13, 0x00, 0x07, 0x01, 0x03, 0x02,
+	0x23, 0x00, 0x07, 0x01, 0x03, 0x02, 0x03, 0x00, 0x07, 0x01, 0x03, 0x02, 0x40, 0xA3, 0x00, 0x07,
+	0x01, 0x03, 0x02, 0x23, 0x00, 0x07, 0x01, 0x03, 0x02, 0x13, 0x00, 0x07, 0x01, 0x03, 0x02, 0x23,
+	0x00, 0x07, 0x01, 0x03, 0x02, 0x03, 0x00, 0x07, 0x01, 0x03, 0x02, 0x40, 0xA3, 0x00, 0x07, 0x01,
+	0x03, 0x02, 0x23, 0x00, 0x07, 0x01, 0x03, 0x02, 0x13, 0x00, 0x07, 0x01, 0x03, 0x02, 0x23, 0x00,
+	0x07, 0x01, 0x03, 0x02, 0x03, 0x00, 0x07, 0x01, 0x03, 0x02, 0x40, 0xA3, 0x00, 0x07, 0x01, 0x03,
+	0x02, 0x23, 0x00, 0x07, 0x01, 0x03, 0x02, 0x13, 0x00, 0x07, 0x01, 0x03, 0x02, 0x23, 0x00, 0x07,
+	0x01, 0x03, 0x02, 0x03, 0x00, 0x07, 0x01, 0x03, 0x02, 0x40, 0xA3, 0x00, 0x07, 0x01, 0x03, 0x02,
+	0x23, 0x00, 0x07, 0x01, 0x03, 0x02, 0x13, 0x00, 0x07, 0x01, 0x03, 0x02, 0x23, 0x00, 0x07, 0x01,
+	0x03, 0x02, 0x03, 0x00, 0x07, 0x01, 0x03, 0x02, 0x40, 0xA3, 0x00, 0x27, 0x01, 0x0B, 0x00, 0x03,
+	0x02, 0x17, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x00, 0x1F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03,
+	0x00, 0x27, 0x01, 0x40, 0x87, 0x00, 0x27, 0x01, 0x0B, 0x00, 0x03, 0x02, 0x17, 0x01, 0x03, 0x00,
+	0x07, 0x02, 0x03, 0x00, 0x1F, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x00, 0x27, 0x01, 0x40, 0x87,
+	0x00, 0x27, 0x01, 0x0B, 0x00, 0x03, 0x02, 0x17, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x00, 0x1F,
+	0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x00, 0x27, 0x01, 0x40, 0x87, 0x00, 0x27, 0x01, 0x0B, 0x00,
+	0x03, 0x02, 0x17, 0x01, 0x03, 0x00, 0x07, 0x02, 0x03, 0x00, 0x1F, 0x01, 0x03, 0x00, 0x07, 0x02,
+	0x03, 0x00, 0x27, 0x01, 0x40, 0x87, 0x00, 0x27, 0x01, 0x03, 0x02, 0x0B, 0x00, 0x17, 0x01, 0x03,
+	0x02, 0x0B, 0x00, 0x1F, 0x01, 0x03, 0x02, 0x0B, 0x00, 0x27, 0x01, 0x03, 0x02, 0x40, 0x83, 0x00,
+	0x27, 0x01, 0x03, 0x02, 0x0B, 0x00, 0x17, 0x01, 0x03, 0x02, 0x0B, 0x00, 0x1F, 0x01, 0x03, 0x02,
+	0x0B, 0x00, 0x27, 0x01, 0x03, 0x02, 0x40, 0x83, 0x00, 0x27, 0x01, 0x03, 0x02, 0x0B, 0x00, 0x17,
+	0x01, 0x03, 0x02, 0x0B, 0x00, 0x1F, 0x01, 0x03, 0x02, 0x0B, 0x00, 0x27, 0x01, 0x03, 0x02, 0x40,
+	0x83, 0x00, 0x27, 0x01, 0x03, 0x02, 0x0B, 0x00, 0x17, 0x01, 0x03, 0x02, 0x0B, 0x00, 0x1F, 0x01,
+	0x03, 0x02, 0x0B, 0x00, 0x27, 0x01, 0x03, 0x02, 0x40, 0x87, 0x00, 0x27, 0x02, 0x0F, 0x00, 0x17,
+	0x02, 0x0F, 0x00, 0x1F, 0x02, 0x0F, 0x00, 0x27, 0x02, 0x40, 0x87, 0x00, 0x27, 0x02, 0x0F, 0x00,
+	0x17, 0x02, 0x0F, 0x00, 0x1F, 0x02, 0x0F, 0x00, 0x27, 0x02, 0x40, 0x87, 0x00, 0x27, 0x02, 0x0F,
+	0x00, 0x17, 0x02, 0x0F, 0x00, 0x1F, 0x02, 0x0F, 0x00, 0x27, 0x02, 0x40, 0x87, 0x00, 0x27, 0x02,
+	0x0F, 0x00, 0x17, 0x02, 0x0F, 0x00, 0x1F, 0x02, 0x0F, 0x00, 0x27, 0x02, 0x7F, 0xFF, 0x00, 0x55,
+	0x3F, 0x00, 0x40, 0x53, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03,
+	0x04, 0x40, 0x83, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04,
+	0x40, 0x83, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x40,
+	0x83, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x40, 0x47,
+	0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03,
+	0x03, 0x04, 0x27, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04,
+	0x40, 0x57, 0x03, 0x03, 0x04, 0x27, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x40, 0x57,
+	0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x27, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03,
+	0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x40, 0x47, 0x03, 0x03, 0x04,
+	0x40, 0x57, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x40, 0x83, 0x03, 0x03, 0x04, 0x40,
+	0x57, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x40, 0x83, 0x03, 0x03, 0x04, 0x40, 0x57,
+	0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x40, 0x83, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03,
+	0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x40, 0xA3, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03,
+	0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x40, 0x83, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04,
+	0x40, 0x57, 0x03, 0x03, 0x04, 0x40, 0x83, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x40,
+	0x57, 0x03, 0x03, 0x04, 0x40, 0x83, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x40, 0x57,
+	0x03, 0x03, 0x04, 0x40, 0x47, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x23, 0x03, 0x03,
+	0x05, 0x2F, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x27, 0x03, 0x03, 0x04, 0x40, 0x57,
+	0x03, 0x03, 0x04, 0x23, 0x03, 0x03, 0x05, 0x2F, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04,
+	0x27, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x23, 0x03, 0x03, 0x05, 0x2F, 0x03, 0x03,
+	0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x27, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x23,
+	0x03, 0x03, 0x05, 0x2F, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x40, 0x47, 0x03, 0x03,
+	0x04, 0x40, 0x43, 0x03, 0x0B, 0x05, 0x03, 0x06, 0x2B, 0x05, 0x33, 0x03, 0x03, 0x04, 0x40, 0x83,
+	0x03, 0x03, 0x04, 0x40, 0x43, 0x03, 0x0B, 0x05, 0x03, 0x06, 0x2B, 0x05, 0x33, 0x03, 0x03, 0x04,
+	0x40, 0x83, 0x03, 0x03, 0x04, 0x40, 0x43, 0x03, 0x0B, 0x05, 0x03, 0x06, 0x2B, 0x05, 0x33, 0x03,
+	0x03, 0x04, 0x40, 0x83, 0x03, 0x03, 0x04, 0x40, 0x43, 0x03, 0x0B, 0x05, 0x03, 0x06, 0x2B, 0x05,
+	0x33, 0x03, 0x03, 0x04, 0x40, 0x47, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x17, 0x03,
+	0x13, 0x05, 0x0B, 0x06, 0x33, 0x05, 0x40, 0x47, 0x03, 0x03, 0x04, 0x27, 0x03, 0x03, 0x04, 0x40,
+	0x57, 0x03, 0x03, 0x04, 0x17, 0x03, 0x13, 0x05, 0x0B, 0x06, 0x33, 0x05, 0x40, 0x47, 0x03, 0x03,
+	0x04, 0x27, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x17, 0x03, 0x13, 0x05, 0x0B, 0x06,
+	0x33, 0x05, 0x40, 0x47, 0x03, 0x03, 0x04, 0x27, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04,
+	0x17, 0x03, 0x13, 0x05, 0x0B, 0x06, 0x33, 0x05, 0x40, 0x47, 0x03, 0x03, 0x04, 0x40, 0x47, 0x03,
+	0x03, 0x04, 0x40, 0x4F, 0x03, 0x13, 0x05, 0x13, 0x06, 0x33, 0x05, 0x07, 0x03, 0x03, 0x04, 0x40,
+	0x57, 0x03, 0x03, 0x04, 0x27, 0x03, 0x03, 0x04, 0x40, 0x4F, 0x03, 0x13, 0x05, 0x13, 0x06, 0x33,
+	0x05, 0x07, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x27, 0x03, 0x03, 0x04, 0x40, 0x4F,
+	0x03, 0x13, 0x05, 0x13, 0x06, 0x33, 0x05, 0x07, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04,
+	0x27, 0x03, 0x03, 0x04, 0x40, 0x4F, 0x03, 0x13, 0x05, 0x13, 0x06, 0x33, 0x05, 0x07, 0x03, 0x03,
+	0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x40, 0x47, 0x03, 0x03, 0x04, 0x2B, 0x03, 0x1B, 0x05, 0x0B,
+	0x06, 0x3B, 0x05, 0x23, 0x03, 0x03, 0x04, 0x40, 0x83, 0x03, 0x03, 0x04, 0x2B, 0x03, 0x1B, 0x05,
+	0x0B, 0x06, 0x3B, 0x05, 0x23, 0x03, 0x03, 0x04, 0x40, 0x83, 0x03, 0x03, 0x04, 0x2B, 0x03, 0x1B,
+	0x05, 0x0B, 0x06, 0x3B, 0x05, 0x23, 0x03, 0x03, 0x04, 0x40, 0x83, 0x03, 0x03, 0x04, 0x2B, 0x03,
+	0x1B, 0x05, 0x0B, 0x06, 0x3B, 0x05, 0x23, 0x03, 0x03, 0x04, 0x40, 0x47, 0x03, 0x03, 0x04, 0x40,
+	0x57, 0x03, 0x03, 0x04, 0x0F, 0x03, 0x1B, 0x05, 0x03, 0x06, 0x3B, 0x05, 0x40, 0x47, 0x03, 0x03,
+	0x04, 0x27, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x0F, 0x03, 0x1B, 0x05, 0x03, 0x06,
+	0x3B, 0x05, 0x40, 0x47, 0x03, 0x03, 0x04, 0x27, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04,
+	0x0F, 0x03, 0x1B, 0x05, 0x03, 0x06, 0x3B, 0x05, 0x40, 0x47, 0x03, 0x03, 0x04, 0x27, 0x03, 0x03,
+	0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x0F, 0x03, 0x1B, 0x05, 0x03, 0x06, 0x3B, 0x05, 0x40, 0x47,
+	0x03, 0x03, 0x04, 0x40, 0x47, 0x03, 0x03, 0x04, 0x40, 0x4F, 0x03, 0x40, 0x53, 0x05, 0x0F, 0x03,
+	0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x27, 0x03, 0x03, 0x04, 0x40, 0x4F, 0x03, 0x40, 0x53,
+	0x05, 0x0F, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x27, 0x03, 0x03, 0x04, 0x40, 0x4F,
+	0x03, 0x40, 0x53, 0x05, 0x0F, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x27, 0x03, 0x03,
+	0x04, 0x40, 0x4F, 0x03, 0x40, 0x53, 0x05, 0x0F, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04,
+	0x40, 0x47, 0x03, 0x03, 0x04, 0x3B, 0x03, 0x3B, 0x05, 0x3B, 0x03, 0x03, 0x04, 0x40, 0x83, 0x03,
+	0x03, 0x04, 0x3B, 0x03, 0x3B, 0x05, 0x3B, 0x03, 0x03, 0x04, 0x40, 0x83, 0x03, 0x03, 0x04, 0x3B,
+	0x03, 0x3B, 0x05, 0x3B, 0x03, 0x03, 0x04, 0x40, 0x83, 0x03, 0x03, 0x04, 0x3B, 0x03, 0x3B, 0x05,
+	0x3B, 0x03, 0x03, 0x04, 0x40, 0x47, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x37, 0x03,
+	0x03, 0x05, 0x1B, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x27, 0x03, 0x03, 0x04, 0x40,
+	0x57, 0x03, 0x03, 0x04, 0x37, 0x03, 0x03, 0x05, 0x1B, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03,
+	0x04, 0x27, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x37, 0x03, 0x03, 0x05, 0x1B, 0x03,
+	0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x27, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04,
+	0x37, 0x03, 0x03, 0x05, 0x1B, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x40, 0x47, 0x03,
+	0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03,
+	0x04, 0x27, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x40,
+	0x57, 0x03, 0x03, 0x04, 0x27, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03,
+	0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x27, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04,
+	0x40, 0x57, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x40, 0x47, 0x03, 0x03, 0x04, 0x40,
+	0x57, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x40, 0x83, 0x03, 0x03, 0x04, 0x40, 0x57,
+	0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x40, 0x83, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03,
+	0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x40, 0x83, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03,
+	0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x40, 0x47, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04,
+	0x40, 0x57, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x27, 0x03, 0x03, 0x04, 0x40, 0x57,
+	0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x27, 0x03, 0x03,
+	0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04,
+	0x27, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x40, 0x57,
+	0x03, 0x03, 0x04, 0x40, 0x47, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03,
+	0x03, 0x04, 0x40, 0x83, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03,
+	0x04, 0x40, 0x83, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04,
+	0x40, 0x83, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x40,
+	0xA3, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x40, 0x83,
+	0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x40, 0x83, 0x03,
+	0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x40, 0x83, 0x03, 0x03,
+	0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x40, 0x47, 0x03, 0x03, 0x04,
+	0x40, 0x57, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x27,
+	0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03,
+	0x03, 0x04, 0x27, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04,
+	0x40, 0x57, 0x03, 0x03, 0x04, 0x27, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x40, 0x57,
+	0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x40, 0x47, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03,
+	0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x40, 0x83, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03,
+	0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x40, 0x83, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04,
+	0x40, 0x57, 0x03, 0x03, 0x04, 0x40, 0x83, 0x03, 0x03, 0x04, 0x40, 0x57, 0x03, 0x03, 0x04, 0x40,
+	0x57, 0x03, 0x03, 0x04, 0x40, 0x53, 0x03,
+};
+const RleImage loseImage = { 320, 240, 7, loseImagePalette, loseImageData, 3127 };
@@ -0,0 +1,188 @@
+#include "script.h"
+
+#include <stdio.h>
+#include <stddef.h>
+#include <cmsis_os2.h>
+
+// Static frame pool; scripts are never allocated at runtime
+static Script scriptPool[MAX_SCRIPTS];
+
+// Number of scheduler passes so far; the time base of everything that runs on the script thread
+static uint32_t scriptTicks = 0;
+
+// Run the passes back to back instead of one per SCRIPT_TICK (trace replays)
+static bool fastForward = false;
+
+// Frame budget; no meter means no budget, and nothing is deferred
+static FrameMeter frameMeter = NULL;
+static uint32_t frameBudget = 0;
+static uint32_t frameBudgetMicros = 0;
+static uint32_t goodFrames = 0;
+
+FrameStats frameStats = { .quality = FRAME_QUALITY_MAX, .minQuality = FRAME_QUALITY_MAX };
+
+
+// Claims a free slot and schedules the script for the next tick. Returns NULL if the pool is full.
+// Only call this before the kernel starts or from inside a script, since the pool is owned by the script thread.
+Script *startScript(ScriptFunc run, void *ctx) {
+	for (int i = 0; i < MAX_SCRIPTS; ++i) {
+		if (!scriptPool[i].active) {
+			scriptPool[i].run = run;
+			scriptPool[i].ctx = ctx;
+			scriptPool[i].resume = 0;
+			scriptPool[i].wait = 0;
+			scriptPool[i].started = scriptTicks;
+			scriptPool[i].active = true;
+			scriptPool[i].cost = 0;
+			scriptPool[i].deferred = 0;
+			return &scriptPool[i];
+		}
+	}
+
+	return NULL;
+}
+
+void stopScript(Script *s) {
+	if (s != NULL) {
+		s->active = false;
+	}
+}
+
+bool scriptRunning(Script *s) {
+	return s != NULL && s->active;
+}
+
+// Measures the cost of the frame with `meter` and compares it with `budget`, and its time with `budgetMicros`.
+// Call before the kernel starts.
+void setFrameBudget(FrameMeter meter, uint32_t budget, uint32_t budgetMicros) {
+	frameMeter = meter;
+	frameBudget = budget;
+	frameBudgetMicros = budgetMicros;
+}
+
+// Makes a script deferrable, with the most a resume of it can cost
+void setScriptCost(Script *s, uint32_t cost) {
+	if (s != NULL) {
+		s->cost = cost;
+	}
+}
+
+// Level of detail for deferrable work, 1 to FRAME_QUALITY_MAX
+uint32_t frameQuality(void) {
+	return frameStats.quality;
+}
+
+// Books a finished frame and adapts the quality: down a level on an overrun, up one after a run of good frames
+static void endFrame(uint32_t cost, uint32_t micros) {
+	bool over = cost > frameBudget || (frameBudgetMicros > 0 && micros > frameBudgetMicros);
+
+	frameStats.frames++;
+	frameStats.totalCost += cost;
+	if (cost > frameStats.maxCost) {
+		frameStats.maxCost = cost;
+	}
+	if (micros > frameStats.maxMicros) {
+		frameStats.maxMicros = micros;
+	}
+	if (cost > frameBudget) {
+		frameStats.overruns++;
+	}
+	if (frameBudgetMicros > 0 && micros > frameBudgetMicros) {
+		frameStats.late++;
+	}
+
+	if (over) {
+		goodFrames = 0;
+		if (frameStats.quality > 1) {
+			frameStats.quality--;
+		}
+		if (frameStats.quality < frameStats.minQuality) {
+			frameStats.minQuality = frameStats.quality;
+		}
+	} else if (++goodFrames >= FRAME_QUALITY_RECOVER) {
+		goodFrames = 0;
+		if (frameStats.quality < FRAME_QUALITY_MAX) {
+			frameStats.quality++;
+		}
+	}
+}
+
+// Resumes every active script once: the ones without a cost first, then the deferrable ones that fit in the
+// frame. Kept separate from runScripts so the same scripts can be stepped deterministically without the kernel.
+void stepScripts(void) {
+	uint32_t startCost = 0, startTime = 0, spent;
+
+	scriptTicks++;
+	if (frameMeter != NULL) {
+		startCost = frameMeter();
+		startTime = osKernelGetSysTimerCount();
+	}
+
+	for (int deferrable = 0; deferrable <= 1; ++deferrable) {
+		for (int i = 0; i < MAX_SCRIPTS; ++i) {
+			Script *s = &scriptPool[i];
+
+			// Started during this pass by a script in an earlier slot: its first resume is on the next pass
+			if (!s->active || (s->cost != 0) != deferrable || s->started == scriptTicks) {
+				continue;
+			}
+
+			if (s->wait > 0) {
+				s->wait--;
+				continue;
+			}
+
+			spent = (frameMeter != NULL) ? frameMeter() - startCost : 0;
+			if (deferrable && spent > 0 && spent + s->cost > frameBudget) {
+				if (s->deferred < FRAME_MAX_DEFER) {
+					s->deferred++;
+					frameStats.deferred++;
+					continue;
+				}
+				frameStats.forced++;
+			}
+			s->deferred = 0;
+
+			if (!s->run(s)) {
+				s->active = false;
+			}
+		}
+	}
+
+	if (frameMeter != NULL) {
+		endFrame(frameMeter() - startCost,
+		         (uint32_t)((uint64_t)(osKernelGetSysTimerCount() - startTime) * 1000000 / osKernelGetSysTimerFreq()));
+	}
+}
+
+// Script tick of the pass that is running
+uint32_t currentScriptTick(void) {
+	return scriptTicks;
+}
+
+void setScriptFastForward(bool enabled) {
+	fastForward = enabled;
+}
+
+void printFrameStats(void) {
+	uint32_t avg = (frameStats.frames > 0) ? (uint32_t)(frameStats.totalCost / frameStats.frames) : 0;
+
+	printf("frames: %u budget %u avg %u max %u over %u, %u us max %u late %u\n", frameStats.frames, frameBudget,
+	       avg, frameStats.maxCost, frameStats.overruns, frameBudgetMicros, frameStats.maxMicros, frameStats.late);
+	printf("deferred: %u forced %u quality %u min %u\n", frameStats.deferred, frameStats.forced,
+	       frameStats.quality, frameStats.minQuality);
+}
+
+// -->> SCRIPT THREAD <<--
+// The only thread that runs game sequences (ball flight, teleport, end of game)
+void runScripts(void *args) {
+	while (1) {
+		stepScripts();
+
+		if (fastForward) {
+			osThreadYield();
+		} else {
+			osDelay(SCRIPT_TICK);
+		}
+	}
+}
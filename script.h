@@ -0,0 +1,89 @@
+#ifndef SCRIPT_SCHEDULER
+#define SCRIPT_SCHEDULER
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Stackless game scripts. A script is a plain function that is resumed once per scheduler tick from the
+// single script thread (runScripts). Scripts cannot keep anything in locals across a yield, so all of
+// their state lives in the Script slot (ctx) or in statics, which is what lets every sequence share one stack.
+//
+//   bool myScript(Script *s) {
+//     SCRIPT_BEGIN(s);
+//     ...
+//     SCRIPT_NEXT_TICK(s);      // resume here on the next tick
+//     ...
+//     SCRIPT_END(s);
+//   }
+
+// Maximum number of scripts that can be alive at the same time
+#define MAX_SCRIPTS 7
+
+// Number of RTX ticks between two scheduler passes
+#define SCRIPT_TICK 1U
+
+// Frame budget. A frame is one scheduler pass. Scripts run in two groups: the ones without a cost first (the
+// sprite moves, which are never held back), then the deferrable ones, given a worst-case cost with
+// setScriptCost (HUD, preview). A deferrable script is only resumed if that cost still fits in what is left of
+// the frame's budget, or nothing has been spent yet; otherwise it waits for the next frame, at most
+// FRAME_MAX_DEFER frames in a row.
+// Cost is whatever the meter counts, e.g. LCD SPI bytes. Frames that go over the budget, in cost or in time,
+// lower the frame quality, which the deferrable scripts use to do less; a run of frames within budget raises it.
+#define FRAME_MAX_DEFER 20
+#define FRAME_QUALITY_MAX 4
+#define FRAME_QUALITY_RECOVER 200   // frames within budget before the quality goes back up a level
+
+typedef uint32_t (*FrameMeter)(void);
+
+typedef struct {
+	uint32_t frames;
+	uint32_t overruns;    // frames that cost more than the budget
+	uint32_t late;        // frames that took longer than the time budget
+	uint32_t maxCost;
+	uint32_t maxMicros;
+	uint64_t totalCost;
+	uint32_t deferred;    // deferrable script resumes put off to a later frame
+	uint32_t forced;      // resumes that ran over the budget after FRAME_MAX_DEFER deferrals
+	uint32_t quality;
+	uint32_t minQuality;
+} FrameStats;
+
+extern FrameStats frameStats;
+
+typedef struct Script Script;
+
+// Returns true while the script wants to be resumed again, false once it has finished
+typedef bool (*ScriptFunc)(Script *s);
+
+struct Script {
+	ScriptFunc run;
+	void *ctx;
+
+	uint32_t resume;  // line to resume from, 0 = start
+	uint32_t wait;    // ticks left before the next resume
+	uint32_t started; // pass it was started in; it is first resumed on the one after
+	bool active;
+
+	uint32_t cost;      // worst cost of a resume, 0 if it is never deferred
+	uint32_t deferred;  // frames it has been deferred in a row
+};
+
+#define SCRIPT_BEGIN(s)        switch ((s)->resume) { case 0:
+#define SCRIPT_NEXT_TICK(s)    do { (s)->resume = __LINE__; return true; case __LINE__:; } while (0)
+#define SCRIPT_WAIT_TICKS(s, n) do { (s)->wait = (n); SCRIPT_NEXT_TICK(s); } while (0)
+#define SCRIPT_END(s)          } (s)->resume = 0; return false
+
+Script *startScript(ScriptFunc run, void *ctx);
+void stopScript(Script *s);
+bool scriptRunning(Script *s);
+void stepScripts(void);
+uint32_t currentScriptTick(void);
+void setScriptFastForward(bool enabled);
+void runScripts(void *args);
+
+void setFrameBudget(FrameMeter meter, uint32_t budget, uint32_t budgetMicros);
+void setScriptCost(Script *s, uint32_t cost);
+uint32_t frameQuality(void);
+void printFrameStats(void);
+
+#endif
@@ -0,0 +1,84 @@
+#include "service.h"
+
+#include <stdio.h>
+#include <stddef.h>
+#include "RTX_Config.h"
+
+#if OS_TIMER_CB_QUEUE < MAX_SERVICES
+#error "MAX_SERVICES exceeds OS_TIMER_CB_QUEUE; raise the timer callback queue in RTX_Config.h"
+#endif
+
+static Service services[MAX_SERVICES];
+static int serviceCount = 0;
+
+
+static void serviceCallback(void *arg) {
+	Service *service = arg;
+	uint32_t now = osKernelGetTickCount();
+
+	// Jitter is how far this run is from one period after the previous one
+	if (service->runs > 0) {
+		int32_t late = (int32_t)(now - (service->lastTick + service->period));
+		uint32_t jitter = (late < 0) ? -late : late;
+
+		service->totalJitter += jitter;
+		if (jitter > service->maxJitter) {
+			service->maxJitter = jitter;
+		}
+	}
+
+	service->lastTick = now;
+	service->runs++;
+
+	service->run();
+}
+
+// Creates the timer for a service. Must be called after osKernelInitialize. Returns NULL if the table is full.
+Service *registerService(const char *name, ServiceFunc run, uint32_t period) {
+	if (serviceCount >= MAX_SERVICES) {
+		return NULL;
+	}
+
+	Service *service = &services[serviceCount];
+	service->name = name;
+	service->run = run;
+	service->period = period;
+	service->runs = 0;
+	service->maxJitter = 0;
+	service->totalJitter = 0;
+
+	service->timer = osTimerNew(serviceCallback, osTimerPeriodic, service, NULL);
+	if (service->timer == NULL) {
+		return NULL;
+	}
+
+	serviceCount++;
+	return service;
+}
+
+// Starts every registered service
+bool startServices(void) {
+	bool ok = true;
+
+	for (int i = 0; i < serviceCount; ++i) {
+		ok &= osTimerStart(services[i].timer, services[i].period) == osOK;
+	}
+
+	return ok;
+}
+
+void stopService(Service *service) {
+	if (service != NULL) {
+		osTimerStop(service->timer);
+	}
+}
+
+void printServiceStats(void) {
+	for (int i = 0; i < serviceCount; ++i) {
+		Service *service = &services[i];
+		uint32_t avg = (service->runs > 1) ? service->totalJitter / (service->runs - 1) : 0;
+
+		printf("%s: period %u runs %u jitter avg %u max %u\n", service->name, service->period,
+		       service->runs, avg, service->maxJitter);
+	}
+}
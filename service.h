@@ -0,0 +1,36 @@
+#ifndef PERIODIC_SERVICE
+#define PERIODIC_SERVICE
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <cmsis_os2.h>
+
+// Periodic services run from RTX software timers instead of owning a thread and a stack.
+// Callbacks execute on the RTX timer thread, so they must be short and must not block.
+
+// RTX queues expired timer callbacks in a queue of OS_TIMER_CB_QUEUE entries (RTX_Config.h).
+// If more services expire in the same tick than fit in the queue, callbacks are lost, so never register more
+// (service.c checks this against RTX_Config.h).
+#define MAX_SERVICES 4
+
+typedef void (*ServiceFunc)(void);
+
+typedef struct {
+	const char *name;
+	ServiceFunc run;
+	uint32_t period;      // in kernel ticks
+	osTimerId_t timer;
+
+	// Stats, updated on every run
+	uint32_t lastTick;
+	uint32_t runs;
+	uint32_t maxJitter;   // worst distance from the expected tick, in ticks
+	uint32_t totalJitter;
+} Service;
+
+Service *registerService(const char *name, ServiceFunc run, uint32_t period);
+bool startServices(void);
+void stopService(Service *service);
+void printServiceStats(void);
+
+#endif
@@ -0,0 +1,50 @@
+#include "snapshot.h"
+
+#include <string.h>
+
+extern Ball *golfBall;
+extern Environment *hole;
+extern Environment *teleporter;
+
+// Seqlock over two copies of the snapshot (a "latch"). The writer bumps the sequence before each copy it rewrites,
+// and the low bit of the sequence tells readers which copy is not being written. A reader therefore never waits
+// on a half-written snapshot; it only retries if the writer finished another update while it was copying.
+static volatile uint32_t snapshotSeq = 0;
+static GameSnapshot snapshots[2];
+
+
+static void fillSnapshot(GameSnapshot *snap) {
+	snap->ball = golfBall->pos;
+	snap->xVelocity = golfBall->xVelocity;
+	snap->yVelocity = golfBall->yVelocity;
+	snap->direction = golfBall->direction;
+	snap->power = golfBall->power;
+
+	snap->hole = hole->pos;
+	snap->teleporter = teleporter->pos;
+}
+
+// MUTEX: ballMutex must be held by the caller, which is what makes this the single writer
+void publishSnapshot(void) {
+	snapshotSeq++;             // odd: readers use copy 1 while copy 0 is rewritten
+	__DMB();
+	fillSnapshot(&snapshots[0]);
+	__DMB();
+
+	snapshotSeq++;             // even: readers use copy 0 while copy 1 is rewritten
+	__DMB();
+	fillSnapshot(&snapshots[1]);
+	__DMB();
+}
+
+// Lock-free; safe from any thread
+void readSnapshot(GameSnapshot *out) {
+	uint32_t seq;
+
+	do {
+		seq = snapshotSeq;
+		__DMB();
+		memcpy(out, (const void *)&snapshots[seq & 1], sizeof(GameSnapshot));
+		__DMB();
+	} while (seq != snapshotSeq);
+}
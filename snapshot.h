@@ -0,0 +1,22 @@
+#ifndef GAME_SNAPSHOT
+#define GAME_SNAPSHOT
+
+#include "gameLogic.h"
+
+// Consistent copy of the Ball and Environment state for threads that only need to read it.
+// Writers already serialise on ballMutex, so there is exactly one writer at a time; readers never take a lock.
+typedef struct {
+	Pos ball;
+	int xVelocity;
+	int yVelocity;
+	double direction;
+	uint32_t power;
+
+	Pos hole;
+	Pos teleporter;
+} GameSnapshot;
+
+void publishSnapshot(void);
+void readSnapshot(GameSnapshot *out);
+
+#endif
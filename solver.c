@@ -0,0 +1,307 @@
+#include "solver.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define NUM_POWERS (SHOT_MAX_POWER - SHOT_MIN_POWER + 1)
+
+// Memo grid over the course, one bit per SOLVER_CELL x SOLVER_CELL cell
+#define GRID_W (COURSE_WIDTH / SOLVER_CELL + 1)
+#define GRID_H (COURSE_HEIGHT / SOLVER_CELL + 1)
+
+// Root plus one capped level per stroke that can still be followed by another one
+#define MAX_NODES (1 + (SOLVER_MAX_STROKES - 1) * SOLVER_MAX_NODES)
+
+typedef struct {
+	Pos pos;
+	uint32_t dist;     // squared distance to the hole
+	int16_t parent;    // -1 for the root
+	int16_t angle;
+	uint8_t power;
+} Node;
+
+static Node nodes[MAX_NODES];
+static uint8_t visited[(GRID_W * GRID_H + 7) / 8];
+
+// Largest distance a shot of each power can travel along each axis. The ball moves at most |v| per step and
+// friction takes the same fraction off |v| every step on the slipperiest terrain of the course, so this bounds
+// the displacement whatever the bounces, edge clamps and other terrains do.
+static int reachX[NUM_POWERS];
+static int reachY[NUM_POWERS];
+static uint32_t reachFriction = 0;     // friction the bounds were computed for, 0: none yet
+
+
+// Lowest friction on the course
+static uint32_t slipperiest(const SolverConfig *cfg) {
+	uint32_t friction = FRICTION_FAIRWAY;
+
+	if (cfg->course != NULL) {
+		for (int t = 0; t < 4; ++t) {
+			if ((cfg->course->header->terrains & (1 << t)) && TERRAIN_FRICTION[t] < friction) {
+				friction = TERRAIN_FRICTION[t];
+			}
+		}
+	}
+	return friction;
+}
+
+static void computeReach(uint32_t friction) {
+	for (int p = 0; p < NUM_POWERS; ++p) {
+		reachX[p] = 0;
+		reachY[p] = 0;
+
+		for (int a = 0; a < SHOT_NUM_ANGLES; ++a) {
+			int vx, vy, sx = 0, sy = 0;
+
+			launchVelocity(a, SHOT_MIN_POWER + p, &vx, &vy);
+			while (!ballStopped(vx, vy)) {
+				sx += abs(velocityPixels(vx));
+				sy += abs(velocityPixels(vy));
+				vx = applyFriction(vx, friction);
+				vy = applyFriction(vy, friction);
+			}
+
+			if (sx > reachX[p]) reachX[p] = sx;
+			if (sy > reachY[p]) reachY[p] = sy;
+		}
+	}
+
+	reachFriction = friction;
+}
+
+// True if the hole can still be touched from `pos` with `strokes` shots of at most `power`
+static bool canReach(const SolverConfig *cfg, Pos pos, int strokes, uint32_t power) {
+	int p = power - SHOT_MIN_POWER;
+	int dx = abs(cfg->hole.x - pos.x) - SPRITE_COLS * SPRITE_SCALE;
+	int dy = abs(cfg->hole.y - pos.y) - ((cfg->ballSize > cfg->holeSize) ? cfg->ballSize : cfg->holeSize) * SPRITE_SCALE;
+
+	return dx <= strokes * reachX[p] && dy <= strokes * reachY[p];
+}
+
+static uint32_t distToHole(const SolverConfig *cfg, Pos pos) {
+	int dx = pos.x - cfg->hole.x;
+	int dy = pos.y - cfg->hole.y;
+	return dx * dx + dy * dy;
+}
+
+// Marks the memo cell of `pos`; returns false if it was already taken
+static bool visit(Pos pos) {
+	int cx = (pos.x < 0 ? 0 : pos.x) / SOLVER_CELL;
+	int cy = (pos.y < 0 ? 0 : pos.y) / SOLVER_CELL;
+	int cell;
+
+	if (cx >= GRID_W) cx = GRID_W - 1;
+	if (cy >= GRID_H) cy = GRID_H - 1;
+	cell = cy * GRID_W + cx;
+
+	if (visited[cell >> 3] & (1 << (cell & 7))) {
+		return false;
+	}
+	visited[cell >> 3] |= 1 << (cell & 7);
+	return true;
+}
+
+// Walks from a node back to the root and writes the shots in playing order
+static void buildPlan(int node, Shot last, bool withLast, ShotPlan *plan) {
+	int count = 0;
+
+	for (int n = node; nodes[n].parent >= 0; n = nodes[n].parent) {
+		count++;
+	}
+	plan->strokes = count + (withLast ? 1 : 0);
+
+	for (int n = node, i = count - 1; nodes[n].parent >= 0; n = nodes[n].parent, --i) {
+		plan->shots[i].angle = nodes[n].angle;
+		plan->shots[i].power = nodes[n].power;
+	}
+	if (withLast) {
+		plan->shots[count] = last;
+	}
+}
+
+// The node of the search closest to the hole, the root included
+static int closestNode(int count) {
+	int best = 0;
+
+	for (int n = 1; n < count; ++n) {
+		if (nodes[n].dist < nodes[best].dist) {
+			best = n;
+		}
+	}
+	return best;
+}
+
+// How far, in degrees, a shot at `angle` leaves from the direction `toHole`; 0 to 180
+static int aimError(int toHole, int32_t angle) {
+	int error = abs(shotHeadingDegrees(angle) - toHole);
+
+	return (error > 180) ? 360 - error : error;
+}
+
+// For when the search found no spot closer than the ball: the angles in order of how nearly they point at the
+// hole, each at the highest power whose shot neither ends in water nor teleports. Returns false if no shot is legal.
+static bool fallbackShot(const SolverConfig *cfg, Pos ball, Shot *shot) {
+	int toHole = directionDegrees(ball, cfg->hole);
+	int lastError = 0;
+	int32_t lastAngle = -1;
+
+	for (int tried = 0; tried < SHOT_NUM_ANGLES; ++tried) {
+		int32_t angle = -1;
+		int error = 0;
+
+		// Next angle up the order (error, then angle), without storing the order
+		for (int32_t a = 0; a < SHOT_NUM_ANGLES; ++a) {
+			int e = aimError(toHole, a);
+			bool after = lastAngle < 0 || e > lastError || (e == lastError && a > lastAngle);
+
+			if (after && (angle < 0 || e < error)) {
+				angle = a;
+				error = e;
+			}
+		}
+		lastAngle = angle;
+		lastError = error;
+
+		for (uint32_t power = SHOT_MAX_POWER; power >= SHOT_MIN_POWER; --power) {
+			Pos end = ball;
+			ShotOutcome outcome;
+
+			shot->angle = angle;
+			shot->power = power;
+			outcome = simulateShot(cfg, &end, *shot);
+			if (outcome == SHOT_STOPPED || outcome == SHOT_HOLED) {
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+// Plays one shot on a copy of the course rules: physics step, then water, teleporter and hole, like the game scripts
+ShotOutcome simulateShot(const SolverConfig *cfg, Pos *ball, Shot shot) {
+	int vx, vy;
+
+	launchVelocity(shot.angle, shot.power, &vx, &vy);
+	while (!ballStopped(vx, vy)) {
+		stepCourse(cfg->course, ball, &vx, &vy);
+
+		if (cfg->course != NULL) {
+			if (courseHazardAt(cfg->course, *ball)) {
+				return SHOT_HAZARD;
+			}
+			if (courseTeleporterAt(cfg->course, *ball, cfg->ballSize, cfg->teleporterSize) >= 0) {
+				return SHOT_TELEPORTED;
+			}
+		} else if (spritesOverlap(*ball, cfg->ballSize, cfg->teleporter, cfg->teleporterSize)) {
+			return SHOT_TELEPORTED;
+		}
+		if (spritesOverlap(*ball, cfg->ballSize, cfg->hole, cfg->holeSize)) {
+			return SHOT_HOLED;
+		}
+	}
+
+	return SHOT_STOPPED;
+}
+
+// Finds the fewest-stroke plan from `ball`. Teleporting may be random and water costs a stroke, so shots that
+// end in either are never planned. Returns true with a complete plan, or false with plan->complete unset if nothing was found
+// within maxStrokes or the budget; plan->shots[0] then still aims for the closest spot reached, or failing that is the
+// longest legal shot toward the hole. plan->strokes is 0 only if no shot at all is legal from `ball`.
+bool solveShots(const SolverConfig *cfg, Pos ball, ShotPlan *plan) {
+	int maxStrokes = (cfg->maxStrokes < 1 || cfg->maxStrokes > SOLVER_MAX_STROKES) ? SOLVER_MAX_STROKES : cfg->maxStrokes;
+	uint32_t start = cfg->clock ? cfg->clock() : 0;
+	int levelBegin = 0, levelEnd = 1, count = 1, best = 0;
+	bool timedOut = false;
+
+	if (reachFriction != slipperiest(cfg)) {
+		computeReach(slipperiest(cfg));
+	}
+
+	memset(visited, 0, sizeof(visited));
+	memset(plan, 0, sizeof(*plan));
+
+	nodes[0].pos = ball;
+	nodes[0].dist = distToHole(cfg, ball);
+	nodes[0].parent = -1;
+	visit(ball);
+
+	for (int stroke = 1; stroke <= maxStrokes && !timedOut; ++stroke) {
+		int remaining = maxStrokes - stroke;   // strokes left after this one
+		bool keepChildren = remaining > 0;
+
+		for (int n = levelBegin; n < levelEnd && !timedOut; ++n) {
+			for (uint32_t power = SHOT_MIN_POWER; power <= SHOT_MAX_POWER && !timedOut; ++power) {
+				// Analytic bound: skip the whole row if even this power (and the strongest one afterwards) falls short
+				if (!canReach(cfg, nodes[n].pos, 1, power) &&
+				    !(keepChildren && canReach(cfg, nodes[n].pos, 1 + remaining, SHOT_MAX_POWER))) {
+					continue;
+				}
+
+				for (int32_t angle = 0; angle < SHOT_NUM_ANGLES; ++angle) {
+					Shot shot = { angle, power };
+					Pos end = nodes[n].pos;
+					ShotOutcome outcome = simulateShot(cfg, &end, shot);
+
+					if (outcome == SHOT_HOLED) {
+						buildPlan(n, shot, true, plan);
+						plan->complete = true;
+						return true;
+					}
+
+					if (outcome != SHOT_STOPPED || !keepChildren ||
+					    !canReach(cfg, end, remaining, SHOT_MAX_POWER) || !visit(end)) {
+						continue;
+					}
+
+					// Add to the next level; once it is full, replace its farthest node if this one is closer
+					uint32_t dist = distToHole(cfg, end);
+					int slot = count;
+
+					if (count - levelEnd >= SOLVER_MAX_NODES) {
+						slot = levelEnd;
+						for (int k = levelEnd + 1; k < count; ++k) {
+							if (nodes[k].dist > nodes[slot].dist) {
+								slot = k;
+							}
+						}
+						if (nodes[slot].dist <= dist) {
+							continue;
+						}
+					} else {
+						count++;
+					}
+
+					nodes[slot].pos = end;
+					nodes[slot].dist = dist;
+					nodes[slot].parent = n;
+					nodes[slot].angle = angle;
+					nodes[slot].power = power;
+
+					// An evicted best is replaced by whichever node is now closest
+					if (best == slot) {
+						best = closestNode(count);
+					} else if (dist < nodes[best].dist) {
+						best = slot;
+					}
+				}
+
+				timedOut = cfg->clock && cfg->clock() - start >= cfg->budget;
+			}
+		}
+
+		levelBegin = levelEnd;
+		levelEnd = count;
+		if (levelBegin == levelEnd) {
+			break;
+		}
+	}
+
+	// No complete plan: head for the closest spot found, or at least toward the hole
+	if (best != 0) {
+		buildPlan(best, plan->shots[0], false, plan);
+		plan->strokes = 1;
+	} else if (fallbackShot(cfg, ball, &plan->shots[0])) {
+		plan->strokes = 1;
+	}
+	return false;
+}
@@ -0,0 +1,60 @@
+#ifndef SHOT_SOLVER
+#define SHOT_SOLVER
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "physics.h"
+#include "course.h"
+
+// Searches the angle x power grid for the shortest sequence of shots that puts the ball in the hole.
+// Breadth-first over strokes, so the first plan found uses the fewest strokes the search could see.
+// Positions are memoized by SOLVER_CELL-pixel cell so each spot is only expanded once, shots that cannot
+// reach the hole in the remaining strokes are pruned with a per-power reach bound, and the frontier is
+// capped at SOLVER_MAX_NODES (keeping the nodes closest to the hole).
+
+#ifndef SOLVER_MAX_NODES
+#define SOLVER_MAX_NODES 128
+#endif
+
+#define SOLVER_MAX_STROKES 4
+#define SOLVER_CELL 4
+
+typedef struct {
+	int32_t angle;    // raw pot angle, 0 .. SHOT_NUM_ANGLES - 1
+	uint32_t power;
+} Shot;
+
+typedef struct {
+	Shot shots[SOLVER_MAX_STROKES];
+	int strokes;
+	bool complete;    // false if the budget ran out; shots[0] then heads for the closest spot found, or toward
+	                  // the hole (strokes 0: no legal shot at all)
+} ShotPlan;
+
+typedef enum {
+	SHOT_STOPPED = 0,
+	SHOT_HOLED,
+	SHOT_TELEPORTED,
+	SHOT_HAZARD
+} ShotOutcome;
+
+// Returns the current time in any unit; budget is in the same unit
+typedef uint32_t (*SolverClock)(void);
+
+typedef struct {
+	const Course *course;  // walls, water and teleporters; NULL for the open field with the single `teleporter`
+	Pos hole;
+	Pos teleporter;
+	int ballSize;
+	int holeSize;
+	int teleporterSize;
+
+	int maxStrokes;      // at most SOLVER_MAX_STROKES
+	SolverClock clock;   // NULL for no time limit
+	uint32_t budget;
+} SolverConfig;
+
+ShotOutcome simulateShot(const SolverConfig *cfg, Pos *ball, Shot shot);
+bool solveShots(const SolverConfig *cfg, Pos ball, ShotPlan *plan);
+
+#endif
@@ -0,0 +1,191 @@
+/*----------------------------------------------------------------------------
+* Name:    aisolve.c
+* Purpose: Host verification of the shot solver (solver.c)
+* Note(s): Solves random courses, replays every plan with the game physics
+*          and, with -x, proves on all cores that no plan with fewer strokes
+*          exists by exhaustive search (up to EXHAUSTIVE_DEPTH shots, which
+*          covers every plan of up to three strokes). Courses the solver cannot finish
+*          are reported too, so generated courses can be auto-validated.
+*          Every course is also solved with a single stroke allowed: a plan
+*          that does not hole must then be the fallback shot, legal (no
+*          water or teleporter) and aimed toward the hole.
+*
+*          Build from the repository root:
+*            cc -O2 -std=gnu11 -pthread -DSOLVER_MAX_NODES=1024 -I. \
+*               -Iexample-game tools/aisolve.c solver.c course.c physics.c -lm \
+*               -o aisolve
+*
+*          Usage: aisolve [-n courses] [-j threads] [-s seed] [-x]
+*----------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+
+#include "solver.h"
+
+#define EXHAUSTIVE_DEPTH 2             /* 2394^depth shots per course     */
+#define SHOTS_PER_SWEEP (SHOT_NUM_ANGLES * (SHOT_MAX_POWER - SHOT_MIN_POWER + 1))
+
+static Shot shot_at (int i) {
+  Shot s;
+  s.angle = i % SHOT_NUM_ANGLES;
+  s.power = SHOT_MIN_POWER + i / SHOT_NUM_ANGLES;
+  return s;
+}
+
+/*------------------------- Exhaustive check (threads) -----------------------*/
+
+typedef struct {
+  const SolverConfig *cfg;
+  Pos ball;
+  int depth;                            /* look for a plan of <= depth shots  */
+  _Atomic int next;                     /* next first shot to try             */
+  _Atomic bool found;
+} Exhaustive;
+
+static bool search (const SolverConfig *cfg, Pos ball, int depth) {
+  for (int i = 0; i < SHOTS_PER_SWEEP; i++) {
+    Pos end = ball;
+    ShotOutcome o = simulateShot(cfg, &end, shot_at(i));
+    if (o == SHOT_HOLED)
+      return true;
+    if (o == SHOT_STOPPED && depth > 1 && search(cfg, end, depth - 1))
+      return true;
+  }
+  return false;
+}
+
+static void *exhaustive_worker (void *arg) {
+  Exhaustive *ex = arg;
+  int i;
+
+  while (!atomic_load(&ex->found) && (i = atomic_fetch_add(&ex->next, 1)) < SHOTS_PER_SWEEP) {
+    Pos end = ex->ball;
+    ShotOutcome o = simulateShot(ex->cfg, &end, shot_at(i));
+    if (o == SHOT_HOLED || (o == SHOT_STOPPED && ex->depth > 1 && search(ex->cfg, end, ex->depth - 1)))
+      atomic_store(&ex->found, true);
+  }
+  return NULL;
+}
+
+static bool exists_plan (const SolverConfig *cfg, Pos ball, int depth, int nthreads) {
+  Exhaustive ex = { .cfg = cfg, .ball = ball, .depth = depth };
+  pthread_t th[64];
+
+  if (depth < 1)
+    return false;
+  atomic_init(&ex.next, 0);
+  atomic_init(&ex.found, false);
+  if (nthreads > 64)
+    nthreads = 64;
+  for (int t = 0; t < nthreads; t++)
+    pthread_create(&th[t], NULL, exhaustive_worker, &ex);
+  for (int t = 0; t < nthreads; t++)
+    pthread_join(th[t], NULL);
+  return atomic_load(&ex.found);
+}
+
+/*---------------------------------- Main ------------------------------------*/
+
+static double now_sec (void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+int main (int argc, char **argv) {
+  int courses = 100, nthreads = (int)sysconf(_SC_NPROCESSORS_ONLN), opt;
+  unsigned seed = 1;
+  bool exhaustive = false;
+  int solved = 0, unsolved = 0, badReplay = 0, notMinimal = 0, badFallback = 0;
+  int hist[SOLVER_MAX_STROKES + 1] = { 0 };
+  double solveTime = 0;
+
+  while ((opt = getopt(argc, argv, "n:j:s:x")) != -1) {
+    switch (opt) {
+      case 'n': courses = atoi(optarg); break;
+      case 'j': nthreads = atoi(optarg); break;
+      case 's': seed = (unsigned)strtoul(optarg, NULL, 0); break;
+      case 'x': exhaustive = true; break;
+      default:
+        fprintf(stderr, "usage: %s [-n courses] [-j threads] [-s seed] [-x]\n", argv[0]);
+        return 2;
+    }
+  }
+  if (nthreads < 1)
+    nthreads = 1;
+  srand(seed);
+  setvbuf(stdout, NULL, _IOLBF, 0);
+
+  for (int c = 0; c < courses; c++) {
+    SolverConfig cfg = { NULL, { 0, 0 }, { 100, 150 }, 3, 3, 3, SOLVER_MAX_STROKES, NULL, 0 };
+    ShotPlan plan;
+    Pos ball;
+    double t;
+
+    do {
+      ball.x = 5 + rand() % 311;  ball.y = 5 + rand() % 231;
+      cfg.hole.x = 5 + rand() % 311;  cfg.hole.y = 5 + rand() % 231;
+    } while (spritesOverlap(ball, 3, cfg.teleporter, 3) || spritesOverlap(cfg.hole, 3, cfg.teleporter, 3) ||
+             spritesOverlap(ball, 3, cfg.hole, 3));
+
+    /* One stroke: no spot to head for, so anything but a hole-in-one is
+       the fallback shot                                                    */
+    cfg.maxStrokes = 1;
+    if (!solveShots(&cfg, ball, &plan)) {
+      Pos b = ball;
+      ShotOutcome o = plan.strokes == 1 ? simulateShot(&cfg, &b, plan.shots[0]) : SHOT_HAZARD;
+      int off = abs(shotHeadingDegrees(plan.shots[0].angle) - directionDegrees(ball, cfg.hole));
+
+      if (o == SHOT_HAZARD || o == SHOT_TELEPORTED || (off > 180 ? 360 - off : off) >= 90) {
+        badFallback++;
+        printf("course %d: fallback shot (%d, %u) is not a legal shot toward the hole\n", c,
+               plan.shots[0].angle, plan.shots[0].power);
+      }
+    }
+    cfg.maxStrokes = SOLVER_MAX_STROKES;
+
+    t = now_sec();
+    bool ok = solveShots(&cfg, ball, &plan);
+    solveTime += now_sec() - t;
+
+    if (!ok) {
+      unsolved++;
+      printf("course %d: ball (%d,%d) hole (%d,%d) not solved in %d strokes\n",
+             c, ball.x, ball.y, cfg.hole.x, cfg.hole.y, SOLVER_MAX_STROKES);
+      continue;
+    }
+    solved++;
+    hist[plan.strokes]++;
+
+    /* The plan must hole the ball when replayed with the game physics       */
+    Pos b = ball;
+    ShotOutcome o = SHOT_STOPPED;
+    for (int i = 0; i < plan.strokes; i++)
+      o = simulateShot(&cfg, &b, plan.shots[i]);
+    if (o != SHOT_HOLED) {
+      badReplay++;
+      printf("course %d: plan does not replay\n", c);
+    }
+
+    if (exhaustive && plan.strokes - 1 <= EXHAUSTIVE_DEPTH && exists_plan(&cfg, ball, plan.strokes - 1, nthreads)) {
+      notMinimal++;
+      printf("course %d: a %d-stroke plan exists, solver found %d\n", c, plan.strokes - 1, plan.strokes);
+    }
+  }
+
+  printf("%d courses: %d solved, %d unsolved, %d bad replays, %d bad fallbacks", courses, solved, unsolved, badReplay,
+         badFallback);
+  if (exhaustive)
+    printf(", %d not minimal", notMinimal);
+  printf("\n");
+  for (int s = 1; s <= SOLVER_MAX_STROKES; s++)
+    printf("  %d strokes: %d\n", s, hist[s]);
+  printf("average solve time %.2f ms (%d max nodes per level)\n", 1000 * solveTime / courses, SOLVER_MAX_NODES);
+  return (badReplay || notMinimal || badFallback) ? 1 : 0;
+}
@@ -0,0 +1,242 @@
+/*----------------------------------------------------------------------------
+* Name:    blittest.c
+* Purpose: Host test of the clipping sprite blitter (blit.c)
+* Note(s): Draws sprites, rectangles and 2 and 4 bpp indexed images,
+*          opaque and transparent, all over and past every edge of
+*          the screen through the board's LCD driver on the LCD model,
+*          and checks that the screen shows exactly their on-screen part
+*          and that not one pixel was written with the address or the
+*          window outside the screen. The same sprites drawn block by
+*          block with GLCD_PutPixel, like the game did before, are
+*          counted for comparison, and the indexed images are compared
+*          with the storage a 16 bpp GLCD_Bitmap of them would take.
+*
+*          Build from the repository root:
+*            cc -O2 -std=gnu11 -DGLCD_MODEL -I. -Itools/host -Itools \
+*               -Iexample-game tools/blittest.c blit.c tools/lcdmodel.c \
+*               example-game/GLCD_SPI_LPC1700.c -o blittest
+*
+*          Usage: blittest     (exit status 1 if any check fails)
+*----------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "GLCD.h"
+#include "spece.h"
+#include "blit.h"
+#include "lcdmodel.h"
+
+#define W COURSE_WIDTH
+#define H COURSE_HEIGHT
+
+static uint16_t ref[H][W];
+
+static char ball[]   = { 0x38, 0x38, 0x38 };
+static char odd[]    = { 0x01, 0x82, 0x44 };
+static char full[]   = { (char)0xFF, (char)0xFF, (char)0xFF, (char)0xFF };
+static char mixed[]  = { (char)0x81, 0x00, (char)0xFF, 0x18, 0x7E };
+static char single[] = { (char)0x80 };
+
+static const struct { char *bitmap; int size; } sprites[] = {
+  { ball, 3 }, { odd, 3 }, { full, 4 }, { mixed, 5 }, { single, 1 },
+};
+
+static void ref_rect (int x, int y, int w, int h, uint16_t colour) {
+  for (int j = y; j < y + h; j++)
+    for (int i = x; i < x + w; i++)
+      if (i >= 0 && i < W && j >= 0 && j < H)
+        ref[j][i] = colour;
+}
+
+/* The sprite layout, one block at a time: column k is bitmap[size - 1 - k]  */
+static void ref_sprite (int x, int y, const char *bitmap, int size, uint16_t colour) {
+  for (int k = 0; k < size; k++)
+    for (int bit = 0; bit < SPRITE_COLS; bit++)
+      if ((bitmap[size - 1 - k] >> bit) & 1)
+        ref_rect(x + k * SPRITE_SCALE, y + bit * SPRITE_SCALE, SPRITE_SCALE, SPRITE_SCALE, colour);
+}
+
+/* What drawImageAt should draw: every pixel but the transparent ones       */
+static void ref_image (int x, int y, const IndexedImage *image, const unsigned short *palette) {
+  for (int j = 0; j < image->h; j++)
+    for (int i = 0; i < image->w; i++) {
+      int index = imageIndexAt(image, i, j);
+
+      if (x + i >= 0 && x + i < W && y + j >= 0 && y + j < H && !(index == 0 && image->transparent))
+        ref[y + j][x + i] = palette[index];
+    }
+}
+
+static uint32_t rng_state = 1;
+
+static int rnd (int n) {
+  rng_state ^= rng_state << 13;
+  rng_state ^= rng_state >> 17;
+  rng_state ^= rng_state << 5;
+  return (int)(rng_state % (uint32_t)n);
+}
+
+/* Indexed images drawn across and past the edges: returns the failures     */
+static int images (const char *name) {
+  static uint8_t pixels[8][64 * 32];
+  static IndexedImage image[8];
+  static unsigned short palette[4][16];
+  unsigned int bytes, drawn = 0, packed = 0, full = 0;
+  uint64_t offscreen;
+  int failures = 0;
+
+  /* 2 and 4 bpp, opaque and transparent, odd sizes; index 0 is a third of
+     the pixels so transparent images have runs of all lengths             */
+  rng_state = 1;
+  memset(pixels, 0, sizeof(pixels));
+  for (int k = 0; k < 8; k++) {
+    int bpp = k & 1 ? 4 : 2;
+
+    image[k].w = (uint8_t)(1 + rnd(40));
+    image[k].h = (uint8_t)(1 + rnd(32));
+    image[k].bpp = (uint8_t)bpp;
+    image[k].transparent = k & 2;
+    image[k].pixels = pixels[k];
+    for (int j = 0; j < image[k].h; j++)
+      for (int i = 0; i < image[k].w; i++) {
+        int index = rnd(3) ? 1 + rnd((1 << bpp) - 1) : 0;
+        int bit = i * bpp;
+
+        pixels[k][j * IMAGE_STRIDE(image[k].w, bpp) + bit / 8] |= (uint8_t)(index << (8 - bpp - bit % 8));
+      }
+  }
+  for (int p = 0; p < 4; p++)
+    for (int i = 0; i < 16; i++)
+      palette[p][i] = (uint16_t)(0x0841 * (p + 1) + i * 0x1111);
+
+  GLCD_Clear(Black);
+  memset(ref, 0, sizeof(ref));
+  bytes = GLCD_SpiBytes;
+  offscreen = lcd_model_stats.offscreen;
+  for (int n = 0; n < 1500; n++) {
+    const IndexedImage *im = &image[n % 8];
+    int x = rnd(W + 80) - 40, y = rnd(H + 70) - 35;
+
+    /* The same pixels in another palette each time                         */
+    drawImageAt(x, y, im, palette[n % 4]);
+    ref_image(x, y, im, palette[n % 4]);
+    drawn++;
+    packed += IMAGE_STRIDE(im->w, im->bpp) * im->h;
+    full += im->w * im->h * 2;
+  }
+  bytes = GLCD_SpiBytes - bytes;
+  offscreen = lcd_model_stats.offscreen - offscreen;
+  printf("%-9s %-10s %8u %10u %10.1f %10llu   %.0f%% of 16 bpp storage\n", name, "indexed", drawn, bytes,
+         (double)bytes / drawn, (unsigned long long)offscreen, 100.0 * packed / full);
+
+  if (offscreen) {
+    printf("  FAIL the indexed images wrote %llu pixels off the screen\n", (unsigned long long)offscreen);
+    failures++;
+  }
+  if (memcmp(ref, lcd_model_fb, sizeof(ref))) {
+    printf("  FAIL indexed images: the screen does not show their on-screen part\n");
+    failures++;
+  }
+  return failures;
+}
+
+/* How drawSpriteAt drew before: every pixel of every lit block, unclipped   */
+static void putpixel_sprite (int x, int y, const char *bitmap, int size) {
+  for (int k = 0; k < size; k++)
+    for (int bit = 0; bit < SPRITE_COLS; bit++)
+      if ((bitmap[size - 1 - k] >> bit) & 1)
+        for (int j = 0; j < SPRITE_SCALE; j++)
+          for (int i = 0; i < SPRITE_SCALE; i++)
+            GLCD_PutPixel(x + k * SPRITE_SCALE + i, y + bit * SPRITE_SCALE + j);
+}
+
+int main (void) {
+  static const char *names[] = { "HX8347-D", "ILI9320" };
+  int failures = 0;
+
+  printf("%-9s %-10s %8s %10s %10s %10s\n", "lcd", "drawing", "sprites", "SPI bytes", "B/sprite", "offscreen");
+
+  for (int c = LCD_MODEL_HIMAX; c <= LCD_MODEL_ILI; c++) {
+    for (int pass = 0; pass < 2; pass++) {
+      bool blit = pass == 0;
+      unsigned int bytes;
+      uint64_t offscreen;
+      int count = 0;
+
+#if defined(GLCD_CONTROLLER) && GLCD_CONTROLLER != 0
+      if (c != GLCD_CONTROLLER - 1)
+        continue;
+#endif
+      lcd_model_reset((LcdModelController)c);
+      GLCD_Init();
+      GLCD_Clear(Black);
+      memset(ref, 0, sizeof(ref));
+      bytes = GLCD_SpiBytes;
+      offscreen = lcd_model_stats.offscreen;
+
+      /* Every sprite over a grid that runs a sprite's size past each edge   */
+      for (int y = -30; y < H + 30; y += 7) {
+        for (int x = -30; x < W + 30; x += 11) {
+          int s = (x / 11 + y / 7 + 100) % 5;
+          uint16_t colour = (uint16_t)(0x1000 + count * 37);
+
+          GLCD_SetTextColor(colour);
+          if (blit)
+            drawSpriteAt(x, y, sprites[s].bitmap, sprites[s].size);
+          else
+            putpixel_sprite(x, y, sprites[s].bitmap, sprites[s].size);
+          ref_sprite(x, y, sprites[s].bitmap, sprites[s].size, colour);
+          count++;
+        }
+      }
+      bytes = GLCD_SpiBytes - bytes;
+      offscreen = lcd_model_stats.offscreen - offscreen;
+      printf("%-9s %-10s %8d %10u %10.1f %10llu\n", names[c], blit ? "blit" : "putpixel", count, bytes,
+             (double)bytes / count, (unsigned long long)offscreen);
+
+      if (!blit)
+        continue;
+      if (offscreen) {
+        printf("  FAIL the blitter wrote %llu pixels off the screen\n", (unsigned long long)offscreen);
+        failures++;
+      }
+      if (memcmp(ref, lcd_model_fb, sizeof(ref))) {
+        printf("  FAIL sprites: the screen does not show their on-screen part\n");
+        failures++;
+      }
+
+      /* Rectangles and blocks, inside, across and wholly past the edges     */
+      offscreen = lcd_model_stats.offscreen;
+      for (int k = 0; k < 2000; k++) {
+        int x = (k * 97) % (W + 80) - 40, y = (k * 53) % (H + 80) - 40;
+        int w = k % 37, h = (k / 37) % 29;
+        uint16_t colour = (uint16_t)(0x8000 + k);
+
+        GLCD_SetTextColor(colour);
+        if (k & 1) {
+          drawRect(x, y, w, h);
+          ref_rect(x, y, w, h, colour);
+        } else {
+          drawPixelsAt(x, y, w);
+          ref_rect(x, y, w, w, colour);
+        }
+      }
+      if (lcd_model_stats.offscreen != offscreen) {
+        printf("  FAIL drawRect wrote %llu pixels off the screen\n",
+               (unsigned long long)(lcd_model_stats.offscreen - offscreen));
+        failures++;
+      }
+      if (memcmp(ref, lcd_model_fb, sizeof(ref))) {
+        printf("  FAIL rectangles: the screen does not show their on-screen part\n");
+        failures++;
+      }
+      failures += images(names[c]);
+    }
+  }
+
+  printf("%s\n", failures ? "FAILED" : "no off-screen writes, all pictures match");
+  return failures ? 1 : 0;
+}
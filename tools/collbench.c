@@ -0,0 +1,161 @@
+/*----------------------------------------------------------------------------
+* Name:    collbench.c
+* Purpose: Benchmark of the wall collision broadphase (course.c)
+* Note(s): Builds courses with a growing number of random walls, plays the
+*          same number of random shots on each with stepCourse() and
+*          reports the cost per physics step, the walls actually swept
+*          per step (the ones left after the bounding box reject) and the
+*          walls listed per bucket, the density a step pays for. For
+*          reference, "all walls" is the cost of a step that only checks
+*          the ball against every wall, without any response. Every step is
+*          also checked against all walls: the ball must never end a step
+*          inside one.
+*          A step scans the walls listed in the one to four buckets it
+*          touches, so its cost follows the walls per bucket: the random
+*          walls here spread over the whole screen, and both columns grow
+*          with their density, about linearly, where "all walls" grows
+*          with the total. On the host, going from 2 to 200 walls took a
+*          step from about 39 to 110 ns and 0.01 to 0.45 swept walls,
+*          against 21 to 540 ns for "all walls".
+*
+*          Build from the repository root:
+*            cc -O2 -std=gnu11 -I. -Iexample-game tools/collbench.c \
+*               course.c physics.c -lm -o collbench
+*
+*          Usage: collbench [shots] [seed]
+*----------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+
+#include "course.h"
+
+#define MIN_WALL 6
+#define MAX_WALL 20
+
+static const int wall_counts[] = { 2, 5, 10, 20, 50, 100, 150, 200 };
+
+static uint32_t rng_state;
+
+static int rnd (int lo, int hi) {
+  rng_state ^= rng_state << 13;
+  rng_state ^= rng_state >> 17;
+  rng_state ^= rng_state << 5;
+  return lo + (int)(rng_state % (uint32_t)(hi - lo + 1));
+}
+
+static double now_sec (void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static bool in_any_wall (const Course *c, Pos ball) {
+  for (int i = 0; i < c->header->wallCount; i++)
+    if (ballInRect(ball, &c->walls[i]))
+      return true;
+  return false;
+}
+
+int main (int argc, char **argv) {
+  static uint8_t image[65536] __attribute__((aligned(4)));
+  static CourseRect walls[255];
+  int shots = argc > 1 ? atoi(argv[1]) : 20000;
+  uint32_t seed = argc > 2 ? (uint32_t)strtoul(argv[2], NULL, 0) : 1;
+  CoursePoint hole = { 0, 0 };
+  int failures = 0;
+
+  printf("%6s %8s %10s %10s %12s %11s %10s %10s\n", "walls", "bytes", "steps", "ns/step", "tests/step", "per bucket",
+         "all walls", "inside");
+
+  for (size_t n = 0; n < sizeof(wall_counts) / sizeof(wall_counts[0]); n++) {
+    CourseHeader header = { 0 };
+    Course course;
+    uint64_t steps = 0, brute_steps = 0;
+    volatile uint32_t hits = 0;
+    uint32_t inside = 0, size;
+    Pos *starts = malloc(shots * sizeof(Pos));
+    int *angles = malloc(shots * sizeof(int)), *powers = malloc(shots * sizeof(int));
+    double t, brute;
+
+    rng_state = seed * 2654435761u + 1;
+    header.wallCount = wall_counts[n];
+    header.holeCount = 1;
+    header.spawn.x = header.spawn.y = COURSE_RANDOM;
+    for (int i = 0; i < header.wallCount; i++) {
+      walls[i].w = rnd(MIN_WALL, MAX_WALL);
+      walls[i].h = rnd(MIN_WALL, MAX_WALL);
+      walls[i].x = rnd(0, COURSE_WIDTH - walls[i].w);
+      walls[i].y = rnd(0, COURSE_HEIGHT - walls[i].h);
+    }
+    size = assembleCourse(&header, walls, NULL, NULL, &hole, NULL, image, sizeof(image));
+    if (size == 0 || !parseCourse(image, size, &course)) {
+      printf("%6d: course does not assemble\n", header.wallCount);
+      return 1;
+    }
+
+    /* Shots are drawn up front so the timed loop is stepCourse() only       */
+    for (int s = 0; s < shots; s++) {
+      do {
+        starts[s] = (Pos){ rnd(0, COURSE_WIDTH), rnd(0, COURSE_HEIGHT) };
+      } while (in_any_wall(&course, starts[s]));
+      angles[s] = rnd(0, SHOT_NUM_ANGLES - 1);
+      powers[s] = rnd(SHOT_MIN_POWER, SHOT_MAX_POWER);
+    }
+
+    courseWallTests = 0;
+    t = now_sec();
+    for (int s = 0; s < shots; s++) {
+      Pos ball = starts[s];
+      int vx, vy;
+
+      launchVelocity(angles[s], powers[s], &vx, &vy);
+      while (!ballStopped(vx, vy)) {
+        stepCourse(&course, &ball, &vx, &vy);
+        steps++;
+      }
+    }
+    t = now_sec() - t;
+
+    /* Reference: the open-field step plus a test of every wall              */
+    brute = now_sec();
+    for (int s = 0; s < shots; s++) {
+      Pos ball = starts[s];
+      int vx, vy;
+
+      launchVelocity(angles[s], powers[s], &vx, &vy);
+      while (!ballStopped(vx, vy)) {
+        stepPhysics(&ball, &vx, &vy);
+        hits += in_any_wall(&course, ball);
+        brute_steps++;
+      }
+    }
+    brute = now_sec() - brute;
+
+    /* Untimed replay of the same shots, checking every step                 */
+    for (int s = 0; s < shots; s++) {
+      Pos ball = starts[s];
+      int vx, vy;
+
+      launchVelocity(angles[s], powers[s], &vx, &vy);
+      while (!ballStopped(vx, vy)) {
+        stepCourse(&course, &ball, &vx, &vy);
+        inside += in_any_wall(&course, ball);
+      }
+    }
+
+    printf("%6d %8u %10llu %10.1f %12.2f %11.2f %10.1f %10u\n", header.wallCount, size, (unsigned long long)steps,
+           steps ? t * 1e9 / steps : 0, steps ? (double)courseWallTests / steps : 0,
+           (double)course.header->cellEntries / COURSE_BUCKETS, brute_steps ? brute * 1e9 / brute_steps : 0, inside);
+    failures += inside != 0;
+
+    free(starts);
+    free(angles);
+    free(powers);
+  }
+
+  return failures ? 1 : 0;
+}
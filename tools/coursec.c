@@ -0,0 +1,263 @@
+/*----------------------------------------------------------------------------
+* Name:    coursec.c
+* Purpose: Course compiler: text course descriptions to the binary format
+* Note(s): Checks a course, precomputes its wall buckets and trigger grid
+*          (assembleCourse, course.c) and
+*          writes either one binary course file, for the host tools to
+*          memory-map, or the C source of the courses built into the game.
+*
+*          Course description, one item per line, '#' starts a comment:
+*            spawn X Y | spawn random
+*            hole X Y                  (one or more, one is picked per game)
+*            teleporter X Y X2 Y2 | teleporter X Y random
+*            wall X Y W H
+*            water X Y W H
+*            sand X Y W H | ice X Y W H   (terrain, snapped out to 8 px
+*                                          cells; later ones win)
+*
+*          Build from the repository root:
+*            cc -O2 -std=gnu11 -I. -Iexample-game tools/coursec.c course.c \
+*               physics.c -lm -o coursec
+*
+*          Usage: coursec -o course.crs course.txt
+*                 coursec -c courseData.c courses/classic.txt ...
+*----------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "course.h"
+
+/* The binary format is the in-memory layout on both the board and the host */
+_Static_assert(sizeof(CourseHeader) == 16, "CourseHeader layout");
+_Static_assert(sizeof(CourseRect) == 8, "CourseRect layout");
+_Static_assert(sizeof(CourseTeleporter) == 8, "CourseTeleporter layout");
+
+#define MAX_ITEMS 255
+#define COURSE_IMAGE_MAX 65536
+#define MAX_COURSES 64
+
+typedef struct {
+  CourseHeader header;
+  CourseRect walls[MAX_ITEMS], hazards[MAX_ITEMS];
+  CourseTeleporter teleporters[MAX_ITEMS];
+  CoursePoint holes[MAX_ITEMS];
+  uint8_t terrain[COURSE_TERRAIN_BYTES];
+} Source;
+
+static const char *file;
+static int line;
+
+static void fail (const char *msg) {
+  fprintf(stderr, "%s:%d: %s\n", file, line, msg);
+  exit(1);
+}
+
+static bool on_course (int x, int y) {
+  return x >= 0 && x <= COURSE_WIDTH && y >= 0 && y <= COURSE_HEIGHT;
+}
+
+static void parse_source (const char *path, Source *src) {
+  FILE *f = fopen(path, "r");
+  char buf[256];
+
+  file = path;
+  line = 0;
+  if (!f) {
+    perror(path);
+    exit(1);
+  }
+
+  memset(src, 0, sizeof(*src));
+  src->header.magic = COURSE_MAGIC;
+  src->header.version = COURSE_VERSION;
+  src->header.spawn.x = src->header.spawn.y = COURSE_RANDOM;
+
+  while (fgets(buf, sizeof(buf), f)) {
+    char kind[16], a[16];
+    int x, y, w, h, n;
+
+    line++;
+    buf[strcspn(buf, "#")] = 0;
+    if (sscanf(buf, "%15s", kind) != 1)
+      continue;
+
+    if (!strcmp(kind, "spawn")) {
+      if (sscanf(buf, "%*s %15s", a) == 1 && !strcmp(a, "random"))
+        continue;
+      if (sscanf(buf, "%*s %d %d", &x, &y) != 2 || !on_course(x, y))
+        fail("spawn needs X Y on the course, or random");
+      src->header.spawn = (CoursePoint){ x, y };
+    } else if (!strcmp(kind, "hole")) {
+      if (sscanf(buf, "%*s %d %d", &x, &y) != 2 || !on_course(x, y))
+        fail("hole needs X Y on the course");
+      if ((n = src->header.holeCount++) >= MAX_ITEMS)
+        fail("too many holes");
+      src->holes[n] = (CoursePoint){ x, y };
+    } else if (!strcmp(kind, "teleporter")) {
+      CourseTeleporter t;
+      if (sscanf(buf, "%*s %d %d %15s", &x, &y, a) != 3 || !on_course(x, y))
+        fail("teleporter needs X Y and an exit X2 Y2 or random");
+      t.entry = (CoursePoint){ x, y };
+      t.exit.x = t.exit.y = COURSE_RANDOM;
+      if (strcmp(a, "random")) {
+        if (sscanf(buf, "%*s %*d %*d %d %d", &w, &h) != 2 || !on_course(w, h))
+          fail("teleporter exit must be on the course");
+        t.exit = (CoursePoint){ w, h };
+      }
+      if ((n = src->header.teleporterCount++) >= COURSE_MAX_TELEPORTERS)
+        fail("too many teleporters");
+      src->teleporters[n] = t;
+    } else if (!strcmp(kind, "sand") || !strcmp(kind, "ice")) {
+      CourseRect r;
+      if (sscanf(buf, "%*s %d %d %d %d", &x, &y, &w, &h) != 4 || w <= 0 || h <= 0 ||
+          !on_course(x, y) || !on_course(x + w, y + h))
+        fail("terrain needs X Y W H on the course");
+      r = (CourseRect){ x, y, w, h };
+      paintTerrain(src->terrain, &r, kind[0] == 's' ? TERRAIN_SAND : TERRAIN_ICE, false);
+    } else if (!strcmp(kind, "wall") || !strcmp(kind, "water")) {
+      bool wall = kind[1] == 'a';
+      if (sscanf(buf, "%*s %d %d %d %d", &x, &y, &w, &h) != 4 || w <= 0 || h <= 0 ||
+          !on_course(x, y) || !on_course(x + w, y + h))
+        fail("rectangle needs X Y W H on the course");
+      if (wall) {
+        if ((n = src->header.wallCount++) >= MAX_ITEMS)
+          fail("too many walls");
+        src->walls[n] = (CourseRect){ x, y, w, h };
+      } else {
+        if ((n = src->header.hazardCount++) >= MAX_ITEMS)
+          fail("too many hazards");
+        src->hazards[n] = (CourseRect){ x, y, w, h };
+      }
+    } else {
+      fail("unknown item");
+    }
+  }
+  fclose(f);
+
+  line = 0;
+  if (src->header.holeCount == 0)
+    fail("a course needs at least one hole");
+
+  /* The cells under the water are water, whatever was painted before       */
+  for (int i = 0; i < src->header.hazardCount; i++)
+    paintTerrain(src->terrain, &src->hazards[i], TERRAIN_WATER, true);
+}
+
+/* Lays the course out in the binary format; returns its size                */
+static uint32_t assemble (const Source *src, uint8_t *out) {
+  uint32_t size = assembleCourse(&src->header, src->walls, src->hazards, src->teleporters, src->holes,
+                                 src->terrain, out, COURSE_IMAGE_MAX);
+  const CourseHeader *h;
+  Course course;
+
+  if (size == 0 || !parseCourse(out, size, &course))
+    fail("too many walls for the wall buckets");
+  h = course.header;
+
+  /* Things the game relies on and cannot check cheaply at runtime           */
+  for (int i = 0; i < h->holeCount; i++) {
+    Pos hole = { course.holes[i].x, course.holes[i].y };
+    if (courseSolidAt(&course, hole))
+      fail("a hole is inside a wall");
+    if (courseTeleporterAt(&course, hole, 3, 3) >= 0)
+      fail("a hole is on a teleporter");
+  }
+  if (h->spawn.x != COURSE_RANDOM) {
+    Pos spawn = { h->spawn.x, h->spawn.y };
+    if (courseSolidAt(&course, spawn) || courseTriggerAt(&course, spawn))
+      fail("the spawn touches a wall, hole, teleporter or hazard");
+  }
+  for (int i = 0; i < h->teleporterCount; i++) {
+    Pos exit = { course.teleporters[i].exit.x, course.teleporters[i].exit.y };
+    if (exit.x != COURSE_RANDOM && (courseSolidAt(&course, exit) || courseTeleporterAt(&course, exit, 3, 3) >= 0))
+      fail("a teleporter exit is in a wall or on a teleporter");
+  }
+
+  return size;
+}
+
+static void write_c (FILE *out, char **paths, int count) {
+  static uint8_t image[COURSE_IMAGE_MAX] __attribute__((aligned(4)));
+  static Source src;
+  uint32_t sizes[MAX_COURSES];
+
+  fprintf(out, "// Generated by tools/coursec from:");
+  for (int i = 0; i < count; i++)
+    fprintf(out, " %s", paths[i]);
+  fprintf(out, "\n// Do not edit; edit the course descriptions and run coursec -c again.\n\n");
+  fprintf(out, "#include \"course.h\"\n\n");
+
+  for (int i = 0; i < count; i++) {
+    uint32_t size;
+
+    parse_source(paths[i], &src);
+    size = sizes[i] = assemble(&src, image);
+
+    /* Stored as words so the course is 4-byte aligned in flash              */
+    fprintf(out, "// %s\nstatic const uint32_t course%d[] = {", paths[i], i);
+    for (uint32_t w = 0; w < (size + 3) / 4; w++) {
+      uint32_t v;
+      memcpy(&v, &image[w * 4], 4);
+      fprintf(out, "%s0x%08X,", (w % 8) ? " " : "\n\t", v);
+    }
+    fprintf(out, "\n};\n\n");
+    memset(image, 0, sizeof(image));
+  }
+
+  fprintf(out, "const uint8_t *const COURSE_DATA[] = {\n");
+  for (int i = 0; i < count; i++)
+    fprintf(out, "\t(const uint8_t *)course%d,\n", i);
+  fprintf(out, "};\n\nconst uint32_t COURSE_SIZES[] = {\n");
+  for (int i = 0; i < count; i++)
+    fprintf(out, "\t%u,\n", sizes[i]);
+  fprintf(out, "};\n\nconst uint32_t NUM_COURSES = %d;\n", count);
+}
+
+int main (int argc, char **argv) {
+  static uint8_t image[COURSE_IMAGE_MAX] __attribute__((aligned(4)));
+  const char *binary = NULL, *csource = NULL;
+  int opt;
+
+  while ((opt = getopt(argc, argv, "o:c:")) != -1) {
+    switch (opt) {
+      case 'o': binary = optarg; break;
+      case 'c': csource = optarg; break;
+      default: goto usage;
+    }
+  }
+  if (optind >= argc || !!binary == !!csource || (binary && argc - optind != 1) ||
+      argc - optind > MAX_COURSES)
+    goto usage;
+
+  if (binary) {
+    static Source src;
+    FILE *out;
+    uint32_t size;
+
+    parse_source(argv[optind], &src);
+    size = assemble(&src, image);
+    if (!(out = fopen(binary, "wb")) || fwrite(image, 1, size, out) != size || fclose(out)) {
+      perror(binary);
+      return 1;
+    }
+    printf("%s: %u bytes\n", binary, size);
+  } else {
+    FILE *out = fopen(csource, "w");
+    if (!out) {
+      perror(csource);
+      return 1;
+    }
+    write_c(out, &argv[optind], argc - optind);
+    fclose(out);
+  }
+  return 0;
+
+usage:
+  fprintf(stderr, "usage: %s -o course.crs course.txt\n"
+                  "       %s -c courseData.c course.txt...\n", argv[0], argv[0]);
+  return 2;
+}
@@ -0,0 +1,184 @@
+/*----------------------------------------------------------------------------
+* Name:    frametest.c
+* Purpose: Host test of the script frame budget (script.c)
+* Note(s): Steps the scheduler by hand against a fake meter: scripts spend
+*          LCD SPI bytes, and the clock moves as the board's 12.5 MHz SPI
+*          would take to send them. The game's budget is used, 3125 bytes
+*          and 2 ms a frame, with a sprite that never waits and two
+*          deferrable scripts like the preview and the HUD:
+*            - while the sprite spends 2000 bytes a frame, neither fits,
+*              and both run only when forced, every FRAME_MAX_DEFER + 1
+*              frames; the overruns this causes lower the quality
+*            - with the sprite still, the preview runs every frame and the
+*              HUD is never put off two frames in a row
+*            - a run of frames within budget brings the quality back, and
+*              then a script costing more than the whole budget still
+*              runs at once in a frame with nothing spent
+*            - frameStats counts the frames, overruns, late frames,
+*              deferrals and forced runs the test saw
+*
+*          Build from the repository root:
+*            cc -O2 -std=gnu11 -I. -Itools/host tools/frametest.c script.c \
+*               -o frametest
+*
+*          Usage: frametest     (exit status 1 if any check fails)
+*----------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "script.h"
+#include <cmsis_os2.h>
+
+#define BUDGET          3125            /* gameLogic.c: 2 ms of SPI bytes     */
+#define BUDGET_US       2000
+#define SPRITE_BYTES    2000
+#define HUD_COST        1296            /* HUD_MAX_SPI_BYTES                  */
+#define HUD_BYTES       1200
+#define PREVIEW_COST    7680            /* at FRAME_QUALITY_MAX               */
+#define MOVING_FRAMES   300
+#define STILL_FRAMES    300
+
+/* The fake meter and clock: microseconds at 12.5 MHz, 8 bits a byte        */
+static uint32_t spi, clk;
+uint32_t osKernelGetSysTimerCount (void) { return clk; }
+uint32_t osKernelGetSysTimerFreq (void) { return 1000000; }
+osStatus_t osThreadYield (void) { return osOK; }
+osStatus_t osDelay (uint32_t ticks) { (void)ticks; return osOK; }
+static uint32_t meter (void) { return spi; }
+
+/* What the test saw in the frame being stepped, and in all of them          */
+static uint32_t frame_spent;
+static bool sprite_ran, hud_ran, preview_ran;
+static int frames, overruns, late, forced, deferred;
+static uint32_t max_cost;
+static bool moving;
+static int failures;
+
+static void spend (uint32_t bytes) {
+  spi += bytes;
+  clk += bytes * 16 / 25;
+  frame_spent += bytes;
+}
+
+/* A deferrable script that runs with the frame already over is forced      */
+static void count_forced (uint32_t cost) {
+  if (frame_spent > 0 && frame_spent + cost > BUDGET)
+    forced++;
+}
+
+static bool sprite (Script *s) {
+  (void)s;
+  sprite_ran = true;
+  if (moving)
+    spend(SPRITE_BYTES);
+  return true;
+}
+
+static bool hud (Script *s) {
+  count_forced(s->cost);
+  hud_ran = true;
+  spend(HUD_BYTES);
+  return true;
+}
+
+/* A redraw now and then, a few dots otherwise; shows fewer at a lower
+   quality, like preview.c                                                   */
+static bool preview (Script *s) {
+  static int runs;
+
+  count_forced(s->cost);
+  preview_ran = true;
+  spend(runs++ % 3 == 0 ? 5000 : 300);
+  setScriptCost(s, PREVIEW_COST * frameQuality() / FRAME_QUALITY_MAX);
+  return true;
+}
+
+static void step (Script *h, Script *p) {
+  uint32_t start = clk;
+
+  frame_spent = 0;
+  sprite_ran = hud_ran = preview_ran = false;
+  stepScripts();
+
+  frames++;
+  overruns += frame_spent > BUDGET;
+  late += clk - start > BUDGET_US;
+  max_cost = frame_spent > max_cost ? frame_spent : max_cost;
+  deferred += (scriptRunning(h) && !hud_ran) + (scriptRunning(p) && !preview_ran);
+}
+
+static void check (bool ok, const char *what, int frame) {
+  if (!ok) {
+    printf("  FAIL frame %d: %s\n", frame, what);
+    failures++;
+  }
+}
+
+int main (void) {
+  Script *p, *h;
+  int last_hud = -1, last_preview = -1, hud_off = 0;
+
+  setFrameBudget(meter, BUDGET, BUDGET_US);
+  startScript(sprite, NULL);
+  p = startScript(preview, NULL);
+  setScriptCost(p, PREVIEW_COST);
+  h = startScript(hud, NULL);
+  setScriptCost(h, HUD_COST);
+
+  /* Moving: only forced runs, FRAME_MAX_DEFER + 1 frames apart              */
+  moving = true;
+  for (int f = 0; f < MOVING_FRAMES; f++) {
+    step(h, p);
+    check(sprite_ran, "the sprite did not run", f);
+    if (hud_ran) {
+      check(f - last_hud == FRAME_MAX_DEFER + 1, "the HUD ran before it had to", f);
+      last_hud = f;
+    }
+    if (preview_ran) {
+      check(f - last_preview == FRAME_MAX_DEFER + 1, "the preview ran before it had to", f);
+      last_preview = f;
+    }
+  }
+  check(last_hud >= 0 && last_preview >= 0, "a deferred script never ran", MOVING_FRAMES);
+  check(frameStats.minQuality < FRAME_QUALITY_MAX, "the overruns did not lower the quality", MOVING_FRAMES);
+  printf("moving: HUD and preview forced every %d frames, quality down to %u\n", FRAME_MAX_DEFER + 1,
+         frameStats.minQuality);
+
+  /* Still: the preview runs first in an empty frame, the HUD fits after
+     every cheap preview                                                     */
+  moving = false;
+  for (int f = MOVING_FRAMES; f < MOVING_FRAMES + STILL_FRAMES; f++) {
+    step(h, p);
+    check(preview_ran, "the preview was deferred in a frame with nothing spent", f);
+    hud_off = hud_ran ? 0 : hud_off + 1;
+    check(hud_off < 2, "the HUD was put off two frames in a row", f);
+  }
+
+  /* Quiet: the HUD alone, within budget; the quality comes back            */
+  stopScript(p);
+  for (int f = 0; f < FRAME_QUALITY_RECOVER * FRAME_QUALITY_MAX; f++)
+    step(h, p);
+  check(frameQuality() == FRAME_QUALITY_MAX, "the quality did not recover", frames);
+  printf("quiet: quality back to %u after %d frames within budget\n", frameQuality(),
+         FRAME_QUALITY_RECOVER * FRAME_QUALITY_MAX);
+
+  /* A full preview, over the whole budget on its own: it takes the empty
+     frame ahead of the HUD (a lower slot) rather than waiting for room     */
+  p = startScript(preview, NULL);
+  setScriptCost(p, PREVIEW_COST);
+  step(h, p);
+  check(preview_ran, "a script over the whole budget waited in an empty frame", frames);
+
+  check(frameStats.frames == (uint32_t)frames, "frames counted", frames);
+  check(frameStats.overruns == (uint32_t)overruns, "overruns counted", frames);
+  check(frameStats.late == (uint32_t)late, "late frames counted", frames);
+  check(frameStats.maxCost == max_cost, "worst frame cost", frames);
+  check(frameStats.forced == (uint32_t)forced, "forced runs counted", frames);
+  check(frameStats.deferred == (uint32_t)deferred, "deferrals counted", frames);
+  printFrameStats();
+
+  printf("%s\n", failures ? "FAILED" : "all frame budgets as expected");
+  return failures ? 1 : 0;
+}
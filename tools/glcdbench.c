@@ -0,0 +1,216 @@
+/*----------------------------------------------------------------------------
+* Name:    glcdbench.c
+* Purpose: SPI cost of the LCD driver on each controller, on the host model
+* Note(s): Builds the board's LCD driver against the LCD model (lcdmodel.c)
+*          and runs the same drawing on an HX8347-D and an ILI9320: the
+*          game's pixel-by-pixel sprite drawing, scattered pixels, window
+*          fills, text in both fonts (whole strings, and the same text one
+*          character at a time) and a full clear. Reports SPI bytes and
+*          chip-select frames per pixel, the register writes the driver
+*          skipped and the glyphs it expanded for each, and checks that
+*          both controllers end up with the same picture, matching what was
+*          drawn.
+*
+*          Build from the repository root:
+*            cc -O2 -std=gnu11 -DGLCD_MODEL -Itools/host -Itools \
+*               -Iexample-game tools/glcdbench.c tools/lcdmodel.c \
+*               example-game/GLCD_SPI_LPC1700.c -o glcdbench
+*
+*          Add -DGLCD_CONTROLLER=1 (HX8347-D) or 2 (ILI932x) for a driver
+*          fixed to one controller; only that one is then benchmarked.
+*
+*          Usage: glcdbench
+*----------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "GLCD.h"
+#include "lcdmodel.h"
+
+#define W LCD_MODEL_WIDTH
+#define H LCD_MODEL_HEIGHT
+
+static uint16_t ref[H][W];              /* what should be on the screen       */
+static uint16_t shot[2][H][W];          /* what each controller ended up with */
+
+static uint32_t rng_state = 1;
+
+static int rnd (int n) {
+  rng_state ^= rng_state << 13;
+  rng_state ^= rng_state >> 17;
+  rng_state ^= rng_state << 5;
+  return (int)(rng_state % (uint32_t)n);
+}
+
+static void put (int x, int y, uint16_t colour) {
+  GLCD_SetTextColor(colour);
+  GLCD_PutPixel(x, y);
+  ref[y][x] = colour;
+}
+
+/* A 9 x 9 ball rolling right and down, erased and redrawn each step like
+   eraseSprite and drawSpriteAt do, one pixel at a time                       */
+static void sprites (void) {
+  for (int step = 0; step < 200; step++) {
+    int x = 20 + step, y = 40 + step / 2;
+
+    for (int j = 0; j < 9; j++)
+      for (int i = 0; i < 9; i++)
+        put(x - 1 + i, y - 1 + j, Green);
+    for (int j = 0; j < 9; j++)
+      for (int i = 0; i < 9; i++)
+        put(x + i, y + j, White);
+  }
+}
+
+static void scattered (void) {
+  for (int k = 0; k < 20000; k++)
+    put(rnd(W), rnd(H), (uint16_t)rnd(0x10000));
+}
+
+/* 16 x 16 blocks through a window, GLCD_Bitmap rows run bottom up            */
+static void windows (void) {
+  static uint16_t block[16 * 16];
+
+  for (int k = 0; k < 100; k++) {
+    int x = rnd(W - 16), y = rnd(H - 16);
+
+    for (int i = 0; i < 16 * 16; i++)
+      block[i] = (uint16_t)rnd(0x10000);
+    GLCD_Bitmap(x, y, 16, 16, (unsigned char *)block);
+    for (int r = 0; r < 16; r++)
+      memcpy(&ref[y + r][x], &block[(15 - r) * 16], 16 * sizeof(uint16_t));
+  }
+}
+
+/* The driver's fonts: pixel i of a row is bit i, rows run top down         */
+extern const unsigned char  Font_6x8_h[];
+extern const unsigned short Font_16x24_h[];
+
+/* What a string at (ln, col) should look like, cut at the right edge        */
+static void text_ref (int ln, int col, int fi, const char *s, uint16_t fg, uint16_t bg) {
+  int cw = fi ? 16 : 6, ch = fi ? 24 : 8;
+
+  for (int k = 0; s[k]; k++)
+    for (int j = 0; j < ch; j++) {
+      unsigned int c = (unsigned char)s[k] - 32;
+      unsigned int pixs = fi ? Font_16x24_h[c * 24 + j] : Font_6x8_h[c * 8 + j];
+
+      for (int i = 0; i < cw && (col + k) * cw + i < W; i++)
+        ref[ln * ch + j][(col + k) * cw + i] = (pixs >> i) & 1 ? fg : bg;
+    }
+}
+
+static const char *const hud[] = { "Strokes: 12 ok", "Hole 3  Par 4", "Power [#####   ]", "Angle 135" };
+
+/* A status screen: a few lines repeated in two colour schemes, the last
+   ones running off the right edge                                           */
+static void text_lines (bool by_char) {
+  for (int ln = 0; ln < 10; ln++) {
+    const char *s = hud[ln % 4];
+    int col = ln < 8 ? 0 : 12;
+    uint16_t fg = ln & 1 ? Yellow : White;
+
+    GLCD_SetBackColor(Blue);
+    GLCD_SetTextColor(fg);
+    if (by_char)
+      for (int k = 0; s[k]; k++)
+        GLCD_DisplayChar(ln, col + k, 1, (unsigned char)s[k]);
+    else
+      GLCD_DisplayString(ln, col, 1, (unsigned char *)s);
+    text_ref(ln, col, 1, s, fg, Blue);
+  }
+  for (int ln = 0; ln < 30; ln++) {
+    GLCD_SetBackColor(Black);
+    GLCD_SetTextColor(Green);
+    GLCD_DisplayString(ln, ln < 28 ? 0 : 45, 0, (unsigned char *)hud[ln % 4]);
+    text_ref(ln, ln < 28 ? 0 : 45, 0, hud[ln % 4], Green, Black);
+  }
+}
+
+static void text (void) {
+  text_lines(false);
+}
+
+static void text_chars (void) {
+  text_lines(true);
+}
+
+static void clear (void) {
+  GLCD_Clear(Green);
+  for (int y = 0; y < H; y++)
+    for (int x = 0; x < W; x++)
+      ref[y][x] = Green;
+}
+
+typedef struct {
+  const char *name;
+  void (*run) (void);
+  bool check;                           /* ref holds the expected picture     */
+} Workload;
+
+static const Workload workloads[] = {
+  { "clear",     clear,     true  },
+  { "sprites",   sprites,   true  },
+  { "scattered", scattered, true  },
+  { "windows",   windows,   true  },
+  { "text",      text,      true  },
+  { "chars",     text_chars, true  },
+};
+
+int main (void) {
+  static const char *names[] = { "HX8347-D", "ILI9320" };
+  int failures = 0, runs = 0;
+
+  printf("%-9s %-10s %10s %10s %8s %8s %8s %8s\n", "lcd", "drawing", "pixels", "SPI bytes", "B/pixel", "CS/pixel", "elided",
+         "glyphs");
+
+  for (int c = LCD_MODEL_HIMAX; c <= LCD_MODEL_ILI; c++) {
+#if defined(GLCD_CONTROLLER) && GLCD_CONTROLLER != 0
+    if (c != GLCD_CONTROLLER - 1)
+      continue;
+#endif
+    lcd_model_reset((LcdModelController)c);
+    GLCD_Init();
+    rng_state = 1;
+    memset(ref, 0, sizeof(ref));
+
+    for (size_t w = 0; w < sizeof(workloads) / sizeof(workloads[0]); w++) {
+      LcdModelStats before = lcd_model_stats;
+      unsigned int bytes = GLCD_SpiBytes, elided = GLCD_ElidedWrites, misses = GLCD_GlyphMisses;
+      double pixels;
+
+      workloads[w].run();
+      pixels = (double)(lcd_model_stats.pixels - before.pixels);
+      printf("%-9s %-10s %10.0f %10u %8.2f %8.2f %8u %8u\n", names[c], workloads[w].name, pixels, GLCD_SpiBytes - bytes,
+             pixels ? (GLCD_SpiBytes - bytes) / pixels : 0,
+             pixels ? (lcd_model_stats.frames - before.frames) / pixels : 0, GLCD_ElidedWrites - elided,
+             GLCD_GlyphMisses - misses);
+
+      if (workloads[w].check && memcmp(ref, lcd_model_fb, sizeof(ref))) {
+        printf("  FAIL %s draws a different picture on the %s\n", workloads[w].name, names[c]);
+        failures++;
+      }
+      if (lcd_model_stats.offscreen != before.offscreen) {
+        printf("  FAIL %s wrote %llu pixels outside the screen\n", workloads[w].name,
+               (unsigned long long)(lcd_model_stats.offscreen - before.offscreen));
+        failures++;
+      }
+      if (lcd_model_stats.bytes - before.bytes != GLCD_SpiBytes - bytes) {
+        printf("  FAIL %s: the driver counted %u SPI bytes, the model saw %llu\n", workloads[w].name,
+               GLCD_SpiBytes - bytes, (unsigned long long)(lcd_model_stats.bytes - before.bytes));
+        failures++;
+      }
+    }
+    memcpy(shot[runs++], lcd_model_fb, sizeof(lcd_model_fb));
+  }
+
+  if (runs == 2 && memcmp(shot[0], shot[1], sizeof(shot[0]))) {
+    printf("  FAIL the two controllers show different pictures\n");
+    failures++;
+  }
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,56 @@
+/*----------------------------------------------------------------------------
+* Name:    cmsis_os2.h (host)
+* Purpose: Stand-in for the CMSIS-RTOS2 API when game code is built on the
+*          host (see tools/scripttest.c)
+* Note(s): Only the types and calls the game uses are declared. There is
+*          no kernel: each host tool defines the calls its code reaches,
+*          e.g. a fake clock for osKernelGetSysTimerCount or a pthread
+*          mutex behind osMutexAcquire.
+*----------------------------------------------------------------------------*/
+#ifndef HOST_CMSIS_OS2
+#define HOST_CMSIS_OS2
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef void *osThreadId_t;
+typedef void *osMutexId_t;
+typedef void *osTimerId_t;
+typedef void (*osThreadFunc_t) (void *argument);
+typedef void (*osTimerFunc_t) (void *argument);
+
+typedef enum {
+  osOK = 0, osError = -1, osErrorTimeout = -2, osErrorResource = -3, osErrorParameter = -4
+} osStatus_t;
+
+typedef enum { osTimerOnce = 0, osTimerPeriodic = 1 } osTimerType_t;
+
+typedef struct { const char *name; uint32_t attr_bits; void *cb_mem; uint32_t cb_size; } osMutexAttr_t;
+typedef struct { const char *name; uint32_t attr_bits; void *cb_mem; uint32_t cb_size; } osTimerAttr_t;
+typedef struct {
+  const char *name; uint32_t attr_bits; void *cb_mem; uint32_t cb_size;
+  void *stack_mem; uint32_t stack_size; int32_t priority; uint32_t tz_module; uint32_t reserved;
+} osThreadAttr_t;
+
+#define osWaitForever 0xFFFFFFFFU
+
+osStatus_t   osKernelInitialize (void);
+osStatus_t   osKernelStart (void);
+uint32_t     osKernelGetTickCount (void);
+uint32_t     osKernelGetSysTimerCount (void);
+uint32_t     osKernelGetSysTimerFreq (void);
+
+osThreadId_t osThreadNew (osThreadFunc_t func, void *argument, const osThreadAttr_t *attr);
+osStatus_t   osThreadTerminate (osThreadId_t thread_id);
+osStatus_t   osThreadYield (void);
+osStatus_t   osDelay (uint32_t ticks);
+
+osMutexId_t  osMutexNew (const osMutexAttr_t *attr);
+osStatus_t   osMutexAcquire (osMutexId_t mutex_id, uint32_t timeout);
+osStatus_t   osMutexRelease (osMutexId_t mutex_id);
+
+osTimerId_t  osTimerNew (osTimerFunc_t func, osTimerType_t type, void *argument, const osTimerAttr_t *attr);
+osStatus_t   osTimerStart (osTimerId_t timer_id, uint32_t ticks);
+osStatus_t   osTimerStop (osTimerId_t timer_id);
+
+#endif
@@ -0,0 +1,49 @@
+/*----------------------------------------------------------------------------
+* Name:    lpc17xx.h (host)
+* Purpose: Stand-in for the LPC17xx device header when a board driver is
+*          built on the host against a model (see tools/lcdmodel.c)
+* Note(s): Only the peripherals the LCD driver and the text console
+*          (GLCD_Scroll.c, its joystick) touch are here; they are
+*          plain memory, the model does the talking instead of the SSP.
+*          Also TIMER1 and GPIO2 for the LED dimming (leds.c), which
+*          tools/ledtest.c steps as the timer would, and the NVIC calls
+*          that driver makes, defined by the tool.
+*          The barrier the lock-free structures use maps to a full host
+*          fence (tools/snaptest.c).
+*----------------------------------------------------------------------------*/
+#ifndef HOST_LPC17XX
+#define HOST_LPC17XX
+
+#include <stdint.h>
+
+typedef struct { volatile uint32_t PCONP, PCLKSEL0; } LPC_SC_TypeDef;
+typedef struct { volatile uint32_t PINSEL0, PINSEL3, PINSEL9, PINMODE0; } LPC_PINCON_TypeDef;
+typedef struct { volatile uint32_t FIODIR, FIOPIN, FIOSET, FIOCLR; } LPC_GPIO_TypeDef;
+typedef struct { volatile uint32_t CR0, CR1, DR, SR, CPSR; } LPC_SSP_TypeDef;
+typedef struct { volatile uint32_t IR, TCR, TC, PR, MCR, MR0; } LPC_TIM_TypeDef;
+
+typedef enum { TIMER1_IRQn = 2 } IRQn_Type;
+
+extern LPC_SC_TypeDef     host_sc;
+extern LPC_PINCON_TypeDef host_pincon;
+extern LPC_GPIO_TypeDef   host_gpio0, host_gpio1, host_gpio2, host_gpio4;
+extern LPC_SSP_TypeDef    host_ssp1;
+extern LPC_TIM_TypeDef    host_tim1;
+extern uint32_t           SystemCoreClock;
+
+void NVIC_EnableIRQ  (IRQn_Type irq);
+void NVIC_DisableIRQ (IRQn_Type irq);
+
+#define LPC_SC      (&host_sc)
+#define LPC_PINCON  (&host_pincon)
+#define LPC_GPIO0   (&host_gpio0)
+#define LPC_GPIO1   (&host_gpio1)
+#define LPC_GPIO2   (&host_gpio2)
+#define LPC_GPIO4   (&host_gpio4)
+#define LPC_SSP1    (&host_ssp1)
+#define LPC_TIM1    (&host_tim1)
+
+/* Barriers: the host tools run the game's lock-free code on threads       */
+#define __DMB()     __sync_synchronize()
+
+#endif
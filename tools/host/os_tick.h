@@ -0,0 +1,9 @@
+/*----------------------------------------------------------------------------
+* Name:    os_tick.h (host)
+* Purpose: Stand-in for the RTX tick timer interface on the host
+* Note(s): The game only includes it; nothing in it is used off the board.
+*----------------------------------------------------------------------------*/
+#ifndef HOST_OS_TICK
+#define HOST_OS_TICK
+
+#endif
@@ -0,0 +1,164 @@
+/*----------------------------------------------------------------------------
+* Name:    hudtest.c
+* Purpose: Host test of the incremental HUD strip (hud.c) on the LCD model
+* Note(s): Draws a course with the HUD over it, then makes 3000 updates of
+*          the strokes, power and angle, with the ball now and then drawn
+*          and erased under the strip. Checks that:
+*            - each update writes exactly the pixels it reports, and no
+*              more than HUD_MAX_PIXELS (HUD_MAX_SPI_BYTES on the SPI)
+*            - the screen always shows the background layer, HUD
+*              included (sceneBackgroundAt), so nothing is left stale
+*            - the angle read back off the screen is the direction the
+*              shot leaves in, atan2 of launchVelocity's velocity
+*          The HUD is drawn in full only once, so a run tests one LCD
+*          controller: the HX8347-D, or the one GLCD_CONTROLLER picks.
+*
+*          Build from the repository root:
+*            cc -O2 -std=gnu11 -DGLCD_MODEL -I. -Itools/host -Itools \
+*               -Iexample-game tools/hudtest.c hud.c scene.c blit.c \
+*               course.c courseData.c physics.c tools/lcdmodel.c \
+*               example-game/GLCD_SPI_LPC1700.c -lm -o hudtest
+*
+*          Usage: hudtest [updates]    (exit status 1 if any check fails)
+*----------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <math.h>
+
+#include "gameLogic.h"
+#include "lcdmodel.h"
+
+#define W COURSE_WIDTH
+#define H COURSE_HEIGHT
+
+static char ball[] = { 0x38, 0x38, 0x38 };     /* gameLogic.c's ballBitmap */
+
+/* Pixels that differ from the background layer; prints the first one of
+   the first check that finds any                                           */
+static int stale (const char *when) {
+  static bool reported;
+  int bad = 0;
+
+  for (int y = 0; y < H; y++)
+    for (int x = 0; x < W; x++)
+      if (lcd_model_fb[y][x] != sceneBackgroundAt(x, y)) {
+        if (!bad && !reported)
+          printf("  FAIL %s: (%d, %d) shows %04x, background %04x\n", when, x, y, lcd_model_fb[y][x],
+                 sceneBackgroundAt(x, y));
+        bad++;
+      }
+  reported |= bad != 0;
+  return bad;
+}
+
+extern const unsigned char Font_6x8_h[];
+
+/* The digit shown in a column of the strip, or -1 if none matches          */
+static int shown_digit (int col) {
+  for (int d = 0; d < 10; d++) {
+    const unsigned char *glyph = &Font_6x8_h[('0' + d - 32) * HUD_CHAR_H];
+    bool match = true;
+
+    for (int y = 0; y < HUD_CHAR_H && match; y++)
+      for (int x = 0; x < HUD_CHAR_W && match; x++)
+        match = (lcd_model_fb[y][col * HUD_CHAR_W + x] == White) == ((glyph[y] >> x) & 1);
+    if (match)
+      return d;
+  }
+  return -1;
+}
+
+/* The angle in the last three columns, "A135"                              */
+static int shown_angle (void) {
+  int angle = 0;
+
+  for (int col = HUD_COLS - 3; col < HUD_COLS; col++) {
+    int d = shown_digit(col);
+
+    if (d < 0)
+      return -1;
+    angle = angle * 10 + d;
+  }
+  return angle;
+}
+
+/* The direction a shot leaves in, 0 to 360 degrees on the screen's axes   */
+static double launch_degrees (int32_t angle, uint32_t power) {
+  int vx, vy;
+
+  launchVelocity(angle, power, &vx, &vy);
+  return fmod(atan2(vy, vx) * 180 / M_PI + 360, 360);
+}
+
+int main (int argc, char **argv) {
+#if defined(GLCD_CONTROLLER) && GLCD_CONTROLLER == 2
+  LcdModelController lcd = LCD_MODEL_ILI;
+#else
+  LcdModelController lcd = LCD_MODEL_HIMAX;
+#endif
+  static const char *names[] = { "HX8347-D", "ILI9320" };
+  int updates = argc > 1 ? atoi(argv[1]) : 3000;
+  uint32_t pixels, most = 0, bytes, most_bytes = 0, first;
+  unsigned int start;
+  int failures = 0, shown;
+  Course course;
+
+  /* As main.c and setupGame: the fairway, the course, then the HUD         */
+  parseCourse(COURSE_DATA[0], COURSE_SIZES[0], &course);
+  lcd_model_reset(lcd);
+  GLCD_Init();
+  GLCD_Clear(Green);
+  sceneReset(&course);
+  drawScene();
+  first = hudUpdate(0, SHOT_MIN_POWER, 0);
+  failures += stale("after the first update") != 0;
+
+  start = GLCD_SpiBytes;
+  for (int k = 0; k < updates; k++) {
+    int strokes = k / 150;
+    uint32_t power = SHOT_MIN_POWER + (uint32_t)(k * 7 / 13) % (SHOT_MAX_POWER - SHOT_MIN_POWER + 1);
+    int32_t angle = (k * 31) % 342;
+    uint64_t before = lcd_model_stats.pixels;
+    double heading;
+
+    bytes = GLCD_SpiBytes;
+    pixels = hudUpdate(strokes, power, angle);
+    bytes = GLCD_SpiBytes - bytes;
+    if (lcd_model_stats.pixels - before != pixels) {
+      printf("  FAIL update %d reports %u pixels, wrote %llu\n", k, pixels,
+             (unsigned long long)(lcd_model_stats.pixels - before));
+      failures++;
+    }
+    shown = shown_angle();
+    heading = launch_degrees(angle, power);
+    if (shown < 0 || fabs(remainder(shown - heading, 360)) > 1) {
+      printf("  FAIL update %d: raw angle %d shows A%03d, the shot leaves at %.1f\n", k, angle, shown, heading);
+      failures++;
+    }
+    if (pixels > HUD_MAX_PIXELS || bytes > HUD_MAX_SPI_BYTES) {
+      printf("  FAIL update %d: %u pixels, %u SPI bytes, over the budget\n", k, pixels, bytes);
+      failures++;
+    }
+    most = pixels > most ? pixels : most;
+    most_bytes = bytes > most_bytes ? bytes : most_bytes;
+
+    /* The ball over the strip and off it again                             */
+    if (k % 97 == 0) {
+      Pos p = { (k * 13) % (HUD_WIDTH + 10) - 5, (k * 7) % (HUD_HEIGHT + 6) - 5 };
+
+      GLCD_SetTextColor(White);
+      drawSpriteAt(p.x, p.y, ball, sizeof(ball));
+      eraseSprite(p, ball, sizeof(ball));
+    }
+    if (k % 50 == 0 && stale("during the updates"))
+      failures++;
+  }
+  failures += stale("after the last update") != 0;
+
+  printf("%-9s first %u pixels; %d updates: at most %u pixels (budget %d), %u SPI bytes (budget %d), "
+         "%.1f bytes each\n", names[lcd], first, updates, most, HUD_MAX_PIXELS, most_bytes, HUD_MAX_SPI_BYTES,
+         updates ? (double)(GLCD_SpiBytes - start) / updates : 0);
+  return failures ? 1 : 0;
+}
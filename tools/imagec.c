@@ -0,0 +1,352 @@
+/*----------------------------------------------------------------------------
+* Name:    imagec.c
+* Purpose: Image compiler: pictures to the run-length coded image format
+* Note(s): Codes each picture as runs of one pixel and stretches of literal
+*          pixels (the format is in GLCD_BitmapRLE) and writes the C source
+*          of the images built into the game, one RleImage per picture,
+*          named after its file: screens/win.txt gives winImage. Pixels
+*          are palette indices while a picture has at most RLE_PALETTE_MAX
+*          colours, RGB565 otherwise. Every image is decoded again and
+*          checked against its picture before it is written.
+*
+*          Pictures are binary PPM files (P6, 8 bits a channel) or text
+*          art, one item per line, '#' starts a comment:
+*            scale N                   (each character is N x N pixels)
+*            colour C RRRR             (character C is RGB565 colour RRRR)
+*            rows                      (every line after it is one row)
+*
+*          Build from the repository root:
+*            cc -O2 -std=gnu11 -I. -Iexample-game tools/imagec.c -o imagec
+*
+*          Usage: imagec -c screenData.c screens/title.txt ...
+*----------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <ctype.h>
+#include <unistd.h>
+
+#include "blit.h"
+
+#define MAX_W COURSE_WIDTH
+#define MAX_H COURSE_HEIGHT
+#define MAX_IMAGES 16
+#define MAX_COUNT 0x4000                /* longest run or literal stretch     */
+#define CODED_MAX (MAX_W * MAX_H * 3)   /* worst case, all literal RGB565     */
+
+typedef struct {
+  int w, h;
+  uint16_t pixels[MAX_H][MAX_W];
+} Picture;
+
+static const char *file;
+static int line;
+
+static void fail (const char *msg) {
+  if (line)
+    fprintf(stderr, "%s:%d: %s\n", file, line, msg);
+  else
+    fprintf(stderr, "%s: %s\n", file, msg);
+  exit(1);
+}
+
+/* P6: "P6 W H 255", comments allowed in the header, then RGB bytes        */
+static int ppm_number (FILE *f) {
+  int c, n = 0;
+
+  while ((c = fgetc(f)) == '#' || isspace(c))
+    if (c == '#')
+      while ((c = fgetc(f)) != '\n' && c != EOF)
+        ;
+  if (!isdigit(c))
+    fail("bad PPM header");
+  for (; isdigit(c); c = fgetc(f))
+    n = n * 10 + c - '0';
+  return n;
+}
+
+static void read_ppm (FILE *f, Picture *pic) {
+  if (fgetc(f) != 'P' || fgetc(f) != '6')
+    fail("not a binary PPM (P6)");
+  pic->w = ppm_number(f);
+  pic->h = ppm_number(f);
+  if (ppm_number(f) != 255)
+    fail("only 8 bits a channel");
+  if (pic->w <= 0 || pic->h <= 0 || pic->w > MAX_W || pic->h > MAX_H)
+    fail("bigger than the screen");
+
+  for (int y = 0; y < pic->h; y++)
+    for (int x = 0; x < pic->w; x++) {
+      int r = fgetc(f), g = fgetc(f), b = fgetc(f);
+
+      if (b == EOF)
+        fail("PPM is cut short");
+      pic->pixels[y][x] = (uint16_t)(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3));
+    }
+}
+
+static void read_art (FILE *f, Picture *pic) {
+  static uint16_t colour[256];
+  static bool defined[256];
+  char buf[1024];
+  int scale = 1, rows = 0;
+  bool art = false;
+
+  memset(defined, 0, sizeof(defined));
+  pic->w = 0;
+  while (fgets(buf, sizeof(buf), f)) {
+    char kind[16], c;
+    unsigned int v;
+    int n;
+
+    line++;
+    buf[strcspn(buf, "\r\n")] = 0;
+    if (art) {
+      n = (int)strlen(buf);
+      if (rows == 0)
+        pic->w = n * scale;
+      if (n * scale != pic->w)
+        fail("rows of different lengths");
+      if (pic->w > MAX_W || (rows + 1) * scale > MAX_H)
+        fail("bigger than the screen");
+      for (int x = 0; x < n; x++) {
+        if (!defined[(unsigned char)buf[x]])
+          fail("character without a colour");
+        for (int j = 0; j < scale; j++)
+          for (int i = 0; i < scale; i++)
+            pic->pixels[rows * scale + j][x * scale + i] = colour[(unsigned char)buf[x]];
+      }
+      rows++;
+      continue;
+    }
+
+    buf[strcspn(buf, "#")] = 0;
+    if (sscanf(buf, "%15s", kind) != 1)
+      continue;
+    if (!strcmp(kind, "scale")) {
+      if (sscanf(buf, "%*s %d", &scale) != 1 || scale < 1 || scale > MAX_H)
+        fail("scale needs a size");
+    } else if (!strcmp(kind, "colour")) {
+      if (sscanf(buf, "%*s %c %x", &c, &v) != 2 || v > 0xFFFF)
+        fail("colour needs a character and an RGB565 value");
+      colour[(unsigned char)c] = (uint16_t)v;
+      defined[(unsigned char)c] = true;
+    } else if (!strcmp(kind, "rows")) {
+      art = true;
+    } else {
+      fail("unknown item");
+    }
+  }
+  line = 0;
+  if (rows == 0)
+    fail("no rows");
+  pic->h = rows * scale;
+}
+
+static void read_picture (const char *path, Picture *pic) {
+  FILE *f = fopen(path, "rb");
+  const char *dot = strrchr(path, '.');
+
+  file = path;
+  line = 0;
+  if (!f) {
+    perror(path);
+    exit(1);
+  }
+  if (dot && !strcmp(dot, ".ppm"))
+    read_ppm(f, pic);
+  else
+    read_art(f, pic);
+  fclose(f);
+}
+
+/* The picture's colours, in the order they first appear; 0 if too many    */
+static int make_palette (const Picture *pic, uint16_t *palette) {
+  static int16_t index[0x10000];
+  int n = 0;
+
+  memset(index, -1, sizeof(index));
+  for (int y = 0; y < pic->h; y++)
+    for (int x = 0; x < pic->w; x++)
+      if (index[pic->pixels[y][x]] < 0) {
+        if (n == RLE_PALETTE_MAX)
+          return 0;
+        index[pic->pixels[y][x]] = (int16_t)n;
+        palette[n++] = pic->pixels[y][x];
+      }
+  return n;
+}
+
+static int put_count (uint8_t *out, int literal, int n) {
+  if (n <= 0x40) {
+    out[0] = (uint8_t)((literal ? 0x80 : 0) | (n - 1));
+    return 1;
+  }
+  out[0] = (uint8_t)((literal ? 0x80 : 0) | 0x40 | ((n - 1) >> 8));
+  out[1] = (uint8_t)(n - 1);
+  return 2;
+}
+
+static int put_pixel (uint8_t *out, uint16_t v, const uint16_t *palette, int colours) {
+  if (colours) {
+    for (int i = 0; i < colours; i++)
+      if (palette[i] == v) {
+        out[0] = (uint8_t)i;
+        return 1;
+      }
+  }
+  out[0] = (uint8_t)(v >> 8);
+  out[1] = (uint8_t)v;
+  return 2;
+}
+
+/* Greedy coding: a run as soon as one is worth it (3 pixels with a palette,
+   where a run costs 2 bytes, 2 pixels with RGB565), literals in between   */
+static uint32_t encode (const Picture *pic, const uint16_t *palette, int colours, uint8_t *out) {
+  static uint16_t px[MAX_W * MAX_H];
+  int total = pic->w * pic->h, min_run = colours ? 3 : 2;
+  uint32_t size = 0;
+  int i = 0;
+
+  /* The rows one after the other, as the LCD window takes them             */
+  for (int y = 0; y < pic->h; y++)
+    memcpy(&px[y * pic->w], pic->pixels[y], pic->w * sizeof(uint16_t));
+
+  while (i < total) {
+    int run = 1, start = i;
+
+    while (i + run < total && run < MAX_COUNT && px[i + run] == px[i])
+      run++;
+    if (run >= min_run) {
+      size += put_count(out + size, 0, run);
+      size += put_pixel(out + size, px[i], palette, colours);
+      i += run;
+      continue;
+    }
+
+    /* Literals up to the next run worth coding                             */
+    while (i < total && i - start < MAX_COUNT) {
+      run = 1;
+      while (i + run < total && run < min_run && px[i + run] == px[i])
+        run++;
+      if (run >= min_run)
+        break;
+      i++;
+    }
+    size += put_count(out + size, 1, i - start);
+    for (int k = start; k < i; k++)
+      size += put_pixel(out + size, px[k], palette, colours);
+  }
+  return size;
+}
+
+/* Decodes the codes again, the way GLCD_BitmapRLE does, and compares       */
+static void verify (const Picture *pic, const uint8_t *data, uint32_t size, const uint16_t *palette, int colours) {
+  const uint8_t *end = data + size;
+  int i = 0, total = pic->w * pic->h;
+
+  while (i < total && data < end) {
+    int code = *data++, n = code & 0x3F;
+    bool literal = code & 0x80;
+
+    if (code & 0x40)
+      n = (n << 8) | *data++;
+    for (n++; n > 0; n--, i++) {
+      uint16_t v = colours ? palette[*data] : (uint16_t)(data[0] << 8 | data[1]);
+
+      if (i >= total || v != pic->pixels[i / pic->w][i % pic->w])
+        fail("the coded image does not decode to the picture");
+      if (literal || n == 1)
+        data += colours ? 1 : 2;
+    }
+  }
+  if (i != total || data != end)
+    fail("the coded image does not decode to the picture");
+}
+
+/* Symbol name: the file name without directories and extension, + Image   */
+static void symbol (const char *path, char *name, size_t len) {
+  const char *base = strrchr(path, '/');
+  size_t n;
+
+  base = base ? base + 1 : path;
+  n = strcspn(base, ".");
+  if (n == 0 || n + 6 > len || !isalpha((unsigned char)base[0]))
+    fail("the file name does not make a C name");
+  for (size_t i = 0; i < n; i++)
+    if (!isalnum((unsigned char)base[i]) && base[i] != '_')
+      fail("the file name does not make a C name");
+  memcpy(name, base, n);
+  strcpy(name + n, "Image");
+}
+
+static void write_c (FILE *out, char **paths, int count) {
+  static Picture pic;
+  static uint8_t coded[CODED_MAX];
+  uint16_t palette[RLE_PALETTE_MAX];
+
+  fprintf(out, "// Generated by tools/imagec from:");
+  for (int i = 0; i < count; i++)
+    fprintf(out, " %s", paths[i]);
+  fprintf(out, "\n// Do not edit; edit the pictures and run imagec -c again.\n\n");
+  fprintf(out, "#include \"blit.h\"\n");
+
+  for (int i = 0; i < count; i++) {
+    char name[64];
+    int colours;
+    uint32_t size;
+
+    read_picture(paths[i], &pic);
+    symbol(paths[i], name, sizeof(name));
+    colours = make_palette(&pic, palette);
+    size = encode(&pic, palette, colours, coded);
+    verify(&pic, coded, size, palette, colours);
+
+    fprintf(out, "\n// %s: %d x %d, %d colours, %u bytes (%.1f%% of 16 bpp)\n", paths[i], pic.w, pic.h,
+            colours, size, 100.0 * size / (pic.w * pic.h * 2));
+    if (colours) {
+      fprintf(out, "static const unsigned short %sPalette[%d] = {", name, colours);
+      for (int k = 0; k < colours; k++)
+        fprintf(out, "%s0x%04X,", (k % 8) ? " " : "\n\t", palette[k]);
+      fprintf(out, "\n};\n");
+    }
+    fprintf(out, "static const uint8_t %sData[%u] = {", name, size);
+    for (uint32_t k = 0; k < size; k++)
+      fprintf(out, "%s0x%02X,", (k % 16) ? " " : "\n\t", coded[k]);
+    fprintf(out, "\n};\n");
+    fprintf(out, "const RleImage %s = { %d, %d, %d, %s%s, %sData, %u };\n", name, pic.w, pic.h, colours,
+            colours ? name : "NULL", colours ? "Palette" : "", name, size);
+
+    printf("%s: %d x %d, %d colours, %u bytes (%.1f%% of 16 bpp)\n", name, pic.w, pic.h, colours, size,
+           100.0 * size / (pic.w * pic.h * 2));
+  }
+}
+
+int main (int argc, char **argv) {
+  const char *csource = NULL;
+  FILE *out;
+  int opt;
+
+  while ((opt = getopt(argc, argv, "c:")) != -1) {
+    switch (opt) {
+      case 'c': csource = optarg; break;
+      default: goto usage;
+    }
+  }
+  if (!csource || optind >= argc || argc - optind > MAX_IMAGES)
+    goto usage;
+
+  if (!(out = fopen(csource, "w"))) {
+    perror(csource);
+    return 1;
+  }
+  write_c(out, &argv[optind], argc - optind);
+  fclose(out);
+  return 0;
+
+usage:
+  fprintf(stderr, "usage: %s -c screenData.c picture.txt|picture.ppm...\n", argv[0]);
+  return 2;
+}
@@ -0,0 +1,191 @@
+/*----------------------------------------------------------------------------
+* Name:    lcdmodel.c
+* Purpose: Host model of the board's SPI LCD, see lcdmodel.h
+* Note(s): An SPI transfer is a start byte (0x70 | RS << 1 | RW) followed
+*          by 16-bit words: with RS = 0 the word selects a register, with
+*          RS = 1 it is written to (or read from) the selected register.
+*          Words written to register 0x22 are pixels.
+*
+*          The panel is 240 sources by 320 gate lines; vertical scrolling
+*          turns the gate lines around, which is the screen's x axis in
+*          landscape and its y axis in portrait.
+*----------------------------------------------------------------------------*/
+#include <string.h>
+
+#include "lcdmodel.h"
+#include "lpc17xx.h"
+
+#define SPI_RD      0x01
+#define SPI_DATA    0x02
+#define GRAM        0x22
+
+/* The peripherals the driver touches directly (tools/host/lpc17xx.h)         */
+LPC_SC_TypeDef     host_sc;
+LPC_PINCON_TypeDef host_pincon;
+LPC_GPIO_TypeDef   host_gpio0, host_gpio1, host_gpio4;
+LPC_SSP_TypeDef    host_ssp1;
+
+uint16_t lcd_model_fb[LCD_MODEL_HEIGHT][LCD_MODEL_WIDTH];
+int lcd_model_width = LCD_MODEL_WIDTH, lcd_model_height = LCD_MODEL_HEIGHT;
+LcdModelStats lcd_model_stats;
+
+static LcdModelController model;
+static uint16_t regs[256];
+static uint8_t index_reg;
+static int cx, cy;                      /* GRAM address counter, in pixels    */
+
+static int in_frame, frame_pos, start, word_hi;
+
+void lcd_model_reset (LcdModelController controller) {
+  model = controller;
+  memset(regs, 0, sizeof(regs));
+  memset(lcd_model_fb, 0, sizeof(lcd_model_fb));
+  memset(&lcd_model_stats, 0, sizeof(lcd_model_stats));
+  regs[0x00] = (controller == LCD_MODEL_HIMAX) ? 0x0047 : 0x9320;   /* ID   */
+  lcd_model_width = LCD_MODEL_WIDTH;
+  lcd_model_height = LCD_MODEL_HEIGHT;
+  index_reg = 0;
+  cx = cy = 0;
+  in_frame = 0;
+}
+
+uint16_t lcd_model_reg (uint8_t reg) {
+  return regs[reg];
+}
+
+static int landscape (void) {
+  if (model == LCD_MODEL_HIMAX)
+    return (regs[0x16] & 0x20) != 0;    /* MADCTL: rows and columns swapped   */
+  return (regs[0x03] & 0x08) != 0;      /* entry mode: AM, vertical update    */
+}
+
+/* Window in screen pixels                                                    */
+static void window (int *x0, int *x1, int *y0, int *y1) {
+  if (model == LCD_MODEL_HIMAX) {
+    *x0 = (regs[0x02] << 8) | regs[0x03];
+    *x1 = (regs[0x04] << 8) | regs[0x05];
+    *y0 = (regs[0x06] << 8) | regs[0x07];
+    *y1 = (regs[0x08] << 8) | regs[0x09];
+  } else if (landscape()) {             /* vertical GRAM is x                 */
+    *x0 = regs[0x52];
+    *x1 = regs[0x53];
+    *y0 = regs[0x50];
+    *y1 = regs[0x51];
+  } else {
+    *x0 = regs[0x50];
+    *x1 = regs[0x51];
+    *y0 = regs[0x52];
+    *y1 = regs[0x53];
+  }
+}
+
+/* The line of GRAM the gate line shows, scrolled                             */
+static int scrolled (int gate) {
+  int on, line;
+
+  if (model == LCD_MODEL_HIMAX) {
+    on = (regs[0x01] & 0x08) != 0;
+    line = (regs[0x14] << 8) | regs[0x15];
+  } else {
+    on = (regs[0x61] & 0x02) != 0;
+    line = regs[0x6A];
+  }
+  return on ? (gate + line) % 320 : gate;
+}
+
+uint16_t lcd_model_screen (int x, int y) {
+  if (lcd_model_width == 320)
+    x = scrolled(x);
+  else
+    y = scrolled(y);
+  return (&lcd_model_fb[0][0])[y * lcd_model_width + x];
+}
+
+static void put_pixel (uint16_t colour) {
+  int x0, x1, y0, y1;
+
+  window(&x0, &x1, &y0, &y1);
+  if (cx >= 0 && cx < lcd_model_width && cy >= 0 && cy < lcd_model_height)
+    (&lcd_model_fb[0][0])[cy * lcd_model_width + cx] = colour;
+  else
+    lcd_model_stats.offscreen++;
+  if ((cx >= 0 && cx < lcd_model_width && cy >= 0 && cy < lcd_model_height) &&
+      (x0 > x1 || y0 > y1 || x1 >= lcd_model_width || y1 >= lcd_model_height))
+    lcd_model_stats.offscreen++;
+  lcd_model_stats.pixels++;
+
+  /* Along x within the window, then down a line, then back to the top        */
+  if (++cx > x1) {
+    cx = x0;
+    if (++cy > y1)
+      cy = y0;
+  }
+}
+
+static void set_reg (uint8_t reg, uint16_t val) {
+  if (model == LCD_MODEL_HIMAX)
+    val &= 0xFF;
+  regs[reg] = val;
+  lcd_model_stats.reg_writes++;
+
+  if ((model == LCD_MODEL_HIMAX && reg == 0x16) || (model == LCD_MODEL_ILI && reg == 0x03)) {
+    lcd_model_width = landscape() ? LCD_MODEL_WIDTH : LCD_MODEL_HEIGHT;
+    lcd_model_height = landscape() ? LCD_MODEL_HEIGHT : LCD_MODEL_WIDTH;
+  }
+  if (model == LCD_MODEL_ILI) {
+    if (reg == 0x20) *(landscape() ? &cy : &cx) = val;
+    if (reg == 0x21) *(landscape() ? &cx : &cy) = val;
+  }
+}
+
+static void select_reg (uint8_t reg) {
+  int x0, x1, y0, y1;
+
+  index_reg = reg;
+  /* The Himax starts every memory write at the window start                  */
+  if (model == LCD_MODEL_HIMAX && reg == GRAM) {
+    window(&x0, &x1, &y0, &y1);
+    cx = x0;
+    cy = y0;
+  }
+}
+
+void lcd_model_cs (int high) {
+  if (!high && !in_frame) {
+    in_frame = 1;
+    frame_pos = 0;
+    lcd_model_stats.frames++;
+  } else if (high) {
+    in_frame = 0;
+  }
+}
+
+unsigned char lcd_model_tran (unsigned char byte) {
+  int pos = frame_pos++;
+
+  lcd_model_stats.bytes++;
+  if (!in_frame)
+    return 0;
+  if (pos == 0) {
+    start = byte;
+    return 0;
+  }
+
+  if (start & SPI_RD) {                 /* dummy byte, then the 16-bit value  */
+    if (pos == 2) return regs[index_reg] >> 8;
+    if (pos == 3) return regs[index_reg] & 0xFF;
+    return 0;
+  }
+
+  if (pos & 1) {
+    word_hi = byte;
+    return 0;
+  }
+  if (!(start & SPI_DATA))
+    select_reg(byte);
+  else if (index_reg == GRAM)
+    put_pixel((word_hi << 8) | byte);
+  else
+    set_reg(index_reg, (word_hi << 8) | byte);
+  return 0;
+}
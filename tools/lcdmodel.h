@@ -0,0 +1,47 @@
+/*----------------------------------------------------------------------------
+* Name:    lcdmodel.h
+* Purpose: Host model of the board's SPI LCD (HX8347-D or ILI9320)
+* Note(s): The LCD driver (example-game/GLCD_SPI_LPC1700.c) built with
+*          -DGLCD_MODEL sends its SPI bytes and chip select here instead of
+*          to the SSP. The model decodes them like the controller does:
+*          register writes, the draw window, the GRAM address counter and
+*          pixel writes into a frame buffer, so host tools can count what
+*          each drawing call costs on the wire and check what it drew.
+*          Landscape like the game, or portrait (the driver built with
+*          -DLANDSCAPE=0), with the controllers' vertical scrolling.
+*----------------------------------------------------------------------------*/
+#ifndef LCD_MODEL
+#define LCD_MODEL
+
+#include <stdint.h>
+
+#define LCD_MODEL_WIDTH  320
+#define LCD_MODEL_HEIGHT 240
+
+typedef enum {
+  LCD_MODEL_HIMAX,                      /* HX8347-D: 8-bit registers          */
+  LCD_MODEL_ILI                         /* ILI9320: 16-bit registers          */
+} LcdModelController;
+
+typedef struct {
+  uint64_t bytes;                       /* SPI bytes                          */
+  uint64_t frames;                      /* chip select low .. high            */
+  uint64_t reg_writes;                  /* register writes other than GRAM    */
+  uint64_t pixels;                      /* GRAM writes                        */
+  uint64_t offscreen;                   /* GRAM writes with the address or    */
+                                        /* the window outside the screen      */
+} LcdModelStats;
+
+/* GRAM, as the screen is addressed: lcd_model_width pixels a line, so in
+   portrait it is 240 x 320 laid out over the same memory                     */
+extern uint16_t lcd_model_fb[LCD_MODEL_HEIGHT][LCD_MODEL_WIDTH];
+extern int lcd_model_width, lcd_model_height;
+extern LcdModelStats lcd_model_stats;
+
+void lcd_model_reset (LcdModelController controller);
+void lcd_model_cs (int high);
+unsigned char lcd_model_tran (unsigned char byte);
+uint16_t lcd_model_reg (uint8_t reg);
+uint16_t lcd_model_screen (int x, int y);
+
+#endif
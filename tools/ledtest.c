@@ -0,0 +1,162 @@
+/*----------------------------------------------------------------------------
+* Name:    ledtest.c
+* Purpose: Host test of the LED meter's bit-angle dimming (leds.c)
+* Note(s): Models TIMER1 and the GPIO set/clear registers the driver
+*          writes: the counter runs to MR0 and calls TIMER1_IRQHandler,
+*          FIOSET/FIOCLR stores change the pins. Every brightness is set
+*          in a shuffled order, so the meter fades both ways, and once it
+*          has settled the time each LED is lit is measured over whole
+*          refresh cycles:
+*            - LEDs below the level are always on, LEDs above always off
+*            - the partly lit LED is on for exactly (brightness % 16) of
+*              the 15 units of a cycle, its planes weighted 1, 2, 4, 8
+*            - a whole level stops the timer, so no interrupt runs
+*            - the fade takes one cycle per brightness step
+*
+*          Build from the repository root:
+*            cc -O2 -std=gnu11 -I. -Itools/host tools/ledtest.c leds.c \
+*               -o ledtest
+*
+*          Usage: ledtest     (exit status 1 if any check fails)
+*----------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "leds.h"
+#include <lpc17xx.h>
+
+#define LEVELS          (NUM_LEDS * LED_STEPS + 1)
+#define MEASURE_CYCLES  8
+
+/* The registers leds.c touches                                             */
+LPC_SC_TypeDef   host_sc;
+LPC_GPIO_TypeDef host_gpio1, host_gpio2;
+LPC_TIM_TypeDef  host_tim1;
+uint32_t         SystemCoreClock = 100000000;
+
+static bool irq_enabled;
+void NVIC_EnableIRQ (IRQn_Type irq) { (void)irq; irq_enabled = true; }
+void NVIC_DisableIRQ (IRQn_Type irq) { (void)irq; irq_enabled = false; }
+
+/* Pins of the LEDs, left to right (leds.h)                                 */
+static const uint32_t pin1[NUM_LEDS] = { 1u << 28, 1u << 29, 1u << 31, 0, 0, 0, 0, 0 };
+static const uint32_t pin2[NUM_LEDS] = { 0, 0, 0, 1u << 2, 1u << 3, 1u << 4, 1u << 5, 1u << 6 };
+
+static uint64_t now, on_ticks[NUM_LEDS];
+static long isr_calls;
+static int failures;
+
+static void fail (const char *what, int brightness, long a, long b) {
+  printf("  FAIL brightness %d: %s (%ld, want %ld)\n", brightness, what, a, b);
+  failures++;
+}
+
+/* FIOSET and FIOCLR only act on the bits written as 1. Each driver call
+   stores each of them at most once, so applying them after it is the same  */
+static void apply (LPC_GPIO_TypeDef *g) {
+  if (g->FIOSET & g->FIOCLR)
+    fail("a pin both set and cleared", -1, (long)(g->FIOSET & g->FIOCLR), 0);
+  g->FIOPIN = (g->FIOPIN | g->FIOSET) & ~g->FIOCLR;
+  g->FIOSET = g->FIOCLR = 0;
+}
+
+static void set_brightness (uint32_t brightness) {
+  bool stopped = host_tim1.TCR == 0;
+
+  setLEDBrightness(brightness);
+  if (stopped && host_tim1.TCR == 1)
+    host_tim1.TC = 0;                   /* startTimer's TCR = 2 reset        */
+  if (!irq_enabled)
+    fail("left the timer IRQ masked", (int)brightness, 0, 1);
+  apply(&host_gpio1);
+  apply(&host_gpio2);
+}
+
+/* Runs `ticks` timer ticks: TC counts while TCR is 1 and the MR0 match calls
+   the ISR (MCR = 1: interrupt, keep counting)                               */
+static void run (uint64_t ticks) {
+  uint64_t end = now + ticks;
+
+  while (now < end) {
+    uint64_t step = end - now;
+    bool match = false;
+
+    if (host_tim1.TCR == 1 && host_tim1.MR0 - host_tim1.TC <= step) {
+      step = host_tim1.MR0 - host_tim1.TC;
+      match = true;
+    }
+    for (int i = 0; i < NUM_LEDS; i++)
+      if ((host_gpio1.FIOPIN & pin1[i]) || (host_gpio2.FIOPIN & pin2[i]))
+        on_ticks[i] += step;
+    now += step;
+    if (host_tim1.TCR == 1)
+      host_tim1.TC += (uint32_t)step;
+
+    if (match) {
+      isr_calls++;
+      TIMER1_IRQHandler();
+      apply(&host_gpio1);
+      apply(&host_gpio2);
+    }
+  }
+}
+
+int main (void) {
+  uint64_t unit, cycle;
+  int previous = 0;
+
+  initLEDs();
+  apply(&host_gpio1);
+  apply(&host_gpio2);
+  if (host_gpio1.FIOPIN || host_gpio2.FIOPIN)
+    fail("LEDs lit after initLEDs", 0, (long)(host_gpio1.FIOPIN | host_gpio2.FIOPIN), 0);
+
+  /* The plane unit: the first match after a start                          */
+  set_brightness(1);
+  unit = host_tim1.MR0;
+  cycle = 15 * unit;
+  run(2 * cycle);
+
+  for (int n = 0; n < LEVELS; n++) {
+    int b = (n * 37 + 1) % LEVELS;      /* Every level once, shuffled        */
+    int full = b / LED_STEPS, fraction = b % LED_STEPS;
+    int steps = abs(b - previous);
+    uint64_t start = now;
+    long calls;
+
+    /* Fade: one brightness step per cycle, then a whole level stops        */
+    set_brightness((uint32_t)b);
+    if (fraction == 0) {
+      while (host_tim1.TCR == 1 && now - start <= (uint64_t)(steps + 1) * cycle)
+        run(unit);
+      if (host_tim1.TCR != 0)
+        fail("timer still running on a whole level", b, (long)host_tim1.TCR, 0);
+      else if (steps && (now - start > steps * cycle || now - start + cycle < steps * cycle))
+        fail("fade length in cycles", b, (long)((now - start) / cycle), steps);
+    } else {
+      run((uint64_t)(steps + 2) * cycle);
+    }
+
+    /* Settled: measure whole cycles                                        */
+    memset(on_ticks, 0, sizeof(on_ticks));
+    calls = isr_calls;
+    run(MEASURE_CYCLES * cycle);
+    for (int i = 0; i < NUM_LEDS; i++) {
+      uint64_t want = i < full ? MEASURE_CYCLES * cycle : i == full ? MEASURE_CYCLES * fraction * unit : 0;
+
+      if (on_ticks[i] != want)
+        fail(i == full ? "partly lit LED on-time (units)" : "LED on-time (units)", b, (long)(on_ticks[i] / unit),
+             (long)(want / unit));
+    }
+    if (fraction == 0 && isr_calls != calls)
+      fail("interrupts on a whole level", b, isr_calls - calls, 0);
+    previous = b;
+  }
+
+  printf("%d brightness levels, %ld timer interrupts, %u GPIO stores: %s\n", LEVELS, isr_calls, ledRegisterWrites,
+         failures ? "FAILED" : "all duty cycles as expected");
+  return failures ? 1 : 0;
+}
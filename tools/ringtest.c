@@ -0,0 +1,218 @@
+/*----------------------------------------------------------------------------
+* Name:    ringtest.c
+* Purpose: Producer/consumer fuzz test of the lock-free ring (spsc_ring.h)
+* Note(s): Threads push and pop in random bursts, yielding at random, and the
+*          consumer checks what comes out:
+*            - a producer that waits for room (UARTSend): every element, in
+*              order, nothing dropped
+*            - a producer that drops when full (the UART RX ISR): the
+*              elements in order with gaps, and the gaps add up to dropped
+*            - several producers taking one lock around each push (the
+*              UARTPush masked section): each producer's elements in order
+*              and none lost
+*
+*          Build from the repository root:
+*            cc -O2 -std=gnu11 -pthread -Itools/host -Iexample-game \
+*               tools/ringtest.c -o ringtest
+*
+*          Usage: ringtest [elements]    (exit status 1 if any check fails)
+*----------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include <sched.h>
+
+#include "spsc_ring.h"
+
+#define PRODUCERS 4
+
+SPSC_RING_DEFINE(byteRing, uint8_t, 64);        /* The UART rings          */
+SPSC_RING_DEFINE(wordRing, uint32_t, 16);       /* memcpy path, tiny ring  */
+
+static long total;
+static volatile bool producing;
+static pthread_mutex_t pushLock = PTHREAD_MUTEX_INITIALIZER;
+static int failures;
+
+static uint32_t next_random (uint32_t *s) {
+  *s ^= *s << 13;
+  *s ^= *s >> 17;
+  *s ^= *s << 5;
+  return *s;
+}
+
+/* A burst of 1..16 operations, and now and then a yield                    */
+static int burst (uint32_t *s) {
+  uint32_t r = next_random(s);
+
+  if ((r & 0x70) == 0)
+    sched_yield();
+  return 1 + (r & 15);
+}
+
+static void check (bool ok, const char *what, long a, long b) {
+  if (!ok) {
+    printf("  FAIL %s (%ld, %ld)\n", what, a, b);
+    failures++;
+  }
+}
+
+/*----------------------------------------------------------------------------
+  One producer that waits for room
+ *----------------------------------------------------------------------------*/
+static void *wait_producer (void *arg) {
+  uint32_t s = 0x1234567;
+  long i = 0;
+
+  (void)arg;
+  while (i < total) {
+    for (int n = burst(&s); n > 0 && i < total; n--) {
+      uint8_t c = (uint8_t)i;
+
+      while (spsc_count(&byteRing) > byteRing.mask)
+        sched_yield();          /* Wait for room; one core would spin here */
+      spsc_push(&byteRing, &c);
+      i++;
+    }
+  }
+  return NULL;
+}
+
+static void test_waiting (void) {
+  pthread_t producer;
+  uint32_t s = 0x89ABCDE;
+  long got = 0, bad = 0;
+  uint8_t c;
+
+  pthread_create(&producer, NULL, wait_producer, NULL);
+  while (got < total) {
+    for (int n = burst(&s); n > 0 && spsc_pop(&byteRing, &c); n--)
+      if (c != (uint8_t)got++)
+        bad++;
+    if (spsc_count(&byteRing) == 0)
+      sched_yield();
+  }
+  pthread_join(producer, NULL);
+
+  check(bad == 0, "waiting producer: elements out of order", bad, got);
+  check(byteRing.dropped == 0, "waiting producer: elements dropped", byteRing.dropped, 0);
+  check(spsc_count(&byteRing) == 0, "waiting producer: ring not empty", spsc_count(&byteRing), 0);
+}
+
+/*----------------------------------------------------------------------------
+  One producer that drops when the ring is full
+ *----------------------------------------------------------------------------*/
+static long accepted;
+
+static void *drop_producer (void *arg) {
+  uint32_t s = 0x2468ACE;
+  uint32_t i = 0;
+
+  (void)arg;
+  while (i < total) {
+    for (int n = burst(&s); n > 0 && i < total; n--, i++)
+      accepted += spsc_push(&wordRing, &i);
+  }
+  producing = false;
+  return NULL;
+}
+
+static void test_dropping (void) {
+  pthread_t producer;
+  uint32_t s = 0x13579BD, v;
+  long got = 0, gaps = 0, bad = 0;
+  long last = -1;
+
+  producing = true;
+  pthread_create(&producer, NULL, drop_producer, NULL);
+  while (producing || spsc_count(&wordRing)) {
+    for (int n = burst(&s); n > 0 && spsc_pop(&wordRing, &v); n--) {
+      if ((long)v <= last)
+        bad++;
+      else
+        gaps += (long)v - last - 1;
+      last = v;
+      got++;
+    }
+    if (spsc_count(&wordRing) == 0)
+      sched_yield();
+  }
+  pthread_join(producer, NULL);
+  gaps += total - 1 - last;
+
+  check(bad == 0, "dropping producer: elements out of order", bad, got);
+  check(got == accepted, "dropping producer: accepted elements lost", got, accepted);
+  check(gaps == (long)wordRing.dropped, "dropping producer: gaps do not match dropped", gaps, wordRing.dropped);
+  check(accepted + (long)wordRing.dropped == total, "dropping producer: pushes unaccounted for",
+        accepted + wordRing.dropped, total);
+}
+
+/*----------------------------------------------------------------------------
+  Several producers made one by a lock around each push
+ *----------------------------------------------------------------------------*/
+static void *locked_producer (void *arg) {
+  uint32_t id = (uint32_t)(intptr_t)arg;
+  uint32_t s = 0xBEEF + id;
+  long i = 0;
+
+  while (i < total / PRODUCERS) {
+    for (int n = burst(&s); n > 0 && i < total / PRODUCERS; n--) {
+      uint32_t v = id << 24 | (uint32_t)i;
+      bool pushed = false;
+
+      pthread_mutex_lock(&pushLock);
+      if (spsc_count(&wordRing) <= wordRing.mask)    /* Else wait and retry */
+        pushed = spsc_push(&wordRing, &v);
+      pthread_mutex_unlock(&pushLock);
+      if (!pushed)
+        sched_yield();
+      i += pushed;
+    }
+  }
+  return NULL;
+}
+
+static void test_locked (void) {
+  pthread_t producers[PRODUCERS];
+  long next[PRODUCERS] = { 0 };
+  uint32_t s = 0xFACADE, v;
+  long got = 0, bad = 0, want = total / PRODUCERS * PRODUCERS;
+
+  wordRing.dropped = 0;
+  for (int p = 0; p < PRODUCERS; p++)
+    pthread_create(&producers[p], NULL, locked_producer, (void *)(intptr_t)p);
+  while (got < want) {
+    for (int n = burst(&s); n > 0 && spsc_pop(&wordRing, &v); n--, got++) {
+      uint32_t id = v >> 24;
+
+      if (id >= PRODUCERS || (v & 0xFFFFFF) != (uint32_t)(next[id] & 0xFFFFFF))
+        bad++;
+      else
+        next[id]++;
+    }
+    if (spsc_count(&wordRing) == 0)
+      sched_yield();
+  }
+  for (int p = 0; p < PRODUCERS; p++)
+    pthread_join(producers[p], NULL);
+
+  check(bad == 0, "locked producers: elements out of order or corrupt", bad, got);
+  check(wordRing.dropped == 0, "locked producers: elements dropped", wordRing.dropped, 0);
+  check(spsc_count(&wordRing) == 0, "locked producers: ring not empty", spsc_count(&wordRing), 0);
+}
+
+int main (int argc, char **argv) {
+  total = argc > 1 ? atol(argv[1]) : 5000000;
+  if (total < PRODUCERS)
+    total = PRODUCERS;
+
+  test_waiting();
+  test_dropping();
+  test_locked();
+
+  printf("%ld elements, %u dropped by the dropping producer: %s\n", total, (unsigned)(total - accepted),
+         failures ? "FAILED" : "all delivered as expected");
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,144 @@
+/*----------------------------------------------------------------------------
+* Name:    rlebench.c
+* Purpose: Run-length coded screens against raw bitmaps, on the host LCD model
+* Note(s): Draws each of the game's screens (screenData.c) with
+*          drawRleImage, decoded straight into the driver's SPI write loop,
+*          and the same picture as a raw 16 bpp GLCD_Bitmap, which on the
+*          board could not even be held in RAM. Reports the flash each
+*          takes, the SPI bytes and the time per screen on the host (model
+*          included), the time to decode the codes alone, and the time the
+*          board's 12.5 MHz SPI needs for the bytes. Checks that both show
+*          the picture the codes describe, with no pixel off the screen.
+*
+*          Build from the repository root:
+*            cc -O2 -std=gnu11 -DGLCD_MODEL -I. -Itools/host -Itools \
+*               -Iexample-game tools/rlebench.c blit.c screenData.c \
+*               tools/lcdmodel.c example-game/GLCD_SPI_LPC1700.c -o rlebench
+*
+*          Usage: rlebench [repeats]
+*----------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+
+#include "GLCD.h"
+#include "blit.h"
+#include "lcdmodel.h"
+
+#define W COURSE_WIDTH
+#define H COURSE_HEIGHT
+#define SPI_HZ 12500000.0               /* PCLK 50 MHz / CPSR 2 / (SCR + 1)   */
+
+extern const RleImage titleImage, winImage, loseImage;
+
+static uint16_t ref[H][W];
+static uint16_t raw[H * W];             /* GLCD_Bitmap layout: rows bottom up */
+
+static double now_sec (void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/* The picture the codes describe, decoded independently of the driver     */
+static bool decode (const RleImage *image) {
+  const uint8_t *p = image->data, *end = image->data + image->size;
+  int i = 0;
+
+  memset(ref, 0, sizeof(ref));
+  while (p < end) {
+    int code = *p++, n = code & 0x3F;
+    bool literal = code & 0x80;
+
+    if (code & 0x40)
+      n = (n << 8) | *p++;
+    for (int k = 0; k <= n; k++, i++) {
+      uint16_t v = image->colours ? image->palette[p[0]] : (uint16_t)(p[0] << 8 | p[1]);
+
+      if (i >= image->w * image->h)
+        return false;
+      ref[i / image->w][i % image->w] = v;
+      if (literal || k == n)
+        p += image->colours ? 1 : 2;
+    }
+  }
+  return i == image->w * image->h;
+}
+
+static double time_draw (bool rle, const RleImage *image, int repeats, unsigned int *bytes) {
+  unsigned int before = GLCD_SpiBytes;
+  double t = now_sec();
+
+  for (int r = 0; r < repeats; r++) {
+    if (rle)
+      drawRleImage(0, 0, image);
+    else
+      GLCD_Bitmap(0, 0, W, H, (unsigned char *)raw);
+  }
+  *bytes = (GLCD_SpiBytes - before) / repeats;
+  return (now_sec() - t) / repeats;
+}
+
+int main (int argc, char **argv) {
+  static const char *names[] = { "HX8347-D", "ILI9320" };
+  static const struct { const char *name; const RleImage *image; } screens[] = {
+    { "title", &titleImage },
+    { "win",   &winImage   },
+    { "lose",  &loseImage  },
+  };
+  int repeats = argc > 1 ? atoi(argv[1]) : 20;
+  int failures = 0;
+
+  printf("%-9s %-6s %-4s %9s %10s %10s %10s %10s\n", "lcd", "screen", "kind", "flash", "SPI bytes", "host ms",
+         "decode ms", "SPI ms");
+
+  for (int c = LCD_MODEL_HIMAX; c <= LCD_MODEL_ILI; c++) {
+#if defined(GLCD_CONTROLLER) && GLCD_CONTROLLER != 0
+    if (c != GLCD_CONTROLLER - 1)
+      continue;
+#endif
+    lcd_model_reset((LcdModelController)c);
+    GLCD_Init();
+
+    for (size_t s = 0; s < sizeof(screens) / sizeof(screens[0]); s++) {
+      const RleImage *image = screens[s].image;
+      uint32_t flash = image->size + image->colours * 2;
+      unsigned int bytes;
+      double t, decode_t;
+
+      decode_t = now_sec();
+      for (int r = 0; r < repeats; r++)
+        decode(image);
+      decode_t = (now_sec() - decode_t) / repeats;
+      if (image->w != W || image->h != H || !decode(image)) {
+        printf("  FAIL %s is not a whole screen of valid codes\n", screens[s].name);
+        failures++;
+        continue;
+      }
+      for (int y = 0; y < H; y++)
+        memcpy(&raw[(H - 1 - y) * W], ref[y], W * sizeof(uint16_t));
+
+      for (int kind = 0; kind < 2; kind++) {
+        uint64_t offscreen = lcd_model_stats.offscreen;
+
+        GLCD_Clear(Black);
+        t = time_draw(kind == 0, image, repeats, &bytes);
+        printf("%-9s %-6s %-4s %9u %10u %10.3f %10.3f %10.1f\n", names[c], screens[s].name, kind ? "raw" : "rle",
+               kind ? W * H * 2 : flash, bytes, t * 1e3, kind ? 0 : decode_t * 1e3, bytes * 8 / SPI_HZ * 1e3);
+        if (memcmp(ref, lcd_model_fb, sizeof(ref))) {
+          printf("  FAIL %s drawn %s does not show the picture\n", screens[s].name, kind ? "raw" : "rle");
+          failures++;
+        }
+        if (lcd_model_stats.offscreen != offscreen) {
+          printf("  FAIL %s drawn %s wrote off the screen\n", screens[s].name, kind ? "raw" : "rle");
+          failures++;
+        }
+      }
+    }
+  }
+
+  return failures ? 1 : 0;
+}
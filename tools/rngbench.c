@@ -0,0 +1,180 @@
+/*----------------------------------------------------------------------------
+* Name:    rngbench.c
+* Purpose: Host benchmark and statistical sanity checks of rng.c
+* Note(s): Times the generator against rand(), then checks:
+*            - every output bit is set about half of the time,
+*            - rng_below is uniform (chi-square) for the bounds the games
+*              use, and stays unbiased for a bound close to 2^32, where
+*              rand() % n style code is off by a large factor,
+*            - two streams with the same seed are uncorrelated,
+*            - a stream is reproducible from its seed.
+*          These catch broken ports or edits, not subtle statistical
+*          weaknesses; use a proper test suite for those.
+*
+*          Build from the repository root:
+*            cc -O2 -std=gnu11 -Iexample-game tools/rngbench.c \
+*               example-game/rng.c -lm -o rngbench
+*
+*          Usage: rngbench [-n samples] [-s seed]
+*          Exit status is 1 if any check fails.
+*----------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "rng.h"
+
+#define SIGMAS 5.0                      /* failure threshold of every check   */
+
+static int failures = 0;
+
+static double now_sec (void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void report (const char *name, double z) {
+  bool ok = fabs(z) < SIGMAS;
+  printf("  %-40s z = %7.2f  %s\n", name, z, ok ? "ok" : "FAIL");
+  failures += !ok;
+}
+
+/*--------------------------------- Benchmark --------------------------------*/
+
+static void bench (uint32_t seed, long n) {
+  RngStream r;
+  volatile uint32_t sink = 0;
+  double t;
+
+  rng_seed(&r, seed, 0);
+  srand(seed);
+  printf("benchmark (%ld calls each)\n", n);
+
+  t = now_sec();
+  for (long i = 0; i < n; i++) sink += rng_next(&r);
+  printf("  rng_next           %6.2f ns/call\n", (now_sec() - t) * 1e9 / n);
+
+  t = now_sec();
+  for (long i = 0; i < n; i++) sink += rng_below(&r, 311);
+  printf("  rng_below(311)     %6.2f ns/call\n", (now_sec() - t) * 1e9 / n);
+
+  t = now_sec();
+  for (long i = 0; i < n; i++) sink += rand() % 311;
+  printf("  rand() %% 311       %6.2f ns/call\n", (now_sec() - t) * 1e9 / n);
+  (void)sink;
+}
+
+/*----------------------------------- Checks ---------------------------------*/
+
+static void check_bits (uint32_t seed, long n) {
+  RngStream r;
+  long ones[32] = { 0 };
+  double worst = 0;
+
+  rng_seed(&r, seed, 0);
+  for (long i = 0; i < n; i++) {
+    uint32_t v = rng_next(&r);
+    for (int b = 0; b < 32; b++)
+      ones[b] += (v >> b) & 1;
+  }
+  for (int b = 0; b < 32; b++) {
+    double z = (ones[b] - n / 2.0) / sqrt(n / 4.0);
+    if (fabs(z) > fabs(worst)) worst = z;
+  }
+  report("bit frequency (worst of 32 bits)", worst);
+}
+
+static void check_uniform (uint32_t seed, long n, uint32_t bound) {
+  RngStream r;
+  long *count = calloc(bound, sizeof(long));
+  double expected = (double)n / bound, chi2 = 0;
+  char name[64];
+
+  rng_seed(&r, seed, 1);
+  for (long i = 0; i < n; i++)
+    count[rng_below(&r, bound)]++;
+  for (uint32_t k = 0; k < bound; k++)
+    chi2 += (count[k] - expected) * (count[k] - expected) / expected;
+  free(count);
+
+  /* chi-square with bound - 1 degrees of freedom, as a normal deviate       */
+  snprintf(name, sizeof(name), "rng_below(%u) chi-square", bound);
+  report(name, (chi2 - (bound - 1)) / sqrt(2.0 * (bound - 1)));
+}
+
+static void check_large_bound (uint32_t seed, long n) {
+  /* With bound = 3 * 2^30, modulo reduction of 32 bits puts half of the
+     results below 2^30 instead of a third                                   */
+  const uint32_t bound = 0xC0000000UL;
+  RngStream r;
+  long low = 0, lowModulo = 0;
+
+  rng_seed(&r, seed, 2);
+  for (long i = 0; i < n; i++) {
+    low += rng_below(&r, bound) < 0x40000000UL;
+    lowModulo += rng_next(&r) % bound < 0x40000000UL;
+  }
+  report("rng_below(3 * 2^30) low third", (low - n / 3.0) / sqrt(n * (1 / 3.0) * (2 / 3.0)));
+  printf("  %-40s %.3f (should be 0.333)\n", "modulo reduction, same bound", (double)lowModulo / n);
+}
+
+static void check_streams (uint32_t seed, long n) {
+  RngStream a, b;
+  double sa = 0, sb = 0, saa = 0, sbb = 0, sab = 0, corr;
+
+  rng_seed(&a, seed, RNG_STREAM_SPAWN);
+  rng_seed(&b, seed, RNG_STREAM_TELEPORT);
+  for (long i = 0; i < n; i++) {
+    double x = rng_next(&a), y = rng_next(&b);
+    sa += x; sb += y; saa += x * x; sbb += y * y; sab += x * y;
+  }
+  corr = (n * sab - sa * sb) / sqrt((n * saa - sa * sa) * (n * sbb - sb * sb));
+  report("spawn / teleport stream correlation", corr * sqrt((double)n));
+}
+
+static void check_reproducible (uint32_t seed) {
+  RngStream a, b;
+  bool same = true;
+
+  rng_seed(&a, seed, RNG_STREAM_ENEMY);
+  rng_seed(&b, seed, RNG_STREAM_ENEMY);
+  for (int i = 0; i < 1000; i++)
+    same &= rng_next(&a) == rng_next(&b);
+  printf("  %-40s %s\n", "same seed and stream, same sequence", same ? "ok" : "FAIL");
+  failures += !same;
+}
+
+int main (int argc, char **argv) {
+  long n = 10000000;
+  uint32_t seed = 1;
+  int opt;
+
+  while ((opt = getopt(argc, argv, "n:s:")) != -1) {
+    switch (opt) {
+      case 'n': n = atol(optarg); break;
+      case 's': seed = (uint32_t)strtoul(optarg, NULL, 0); break;
+      default:
+        fprintf(stderr, "usage: %s [-n samples] [-s seed]\n", argv[0]);
+        return 2;
+    }
+  }
+
+  bench(seed, n);
+
+  printf("checks (%ld samples each)\n", n);
+  check_bits(seed, n);
+  check_uniform(seed, n, 6);
+  check_uniform(seed, n, 311);           /* spawn x range in the golf game    */
+  check_uniform(seed, n, 231);           /* spawn y range                     */
+  check_large_bound(seed, n);
+  check_streams(seed, n);
+  check_reproducible(seed);
+
+  printf("%s\n", failures ? "FAILED" : "all checks passed");
+  return failures ? 1 : 0;
+}
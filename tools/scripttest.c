@@ -0,0 +1,187 @@
+/*----------------------------------------------------------------------------
+* Name:    scripttest.c
+* Purpose: Host test of the stackless script scheduler (script.c)
+* Note(s): Steps the scheduler by hand, with no kernel, and checks tick by
+*          tick which scripts were resumed and where: next-tick yields,
+*          waits, scripts that end, are stopped, or are started by another
+*          script, slot reuse and a full pool.
+*
+*          Build from the repository root:
+*            cc -O2 -std=gnu11 -I. -Itools/host tools/scripttest.c script.c \
+*               -o scripttest
+*
+*          Usage: scripttest     (exit status 1 if any check fails)
+*----------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "script.h"
+#include <cmsis_os2.h>
+
+/* The kernel calls script.c makes; no frame budget is set here            */
+uint32_t osKernelGetSysTimerCount (void) { return 0; }
+uint32_t osKernelGetSysTimerFreq (void) { return 1000000; }
+osStatus_t osThreadYield (void) { return osOK; }
+osStatus_t osDelay (uint32_t ticks) { (void)ticks; return osOK; }
+
+static char events[4096];               /* "tick:name.step " for every resume */
+static int failures;
+
+static void event (const char *name, int step) {
+  size_t n = strlen(events);
+  snprintf(events + n, sizeof(events) - n, "%u:%s.%d ", currentScriptTick(), name, step);
+}
+
+static void expect (const char *what, const char *want) {
+  if (strcmp(events, want)) {
+    printf("  FAIL %s\n    want %s\n    got  %s\n", what, want, events);
+    failures++;
+  }
+  events[0] = 0;
+}
+
+static void step (int ticks) {
+  while (ticks--)
+    stepScripts();
+}
+
+/* Yields, waits three ticks, yields, ends                                  */
+static bool walker (Script *s) {
+  SCRIPT_BEGIN(s);
+  event(s->ctx, 1);
+  SCRIPT_NEXT_TICK(s);
+  event(s->ctx, 2);
+  SCRIPT_WAIT_TICKS(s, 3);
+  event(s->ctx, 3);
+  SCRIPT_NEXT_TICK(s);
+  event(s->ctx, 4);
+  SCRIPT_END(s);
+}
+
+/* Resumed every tick until stopped                                         */
+static bool forever (Script *s) {
+  static int n[MAX_SCRIPTS];
+  int *count = &n[(int)(intptr_t)s->ctx];
+
+  SCRIPT_BEGIN(s);
+  *count = 0;
+  while (1) {
+    event("f", ++*count);
+    SCRIPT_NEXT_TICK(s);
+  }
+  SCRIPT_END(s);
+}
+
+/* Starts a walker on its second resume                                     */
+static Script *spawned;
+static bool spawner (Script *s) {
+  SCRIPT_BEGIN(s);
+  event("s", 1);
+  SCRIPT_NEXT_TICK(s);
+  event("s", 2);
+  spawned = startScript(walker, "c");
+  SCRIPT_NEXT_TICK(s);
+  event("s", 3);
+  SCRIPT_END(s);
+}
+
+int main (void) {
+  Script *a, *b, *f, *pool[MAX_SCRIPTS];
+  uint32_t t0;
+
+  /* A script is first resumed on the next pass, and every step after a
+     yield on the pass after that; a wait of 3 skips three passes           */
+  t0 = currentScriptTick();
+  a = startScript(walker, "a");
+  step(8);
+  {
+    char want[128];
+    snprintf(want, sizeof(want), "%u:a.1 %u:a.2 %u:a.3 %u:a.4 ", t0 + 1, t0 + 2, t0 + 6, t0 + 7);
+    expect("walker steps", want);
+  }
+  if (scriptRunning(a)) {
+    printf("  FAIL a finished script is still running\n");
+    failures++;
+  }
+
+  /* Two scripts started together run in slot order on every pass          */
+  t0 = currentScriptTick();
+  a = startScript(walker, "a");
+  b = startScript(walker, "b");
+  step(2);
+  {
+    char want[128];
+    snprintf(want, sizeof(want), "%u:a.1 %u:b.1 %u:a.2 %u:b.2 ", t0 + 1, t0 + 1, t0 + 2, t0 + 2);
+    expect("two walkers interleave", want);
+  }
+
+  /* Stopped while waiting: never resumed again, the other one carries on  */
+  stopScript(a);
+  step(6);
+  {
+    char want[128];
+    snprintf(want, sizeof(want), "%u:b.3 %u:b.4 ", t0 + 6, t0 + 7);
+    expect("stopped walker", want);
+  }
+  if (scriptRunning(b)) {
+    printf("  FAIL b is still running after its last step\n");
+    failures++;
+  }
+
+  /* A script started by another one is resumed from the next pass, even if
+     it lands in a slot after the one running                             */
+  t0 = currentScriptTick();
+  startScript(spawner, NULL);
+  step(4);
+  {
+    char want[128];
+    snprintf(want, sizeof(want), "%u:s.1 %u:s.2 %u:s.3 %u:c.1 %u:c.2 ", t0 + 1, t0 + 2, t0 + 3, t0 + 3, t0 + 4);
+    expect("spawned walker", want);
+  }
+  step(5);
+  events[0] = 0;
+  if (scriptRunning(spawned)) {
+    printf("  FAIL the spawned walker did not finish\n");
+    failures++;
+  }
+
+  /* The pool holds MAX_SCRIPTS; a stopped slot is reused, and a restarted
+     script starts over from its beginning                                 */
+  for (int i = 0; i < MAX_SCRIPTS; i++)
+    pool[i] = startScript(forever, (void *)(intptr_t)i);
+  if (startScript(forever, NULL) != NULL) {
+    printf("  FAIL a full pool took another script\n");
+    failures++;
+  }
+  for (int i = 0; i < MAX_SCRIPTS; i++)
+    if (!pool[i]) {
+      printf("  FAIL the pool is smaller than MAX_SCRIPTS\n");
+      failures++;
+    }
+  step(1);
+  events[0] = 0;
+  for (int i = 1; i < MAX_SCRIPTS; i++)
+    stopScript(pool[i]);
+  stopScript(pool[0]);
+  f = startScript(forever, (void *)(intptr_t)0);
+  if (f != pool[0]) {
+    printf("  FAIL the first free slot was not reused\n");
+    failures++;
+  }
+  step(2);
+  {
+    char want[128];
+    t0 = currentScriptTick();
+    snprintf(want, sizeof(want), "%u:f.1 %u:f.2 ", t0 - 1, t0);
+    expect("restarted script", want);
+  }
+  stopScript(f);
+  step(1);
+  expect("nothing running", "");
+
+  printf("%s\n", failures ? "FAILED" : "all script transitions as expected");
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,144 @@
+/*----------------------------------------------------------------------------
+* Name:    scrollbench.c
+* Purpose: Speed of the text console (GLCD_Scroll.c), on the host LCD model
+* Note(s): Prints lines through the console until it has scrolled many
+*          times, then walks the history with the joystick moves. Reports
+*          SPI bytes per printed line, lines per second on the host and
+*          lines per second the board's 12.5 MHz SPI could carry, and
+*          checks that the screen (scroll included) shows the console's
+*          window and nothing else.
+*
+*          Build from the repository root, portrait (hardware scroll):
+*            cc -O2 -std=gnu11 -DGLCD_MODEL -DLANDSCAPE=0 -DLCD_WIDTH=15 \
+*               -DLCD_HEIGTH=13 -Itools/host -Itools -Iexample-game \
+*               tools/scrollbench.c tools/lcdmodel.c \
+*               example-game/GLCD_SPI_LPC1700.c example-game/GLCD_Scroll.c \
+*               -o scrollbench
+*
+*          or without the LANDSCAPE, LCD_WIDTH and LCD_HEIGTH defines for
+*          the game's landscape screen, where lines are redrawn in place.
+*
+*          Usage: scrollbench [lines]
+*----------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+
+#include "GLCD.h"
+#include "GLCD_Scroll.h"
+#include "lcdmodel.h"
+
+#define SPI_HZ       12500000.0         /* PCLK 50 MHz / CPSR 2 / (SCR + 1)   */
+#define LINE_PIXELS  (FONT_SIZE ? 24 : 8)
+
+/* The console's state (GLCD_Scroll.c)                                        */
+extern uint8_t chache[CACHE_LINE_CAP][LCD_WIDTH + 1];
+extern uint32_t window_start, window_size;
+void moveUp (void);
+void moveDown (void);
+void moveFirst (void);
+void moveLast (void);
+
+/* The driver's fonts: pixel i of a row is bit i, rows run top down         */
+extern const unsigned char  Font_6x8_h[];
+extern const unsigned short Font_16x24_h[];
+
+static double now_sec (void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/* What the screen should show at (x, y): the window's lines, in the font,
+   white on black; black under and after them                                */
+static uint16_t expected (int x, int y) {
+  int line = y / LINE_PIXELS, col = x / (FONT_SIZE ? 16 : 6);
+  const uint8_t *s;
+  unsigned int c, pixs;
+
+  if (line >= LCD_HEIGTH || (uint32_t)line > window_size || col >= LCD_WIDTH)
+    return BGC;
+  s = chache[(window_start + line) % CACHE_LINE_CAP];
+  if ((int)strlen((const char *)s) <= col)
+    return BGC;
+  c = s[col] - 32;
+  pixs = FONT_SIZE ? Font_16x24_h[c * 24 + y % 24] : Font_6x8_h[c * 8 + y % 8];
+  return (pixs >> (x % (FONT_SIZE ? 16 : 6))) & 1 ? TXC : BGC;
+}
+
+static int check (const char *name, const char *what) {
+  for (int y = 0; y < lcd_model_height; y++)
+    for (int x = 0; x < lcd_model_width; x++)
+      if (lcd_model_screen(x, y) != expected(x, y)) {
+        printf("  FAIL %s, %s: pixel (%d, %d) is %04x, expected %04x\n", name, what, x, y,
+               lcd_model_screen(x, y), expected(x, y));
+        return 1;
+      }
+  return 0;
+}
+
+int main (int argc, char **argv) {
+  static const char *names[] = { "HX8347-D", "ILI9320" };
+  static const char *words[] = { "tee", "shot", "wall", "bounce", "sand", "hole", "par", "in" };
+  static const struct { const char *name; void (*move) (void); int times; } moves[] = {
+    { "up",    moveUp,    5 },
+    { "down",  moveDown,  2 },
+    { "first", moveFirst, 1 },
+    { "last",  moveLast,  1 },
+  };
+  int lines = argc > 1 ? atoi(argv[1]) : 2000;
+  int failures = 0;
+  char text[64];
+
+  printf("%-9s %-8s %6s %10s %10s %12s %12s\n", "lcd", "action", "times", "SPI bytes", "B/line", "host/s", "SPI/s");
+
+  for (int c = LCD_MODEL_HIMAX; c <= LCD_MODEL_ILI; c++) {
+    unsigned int bytes;
+    double t;
+
+#if defined(GLCD_CONTROLLER) && GLCD_CONTROLLER != 0
+    if (c != GLCD_CONTROLLER - 1)
+      continue;
+#endif
+    lcd_model_reset((LcdModelController)c);
+    init_scroll();
+
+    /* Lines of all lengths: empty, short, exactly a screen wide and longer,
+       which the console wraps                                              */
+    bytes = GLCD_SpiBytes;
+    t = now_sec();
+    for (int n = 0; n < lines; n++) {
+      int len = snprintf(text, sizeof(text), "%d", n);
+
+      for (int k = 0; k < n % 7; k++)
+        len += snprintf(text + len, sizeof(text) - len, " %s", words[(n + k) % 8]);
+      if (n % 11 == 5)
+        len = 0;
+      text[len] = 0;
+      print_string((uint8_t *)text);
+      print_string((uint8_t *)"\n");
+    }
+    t = now_sec() - t;
+    bytes = GLCD_SpiBytes - bytes;
+    printf("%-9s %-8s %6d %10u %10.0f %12.0f %12.1f\n", names[c], "print", lines, bytes, (double)bytes / lines,
+           lines / t, SPI_HZ / 8 / ((double)bytes / lines));
+    failures += check(names[c], "after printing");
+
+    for (size_t m = 0; m < sizeof(moves) / sizeof(moves[0]); m++) {
+      bytes = GLCD_SpiBytes;
+      t = now_sec();
+      for (int k = 0; k < moves[m].times; k++)
+        moves[m].move();
+      t = now_sec() - t;
+      bytes = GLCD_SpiBytes - bytes;
+      printf("%-9s %-8s %6d %10u %10.0f %12.0f %12.1f\n", names[c], moves[m].name, moves[m].times, bytes,
+             (double)bytes / moves[m].times, moves[m].times / t, SPI_HZ / 8 / ((double)bytes / moves[m].times));
+      failures += check(names[c], moves[m].name);
+    }
+  }
+
+  return failures ? 1 : 0;
+}
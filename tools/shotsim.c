@@ -0,0 +1,495 @@
+/*----------------------------------------------------------------------------
+* Name:    shotsim.c
+* Purpose: Headless Monte-Carlo shot simulator for course balancing
+* Note(s): Runs on a Linux host with the same physics code as the game
+*          (physics.c). For every random course (ball and hole spawn) it
+*          sweeps every angle/power combination for hole-in-one odds, then
+*          plays the course greedily to get a stroke distribution.
+*
+*          Every sweep of angle x power is evaluated as one batch with the
+*          SIMD trajectory kernel (trajectory.c). With -c, the course file
+*          from tools/coursec is memory-mapped and played instead of the
+*          open field: spawn, holes, teleporters, walls and water come from
+*          it. The kernel only knows one teleporter and no walls or water,
+*          so other courses are swept one shot at a time (course.c).
+*
+*          Build from the repository root:
+*            cc -O2 -std=gnu11 -march=native -pthread -I. -Iexample-game \
+*               tools/shotsim.c tools/trajectory.c physics.c course.c \
+*               -lm -o shotsim
+*
+*          Usage: shotsim [-n courses] [-j threads] [-s seed] [-c file.crs]
+*----------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "physics.h"
+#include "course.h"
+#include "trajectory.h"
+
+/* Game rules, these must match gameLogic.c                                   */
+#define MIN_POWER       2
+#define MAX_POWER       8
+#define NUM_POWERS      (MAX_POWER - MIN_POWER + 1)
+#define NUM_ANGLES      342             /* pot reading 0..341 (4095 / 12)     */
+#define MAX_GOLF_SCORE  20
+#define BALL_SIZE       5               /* spawn margin                       */
+#define ENV_SIZE        5
+#define BALL_GLCD_WIDTH 3
+#define ENV_GLCD_WIDTH  3
+#define TELEPORTER_X    100
+#define TELEPORTER_Y    150
+
+#define SHOTS_PER_SWEEP (NUM_ANGLES * NUM_POWERS)
+#define SWEEP_LANES     ((SHOTS_PER_SWEEP + TRAJ_LANES - 1) / TRAJ_LANES * TRAJ_LANES)
+
+/*------------------------------- Random numbers -----------------------------*/
+
+/* Each course gets its own generator seeded from (seed, course), so results
+   do not depend on which thread ran which course.                           */
+typedef struct { uint64_t s; } SimRng;
+
+static uint64_t rng_next (SimRng *r) {
+  uint64_t z = (r->s += 0x9E3779B97F4A7C15ULL);
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  return z ^ (z >> 31);
+}
+
+static int rng_range (SimRng *r, int lo, int hi) {
+  return lo + (int)(rng_next(r) % (uint64_t)(hi - lo + 1));
+}
+
+/*------------------------------- Shot model ---------------------------------*/
+
+typedef enum { SHOT_STOPPED, SHOT_HOLED, SHOT_TELEPORTED, SHOT_WATER } ShotResult;
+
+/* Lane state of the one-shot-at-a-time sweep for shots that end in water    */
+#define TRAJ_WATER 4
+
+static Pos teleporterPos = { TELEPORTER_X, TELEPORTER_Y };
+
+/* The course from -c; NULL plays the open field with the single teleporter  */
+static const Course *layout;
+static bool batch_kernel = true;        /* the SIMD kernel can sweep it       */
+
+static Pos random_spot (SimRng *r, int margin) {
+  Pos p;
+  p.x = rng_range(r, margin, COURSE_WIDTH  - margin);
+  p.y = rng_range(r, margin, COURSE_HEIGHT - margin);
+  return p;
+}
+
+static bool on_teleporter (Pos ball) {
+  if (layout)
+    return courseTeleporterAt(layout, ball, BALL_GLCD_WIDTH, ENV_GLCD_WIDTH) >= 0;
+  return spritesOverlap(ball, BALL_GLCD_WIDTH, teleporterPos, ENV_GLCD_WIDTH);
+}
+
+/* Where a ball on a teleporter comes out, like teleportScript; `r` is only
+   used for random exits                                                     */
+static Pos teleport (Pos ball, SimRng *r) {
+  if (layout) {
+    const CourseTeleporter *t = &layout->teleporters[courseTeleporterAt(layout, ball, BALL_GLCD_WIDTH, ENV_GLCD_WIDTH)];
+    Pos exit = { t->exit.x, t->exit.y };
+
+    if (exit.x != COURSE_RANDOM)
+      return exit;
+    do {
+      exit = random_spot(r, ENV_SIZE);
+    } while (courseSolidAt(layout, exit));
+    return exit;
+  }
+  return random_spot(r, ENV_SIZE);
+}
+
+/* One shot up to the first event, checked in the same order as the game
+   scripts run each tick: physics step, water, teleporter, then hole. The
+   ball is left where the event happened.                                    */
+static ShotResult run_shot (Pos *ball, Pos hole, int angle, int power, uint64_t *steps) {
+  int vx, vy;
+
+  launchVelocity(angle, power, &vx, &vy);
+  while (!ballStopped(vx, vy)) {
+    stepCourse(layout, ball, &vx, &vy);
+    (*steps)++;
+
+    if (layout && courseHazardAt(layout, *ball))
+      return SHOT_WATER;
+    if (on_teleporter(*ball))
+      return SHOT_TELEPORTED;
+    if (spritesOverlap(*ball, BALL_GLCD_WIDTH, hole, ENV_GLCD_WIDTH))
+      return SHOT_HOLED;
+  }
+  return SHOT_STOPPED;
+}
+
+/* One stroke of the game: water puts the ball back where it was played
+   from (the caller counts the penalty), teleporters move it               */
+static ShotResult play_shot (Pos *ball, Pos hole, int angle, int power, SimRng *r, uint64_t *steps) {
+  Pos start = *ball;
+  ShotResult result = run_shot(ball, hole, angle, power, steps);
+
+  if (result == SHOT_WATER)
+    *ball = start;
+  else if (result == SHOT_TELEPORTED)
+    *ball = teleport(*ball, r);
+  return result;
+}
+
+static long dist2 (Pos a, Pos b) {
+  long dx = a.x - b.x, dy = a.y - b.y;
+  return dx * dx + dy * dy;
+}
+
+/*------------------------------- Statistics ---------------------------------*/
+
+typedef struct {
+  uint64_t shots;
+  uint64_t steps;
+  uint64_t holed;                       /* hole-in-ones in the sweeps         */
+  uint64_t holedByPower[NUM_POWERS];
+  uint64_t strokes[MAX_GOLF_SCORE + 2]; /* [MAX_GOLF_SCORE + 1] = lost        */
+} SimStats;
+
+/* Launches every angle/power pair from `ball` as one batch and runs it to
+   completion. Lane = (power - MIN_POWER) * NUM_ANGLES + angle.               */
+static void sweep (TrajBatch *tb, Pos ball, Pos hole, SimStats *st) {
+  size_t lane;
+
+  if (!batch_kernel) {
+    static const int32_t lane_state[] = { TRAJ_STOPPED, TRAJ_HOLED, TRAJ_TELEPORTED, TRAJ_WATER };
+
+    for (lane = 0; lane < SHOTS_PER_SWEEP; lane++) {
+      Pos end = ball;
+      tb->state[lane] = lane_state[run_shot(&end, hole, lane % NUM_ANGLES, MIN_POWER + lane / NUM_ANGLES, &st->steps)];
+      tb->x[lane] = end.x;
+      tb->y[lane] = end.y;
+    }
+    st->shots += SHOTS_PER_SWEEP;
+    return;
+  }
+
+  tb->hole = hole;
+  for (lane = 0; lane < SWEEP_LANES; lane++) {
+    if (lane < SHOTS_PER_SWEEP) {
+      traj_launch(tb, lane, ball, lane % NUM_ANGLES, MIN_POWER + lane / NUM_ANGLES);
+    } else {
+      tb->state[lane] = TRAJ_STOPPED;   /* padding                            */
+    }
+  }
+  st->steps += traj_run(tb);
+  st->shots += SHOTS_PER_SWEEP;
+}
+
+static void run_course (uint64_t seed, uint32_t course, TrajBatch *tb, SimStats *st) {
+  SimRng r = { seed ^ ((uint64_t)course * 0xD1B54A32D192ED03ULL) };
+  Pos ball, hole;
+  int stroke;
+  size_t lane;
+
+  if (layout) {
+    /* Spawn like setupGame: one of the holes, the course spawn or a random
+       spot clear of everything                                              */
+    CoursePoint h = layout->holes[rng_range(&r, 0, layout->header->holeCount - 1)];
+    hole = (Pos){ h.x, h.y };
+    if (layout->header->spawn.x != COURSE_RANDOM) {
+      ball = (Pos){ layout->header->spawn.x, layout->header->spawn.y };
+    } else {
+      do {
+        ball = random_spot(&r, BALL_SIZE);
+      } while (courseSolidAt(layout, ball) || courseTriggerAt(layout, ball));
+    }
+  } else {
+    /* Spawn like the open field: the ball off the teleporter, the hole off both */
+    do {
+      ball = random_spot(&r, BALL_SIZE);
+    } while (spritesOverlap(ball, BALL_GLCD_WIDTH, teleporterPos, ENV_GLCD_WIDTH));
+    do {
+      hole = random_spot(&r, ENV_SIZE);
+    } while (spritesOverlap(hole, ENV_GLCD_WIDTH, ball, BALL_GLCD_WIDTH) ||
+             spritesOverlap(hole, ENV_GLCD_WIDTH, teleporterPos, ENV_GLCD_WIDTH));
+  }
+
+  /* Full sweep from the spawn point for hole-in-one odds                    */
+  sweep(tb, ball, hole, st);
+  for (lane = 0; lane < SHOTS_PER_SWEEP; lane++) {
+    if (tb->state[lane] == TRAJ_HOLED) {
+      st->holed++;
+      st->holedByPower[lane / NUM_ANGLES]++;
+    }
+  }
+
+  /* Greedy play: each stroke takes the first shot that holes, otherwise the
+     one that ends closest to the hole; shots into water are never taken     */
+  for (stroke = 1; stroke <= MAX_GOLF_SCORE; stroke++) {
+    size_t bestLane = 0;
+    long best = -1;
+    ShotResult result;
+
+    sweep(tb, ball, hole, st);
+    for (lane = 0; lane < SHOTS_PER_SWEEP; lane++) {
+      Pos end = { tb->x[lane], tb->y[lane] };
+      long d;
+
+      if (tb->state[lane] == TRAJ_HOLED) {
+        bestLane = lane;
+        break;
+      }
+      if (tb->state[lane] == TRAJ_WATER)
+        continue;
+      if (tb->state[lane] == TRAJ_TELEPORTED) {
+        SimRng tr = r;                  /* where a teleport would land        */
+        end = teleport(end, &tr);
+      }
+      d = dist2(end, hole);
+      if (best < 0 || d < best) {
+        best = d;
+        bestLane = lane;
+      }
+    }
+
+    result = play_shot(&ball, hole, bestLane % NUM_ANGLES, MIN_POWER + bestLane / NUM_ANGLES, &r, &st->steps);
+    if (result == SHOT_HOLED)
+      break;
+    if (result == SHOT_WATER)
+      stroke++;                         /* penalty stroke                     */
+  }
+  st->strokes[stroke > MAX_GOLF_SCORE ? MAX_GOLF_SCORE + 1 : stroke]++;
+}
+
+/*---------------------------- Work-stealing pool ----------------------------*/
+
+/* Every worker owns a range of course indices packed as begin:end in one
+   64-bit word. The owner takes from the front, idle workers steal the back
+   half of a victim's range. A single CAS covers both ends, so no locks.     */
+typedef struct {
+  _Atomic uint64_t range;
+  char pad[64 - sizeof(uint64_t)];      /* one queue per cache line           */
+} WorkQueue;
+
+typedef struct {
+  int id;
+  int nworkers;
+  WorkQueue *queues;
+  uint64_t seed;
+  TrajBatch batch;                      /* per-worker sweep lanes             */
+  SimStats stats;
+  uint64_t stolen;
+} Worker;
+
+static uint64_t pack (uint32_t begin, uint32_t end) { return ((uint64_t)begin << 32) | end; }
+
+static bool take_own (WorkQueue *q, uint32_t *item) {
+  uint64_t r = atomic_load(&q->range);
+
+  for (;;) {
+    uint32_t begin = (uint32_t)(r >> 32), end = (uint32_t)r;
+    if (begin >= end)
+      return false;
+    if (atomic_compare_exchange_weak(&q->range, &r, pack(begin + 1, end))) {
+      *item = begin;
+      return true;
+    }
+  }
+}
+
+static bool steal (WorkQueue *victim, WorkQueue *self) {
+  uint64_t r = atomic_load(&victim->range);
+
+  for (;;) {
+    uint32_t begin = (uint32_t)(r >> 32), end = (uint32_t)r;
+    uint32_t take;
+    if (begin >= end)
+      return false;
+    take = (end - begin + 1) / 2;
+    if (atomic_compare_exchange_weak(&victim->range, &r, pack(begin, end - take))) {
+      /* Our own queue is empty, so nobody else writes it right now          */
+      atomic_store(&self->range, pack(end - take, end));
+      return true;
+    }
+  }
+}
+
+static void *worker_main (void *arg) {
+  Worker *w = arg;
+  WorkQueue *own = &w->queues[w->id];
+  uint32_t course;
+
+  for (;;) {
+    if (take_own(own, &course)) {
+      run_course(w->seed, course, &w->batch, &w->stats);
+      continue;
+    }
+
+    bool found = false;
+    for (int k = 1; k < w->nworkers && !found; k++) {
+      found = steal(&w->queues[(w->id + k) % w->nworkers], own);
+    }
+    if (!found)
+      break;                            /* no work is created later, so done */
+    w->stolen++;
+  }
+  return NULL;
+}
+
+/*---------------------------------- Main ------------------------------------*/
+
+static void batch_init (TrajBatch *b) {
+  memset(b, 0, sizeof(*b));
+  b->n = SWEEP_LANES;
+  b->x  = aligned_alloc(32, SWEEP_LANES * sizeof(int32_t));
+  b->y  = aligned_alloc(32, SWEEP_LANES * sizeof(int32_t));
+  b->vx = aligned_alloc(32, SWEEP_LANES * sizeof(int32_t));
+  b->vy = aligned_alloc(32, SWEEP_LANES * sizeof(int32_t));
+  b->state = aligned_alloc(32, SWEEP_LANES * sizeof(int32_t));
+  b->teleporter = teleporterPos;
+  b->ballSize = BALL_GLCD_WIDTH;
+  b->holeSize = b->teleporterSize = ENV_GLCD_WIDTH;
+}
+
+static void batch_free (TrajBatch *b) {
+  free(b->x); free(b->y); free(b->vx); free(b->vy); free(b->state);
+}
+
+/* Maps a course file read-only; the grids are used straight from the file  */
+static bool map_course (const char *path, Course *out) {
+  struct stat st;
+  int fd = open(path, O_RDONLY);
+  void *data;
+
+  if (fd < 0 || fstat(fd, &st) < 0) {
+    perror(path);
+    return false;
+  }
+  data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (data == MAP_FAILED) {
+    perror(path);
+    return false;
+  }
+  if (!parseCourse(data, (uint32_t)st.st_size, out)) {
+    fprintf(stderr, "%s: not a course file\n", path);
+    return false;
+  }
+  return true;
+}
+
+static double now_sec (void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+int main (int argc, char **argv) {
+  uint32_t courses = 1000;
+  int nworkers = (int)sysconf(_SC_NPROCESSORS_ONLN);
+  uint64_t seed = 1;
+  static Course mapped;
+  const char *course_file = NULL;
+  int opt;
+
+  while ((opt = getopt(argc, argv, "n:j:s:c:")) != -1) {
+    switch (opt) {
+      case 'n': courses = (uint32_t)strtoul(optarg, NULL, 0); break;
+      case 'j': nworkers = atoi(optarg); break;
+      case 's': seed = strtoull(optarg, NULL, 0); break;
+      case 'c': course_file = optarg; break;
+      default:
+        fprintf(stderr, "usage: %s [-n courses] [-j threads] [-s seed] [-c file.crs]\n", argv[0]);
+        return 2;
+    }
+  }
+  if (nworkers < 1)
+    nworkers = 1;
+
+  if (course_file) {
+    if (!map_course(course_file, &mapped))
+      return 1;
+    layout = &mapped;
+
+    /* The kernel handles an open, all-fairway course with at most one random
+       teleporter                                                            */
+    const CourseHeader *h = layout->header;
+    batch_kernel = h->wallCount == 0 && h->hazardCount == 0 && h->teleporterCount <= 1 &&
+                   (h->teleporterCount == 0 || layout->teleporters[0].exit.x == COURSE_RANDOM) &&
+                   (h->terrains & ~(1 << TERRAIN_FAIRWAY)) == 0;
+    if (h->teleporterCount > 0)
+      teleporterPos = (Pos){ layout->teleporters[0].entry.x, layout->teleporters[0].entry.y };
+    else
+      teleporterPos = (Pos){ -COURSE_WIDTH, -COURSE_HEIGHT };
+  }
+
+  WorkQueue *queues = aligned_alloc(64, sizeof(WorkQueue) * nworkers);
+  Worker *workers = calloc(nworkers, sizeof(Worker));
+  pthread_t *threads = calloc(nworkers, sizeof(pthread_t));
+
+  for (int i = 0; i < nworkers; i++) {
+    uint32_t begin = (uint32_t)((uint64_t)courses * i / nworkers);
+    uint32_t end   = (uint32_t)((uint64_t)courses * (i + 1) / nworkers);
+    atomic_init(&queues[i].range, pack(begin, end));
+    workers[i].id = i;
+    workers[i].nworkers = nworkers;
+    workers[i].queues = queues;
+    workers[i].seed = seed;
+    batch_init(&workers[i].batch);
+  }
+
+  double t0 = now_sec();
+  for (int i = 0; i < nworkers; i++)
+    pthread_create(&threads[i], NULL, worker_main, &workers[i]);
+
+  SimStats total;
+  uint64_t stolen = 0;
+  memset(&total, 0, sizeof(total));
+  for (int i = 0; i < nworkers; i++) {
+    pthread_join(threads[i], NULL);
+    total.shots += workers[i].stats.shots;
+    total.steps += workers[i].stats.steps;
+    total.holed += workers[i].stats.holed;
+    for (int p = 0; p < NUM_POWERS; p++)
+      total.holedByPower[p] += workers[i].stats.holedByPower[p];
+    for (int s = 0; s <= MAX_GOLF_SCORE + 1; s++)
+      total.strokes[s] += workers[i].stats.strokes[s];
+    stolen += workers[i].stolen;
+  }
+  double elapsed = now_sec() - t0;
+
+  for (int i = 0; i < nworkers; i++)
+    batch_free(&workers[i].batch);
+
+  printf("courses %u, threads %d, seed %llu, %s kernel, %s\n", courses, nworkers,
+         (unsigned long long)seed, batch_kernel ? traj_kernel_name() : "per-shot",
+         course_file ? course_file : "open field");
+  printf("hole-in-one probability: %.5f (%llu of %llu sweep shots)\n",
+         (double)total.holed / ((double)courses * SHOTS_PER_SWEEP),
+         (unsigned long long)total.holed, (unsigned long long)courses * SHOTS_PER_SWEEP);
+  for (int p = 0; p < NUM_POWERS; p++)
+    printf("  power %d: %.5f\n", p + MIN_POWER,
+           (double)total.holedByPower[p] / ((double)courses * NUM_ANGLES));
+
+  printf("strokes to hole (greedy play):\n");
+  for (int s = 1; s <= MAX_GOLF_SCORE; s++)
+    if (total.strokes[s])
+      printf("  %2d: %.4f\n", s, (double)total.strokes[s] / courses);
+  printf("  lost: %.4f\n", (double)total.strokes[MAX_GOLF_SCORE + 1] / courses);
+
+  printf("%llu shots, %llu steps in %.3f s: %.0f shots/s (%llu steals)\n",
+         (unsigned long long)total.shots, (unsigned long long)total.steps, elapsed,
+         total.shots / elapsed, (unsigned long long)stolen);
+
+  free(threads);
+  free(workers);
+  free(queues);
+  return 0;
+}
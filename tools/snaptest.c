@@ -0,0 +1,115 @@
+/*----------------------------------------------------------------------------
+* Name:    snaptest.c
+* Purpose: Stress test of the lock-free game state snapshot (snapshot.c)
+* Note(s): One writer thread keeps changing the ball, hole and teleporter
+*          and publishes each state, like the game does under ballMutex;
+*          reader threads call readSnapshot as fast as they can. Every
+*          field of a state is derived from one counter, so a snapshot
+*          mixing two states (a torn read) is caught, and so is one going
+*          back in time.
+*
+*          Build from the repository root:
+*            cc -O2 -std=gnu11 -pthread -I. -Itools/host -Iexample-game \
+*               tools/snaptest.c snapshot.c -o snaptest
+*
+*          Usage: snaptest [publishes] [readers]
+*----------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <pthread.h>
+
+#include "snapshot.h"
+
+#define MAX_READERS 8
+
+/* The state publishSnapshot copies from                                    */
+Ball *golfBall;
+Environment *hole;
+Environment *teleporter;
+
+static volatile bool done;
+static long publishes;
+
+typedef struct {
+  pthread_t thread;
+  long reads, torn, backwards;
+} Reader;
+
+/* State n: every field a different function of n                           */
+static void set_state (uint32_t n) {
+  golfBall->pos.x = (int)n;
+  golfBall->pos.y = (int)(n * 3);
+  golfBall->xVelocity = -(int)n;
+  golfBall->yVelocity = (int)(n ^ 0x5A5A5A5A);
+  golfBall->direction = n * 0.5;
+  golfBall->power = n * 7;
+  hole->pos.x = (int)(n + 1);
+  hole->pos.y = (int)(n + 2);
+  teleporter->pos.x = (int)(n * 5);
+  teleporter->pos.y = (int)~n;
+}
+
+static bool consistent (const GameSnapshot *s) {
+  uint32_t n = (uint32_t)s->ball.x;
+
+  return s->ball.y == (int)(n * 3) && s->xVelocity == -(int)n && s->yVelocity == (int)(n ^ 0x5A5A5A5A) &&
+         s->direction == n * 0.5 && s->power == n * 7 && s->hole.x == (int)(n + 1) && s->hole.y == (int)(n + 2) &&
+         s->teleporter.x == (int)(n * 5) && s->teleporter.y == (int)~n;
+}
+
+static void *reader (void *arg) {
+  Reader *r = arg;
+  GameSnapshot snap;
+  uint32_t last = 0;
+
+  while (!done) {
+    readSnapshot(&snap);
+    r->reads++;
+    if (!consistent(&snap))
+      r->torn++;
+    else if ((uint32_t)snap.ball.x < last)
+      r->backwards++;
+    else
+      last = (uint32_t)snap.ball.x;
+  }
+  return NULL;
+}
+
+int main (int argc, char **argv) {
+  static Ball ball;
+  static Environment env[2];
+  static Reader readers[MAX_READERS];
+  long total = argc > 1 ? atol(argv[1]) : 20000000;
+  int count = argc > 2 ? atoi(argv[2]) : 3;
+  long reads = 0, torn = 0, backwards = 0;
+
+  if (count < 1 || count > MAX_READERS)
+    count = 3;
+  golfBall = &ball;
+  hole = &env[0];
+  teleporter = &env[1];
+  set_state(0);
+  publishSnapshot();
+
+  for (int i = 0; i < count; i++)
+    pthread_create(&readers[i].thread, NULL, reader, &readers[i]);
+
+  /* The writer: this thread                                                */
+  for (publishes = 1; publishes <= total; publishes++) {
+    set_state((uint32_t)publishes);
+    publishSnapshot();
+  }
+  done = true;
+
+  for (int i = 0; i < count; i++) {
+    pthread_join(readers[i].thread, NULL);
+    reads += readers[i].reads;
+    torn += readers[i].torn;
+    backwards += readers[i].backwards;
+  }
+
+  printf("%ld publishes, %d readers, %ld reads: %ld torn, %ld backwards\n", total, count, reads, torn, backwards);
+  return (torn || backwards || reads == 0) ? 1 : 0;
+}
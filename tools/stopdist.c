@@ -0,0 +1,131 @@
+/*----------------------------------------------------------------------------
+* Name:    stopdist.c
+* Purpose: Host check of the terrain friction model (physics.c, course.c)
+* Note(s): Rolls balls on each terrain and compares how far they get with
+*          the distance the friction coefficient predicts: friction takes
+*          the fraction c off the speed every step, so a ball launched at
+*          v0 pixels per step rolls (v0 - v_stop) / c pixels, v_stop being
+*          the speed it stops at. Also checks that friction acts along the
+*          velocity vector: a diagonal shot must roll as far as a straight
+*          one at the same speed and keep its direction, and stepCourse()
+*          must pick the friction up from the terrain grid.
+*
+*          Build from the repository root:
+*            cc -O2 -std=gnu11 -I. -Iexample-game tools/stopdist.c \
+*               course.c physics.c -lm -o stopdist
+*
+*          Usage: stopdist     (exit status 1 if any check fails)
+*----------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <math.h>
+
+#include "course.h"
+
+#define START_X 160
+#define START_Y 120
+#define MAX_ROLL 110                    /* stays clear of the course edges   */
+
+static const char *terrain_names[] = { "fairway", "sand", "ice", "water" };
+static int failures;
+
+static void expect (bool ok, const char *what, double got, double want) {
+  if (!ok) {
+    printf("  FAIL %s: got %.1f, expected %.1f\n", what, got, want);
+    failures++;
+  }
+}
+
+/* Rolls a ball from the start at speed v0 (pixels per step) in direction
+   `deg`; returns the straight-line distance to where it stopped           */
+static double roll (const Course *course, uint32_t friction, double v0, double deg, double *dir, int *steps) {
+  Pos pos = { START_X, START_Y };
+  int vx = (int)lround(v0 * cos(deg * M_PI / 180) * VELOCITY_ONE);
+  int vy = (int)lround(v0 * sin(deg * M_PI / 180) * VELOCITY_ONE);
+
+  *steps = 0;
+  while (!ballStopped(vx, vy)) {
+    if (course)
+      stepCourse(course, &pos, &vx, &vy);
+    else
+      stepPhysicsFriction(&pos, &vx, &vy, friction);
+    (*steps)++;
+  }
+  *dir = atan2(pos.y - START_Y, pos.x - START_X) * 180 / M_PI;
+  return hypot(pos.x - START_X, pos.y - START_Y);
+}
+
+int main (void) {
+  static uint8_t image[8192] __attribute__((aligned(4)));
+  static uint8_t terrain[COURSE_TERRAIN_BYTES];
+  char what[64];
+
+  printf("%-8s %5s %6s %9s %9s %6s\n", "terrain", "v0", "steps", "distance", "predicted", "error");
+
+  for (int t = 0; t < 4; t++) {
+    double c = (double)TERRAIN_FRICTION[t] / FRICTION_ONE;
+
+    for (int power = SHOT_MIN_POWER; power <= SHOT_MAX_POWER; power++) {
+      double v0 = 2.0 * power, dir, diag_dir;
+      /* The ball stops once its speed falls under STOP_SPEED, on average
+         halfway through the last step's loss                              */
+      double v_stop = (double)STOP_SPEED / VELOCITY_ONE * (1 - c / 2);
+      double predicted = (v0 - v_stop) / c;
+      int steps, diag_steps;
+      double d, diag;
+
+      if (predicted > MAX_ROLL)
+        continue;
+
+      d = roll(NULL, TERRAIN_FRICTION[t], v0, 0, &dir, &steps);
+      printf("%-8s %5.0f %6d %9.1f %9.1f %5.1f%%\n", terrain_names[t], v0, steps, d, predicted,
+             100 * (d - predicted) / predicted);
+
+      /* Each step moves a whole number of pixels, which matters most for
+         slow balls on ice: allow 10 % and two pixels                      */
+      snprintf(what, sizeof(what), "%s v0 %.0f distance", terrain_names[t], v0);
+      expect(fabs(d - predicted) <= 0.1 * predicted + 2, what, d, predicted);
+
+      /* Along the vector: 30 degrees rolls as far, the same way; off the
+         line by no more than the same whole-pixel rounding               */
+      diag = roll(NULL, TERRAIN_FRICTION[t], v0, 30, &diag_dir, &diag_steps);
+      snprintf(what, sizeof(what), "%s v0 %.0f at 30 degrees distance", terrain_names[t], v0);
+      expect(fabs(diag - d) <= 0.1 * d + 2, what, diag, d);
+      snprintf(what, sizeof(what), "%s v0 %.0f at 30 degrees, pixels off line", terrain_names[t], v0);
+      expect(fabs(diag * sin((diag_dir - 30) * M_PI / 180)) <= 0.05 * diag + 1, what,
+             diag * sin((diag_dir - 30) * M_PI / 180), 0);
+    }
+  }
+
+  /* stepCourse() reads the terrain: a course that is all sand must roll
+     exactly like stepPhysicsFriction() with the sand coefficient          */
+  {
+    CourseHeader header = { 0 };
+    CoursePoint hole = { 0, 0 };
+    CourseRect all = { 0, 0, COURSE_TERRAIN_COLS << COURSE_TERRAIN_SHIFT, COURSE_TERRAIN_ROWS << COURSE_TERRAIN_SHIFT };
+    Course course;
+    uint32_t size;
+    double dir, a, b;
+    int steps;
+
+    header.holeCount = 1;
+    header.spawn.x = header.spawn.y = COURSE_RANDOM;
+    paintTerrain(terrain, &all, TERRAIN_SAND, false);
+    size = assembleCourse(&header, NULL, NULL, NULL, &hole, terrain, image, sizeof(image));
+    if (size == 0 || !parseCourse(image, size, &course)) {
+      printf("  FAIL sand course does not assemble\n");
+      return 1;
+    }
+
+    a = roll(&course, 0, 12, 45, &dir, &steps);
+    b = roll(NULL, TERRAIN_FRICTION[TERRAIN_SAND], 12, 45, &dir, &steps);
+    expect(a == b, "stepCourse on sand", a, b);
+    expect(course.header->terrains == (1 << TERRAIN_SAND), "terrains of the sand course",
+           course.header->terrains, 1 << TERRAIN_SAND);
+  }
+
+  printf("%s\n", failures ? "FAILED" : "all stopping distances match");
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,351 @@
+/*----------------------------------------------------------------------------
+* Name:    tracetool.c
+* Purpose: Dump and replay game traces recorded on the board (trace.c)
+* Note(s): Replays the script ticks of the game on the host with the same
+*          physics and course code (physics.c, course.c, and the courses
+*          built into the game from courseData.c), as fast as the host
+*          allows, and checks every checkpoint of the trace (course, spawn,
+*          teleports, water, final score).
+*          The hole, a random spawn and random teleport exits are drawn
+*          from the trace's seed with the game's own streams (rng.c,
+*          seeded like seedGame), and checked against the trace like the
+*          rest, so a replay also catches a change to how they are drawn.
+*
+*          Record on the board with -DTRACE_RECORD and capture the trace
+*          port, e.g. stty -F /dev/ttyUSB1 115200 raw; cat /dev/ttyUSB1
+*          Replay on the board with -DTRACE_REPLAY(_FAST) by sending the
+*          file back to the same port.
+*
+*          Build from the repository root:
+*            cc -O2 -std=gnu11 -I. -Iexample-game \
+*               tools/tracetool.c tracefmt.c physics.c course.c \
+*               courseData.c example-game/rng.c -lm -o tracetool
+*
+*          Usage: tracetool [-d] [-c] trace...   (-d: print every record,
+*                 -c: also replay with each checkpoint dropped or
+*                 doubled in turn)
+*          Exit status is 1 if any trace does not replay to its result.
+*----------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdarg.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "physics.h"
+#include "tracefmt.h"
+#include "course.h"
+#include "rng.h"
+
+/* Game rules, these must match gameLogic.c                                   */
+#define MAX_GOLF_SCORE  20
+#define BALL_SIZE       5               /* margins of random spots            */
+#define ENV_SIZE        5
+#define BALL_GLCD_WIDTH 3
+#define ENV_GLCD_WIDTH  3
+#define HIT_QUEUE       8               /* capacity of inputEvents            */
+#define TICK_MS         1               /* SCRIPT_TICK at the 1 kHz RTX tick  */
+
+static const char *type_names[] = { "hit", "power", "angle", "ball", "hole", "teleporter", "end", "course" };
+#define NUM_TYPES (int)(sizeof(type_names) / sizeof(type_names[0]))
+
+typedef struct {
+  TraceReader in;
+  int desyncs;
+} Reader;
+
+static bool quiet;                      /* -c: no replay output per variant */
+
+static void say (const char *format, ...) {
+  va_list args;
+
+  if (quiet)
+    return;
+  va_start(args, format);
+  vprintf(format, args);
+  va_end(args);
+}
+
+/* Same resync as trace.c: records of past ticks are skipped as desyncs      */
+static void skip (Reader *r, uint32_t tick) {
+  uint32_t skipped = traceReaderSkip(&r->in, tick);
+
+  if (skipped > 0) {
+    r->desyncs += skipped;
+    say("  desync at tick %u: %u records skipped\n", tick, skipped);
+  }
+}
+
+/* Same rule as traceCheck: the next record must be this checkpoint           */
+static bool check (Reader *r, uint32_t tick, uint8_t type, int32_t value, int32_t *recorded) {
+  TraceRecord rec;
+  bool match;
+
+  skip(r, tick);
+  match = traceReaderCheck(&r->in, tick, type, &rec);
+  if (match && recorded)
+    *recorded = rec.value;
+  if (!match || (!recorded && rec.value != value)) {
+    r->desyncs++;
+    say("  desync at tick %u: expected %s\n", tick, type < NUM_TYPES ? type_names[type] : "?");
+  }
+  return match;
+}
+
+static void dump (const uint8_t *data, int length) {
+  TraceRecord rec = { 0 };
+  int pos = TRACE_HEADER_SIZE, used;
+
+  while ((used = traceDecode(&data[pos], length - pos, rec.tick, &rec)) > 0) {
+    pos += used;
+    printf("  %8u %-10s ", rec.tick, rec.type < NUM_TYPES ? type_names[rec.type] : "?");
+    if (rec.type >= TRACE_BALL_POS && rec.type <= TRACE_TELEPORTER_POS)
+      printf("(%d, %d)\n", TRACE_POS_X(rec.value), TRACE_POS_Y(rec.value));
+    else if (rec.type == TRACE_END)
+      printf("score %d %s\n", rec.value >> 1, (rec.value & 1) ? "won" : "lost");
+    else
+      printf("%d\n", rec.value);
+  }
+}
+
+/* A spot off the walls with `margin` to the edges, drawn like gameLogic.c   */
+static Pos random_spot (RngStream *rng, const Course *course, int margin, bool triggers) {
+  Pos p;
+
+  do {
+    p.x = rng_range(rng, margin, COURSE_WIDTH - margin);
+    p.y = rng_range(rng, margin, COURSE_HEIGHT - margin);
+  } while (courseSolidAt(course, p) || (triggers && courseTriggerAt(course, p)));
+  return p;
+}
+
+/* Plays setupGame and then the script passes of gameLogic.c in slot order:
+   inputScript, ballScript, teleportScript, endGameScript. Returns the ticks
+   played.                                                                    */
+static uint32_t replay (Reader *r, uint32_t seed) {
+  Pos ball, hole, shot_start = { 0, 0 };
+  RngStream spawn_rng, teleport_rng;
+  CoursePoint spot;
+  Course course;
+  TraceRecord input;
+  int32_t value;
+  int vx = 0, vy = 0, score = 0, hits = 0;
+  uint32_t power = SHOT_MIN_POWER, tick;
+  int32_t direction = 0;
+  bool flying = false;
+
+  if (!check(r, 0, TRACE_COURSE, 0, &value) || value < 0 || (uint32_t)value >= NUM_COURSES ||
+      !parseCourse(COURSE_DATA[value], COURSE_SIZES[value], &course)) {
+    say("  unknown course\n");
+    r->desyncs++;
+    return 0;
+  }
+
+  /* seedGame and setupGame: the hole, then the spawn                       */
+  rng_seed(&spawn_rng, seed, RNG_STREAM_SPAWN);
+  rng_seed(&teleport_rng, seed, RNG_STREAM_TELEPORT);
+  spot = course.holes[rng_below(&spawn_rng, course.header->holeCount)];
+  hole = (Pos){ spot.x, spot.y };
+  if (course.header->spawn.x != COURSE_RANDOM)
+    ball = (Pos){ course.header->spawn.x, course.header->spawn.y };
+  else
+    ball = random_spot(&spawn_rng, &course, BALL_SIZE, true);
+  check(r, 0, TRACE_BALL_POS, TRACE_PACK_POS(ball.x, ball.y), NULL);
+  check(r, 0, TRACE_HOLE_POS, TRACE_PACK_POS(hole.x, hole.y), NULL);
+  /* The first teleporter of the course, or off the screen without one      */
+  if (course.header->teleporterCount > 0)
+    value = TRACE_PACK_POS(course.teleporters[0].entry.x, course.teleporters[0].entry.y);
+  else
+    value = TRACE_PACK_POS(-320, -240);
+  check(r, 0, TRACE_TELEPORTER_POS, value, NULL);
+
+  /* Records of a tick are used or skipped by the next one; a record stuck
+     behind that would stall the replay, so it ends it                      */
+  for (tick = 1; r->in.have && r->in.next.tick + 1 >= tick; tick++) {
+    /* inputScript                                                           */
+    skip(r, tick);
+    while (traceReaderInput(&r->in, tick, &input)) {
+      switch (input.type) {
+        case TRACE_HIT:
+          if (hits < HIT_QUEUE)
+            hits++;
+          break;
+        case TRACE_POWER:
+          if ((input.value < 0 && power > SHOT_MIN_POWER) || (input.value > 0 && power < SHOT_MAX_POWER))
+            power += input.value;
+          break;
+        case TRACE_ANGLE:
+          direction = input.value;
+          break;
+      }
+    }
+
+    /* ballScript                                                            */
+    if (!flying && hits > 0) {
+      hits--;
+      score++;
+      shot_start = ball;
+      launchVelocity(direction, power, &vx, &vy);
+      flying = true;
+    }
+    if (flying) {
+      if (ballStopped(vx, vy)) {
+        flying = false;
+        hits = 0;                       /* presses made during the flight     */
+      } else {
+        stepCourse(&course, &ball, &vx, &vy);
+        if (courseHazardAt(&course, ball)) {
+          score++;                      /* water: penalty, back to the start  */
+          ball = shot_start;
+          check(r, tick, TRACE_BALL_POS, TRACE_PACK_POS(ball.x, ball.y), NULL);
+          vx = vy = 0;
+        }
+      }
+    }
+
+    /* teleportScript                                                        */
+    int index = courseTeleporterAt(&course, ball, BALL_GLCD_WIDTH, ENV_GLCD_WIDTH);
+    if (index >= 0) {
+      spot = course.teleporters[index].exit;
+      if (spot.x != COURSE_RANDOM)
+        ball = (Pos){ spot.x, spot.y };
+      else
+        ball = random_spot(&teleport_rng, &course, ENV_SIZE, false);
+      check(r, tick, TRACE_BALL_POS, TRACE_PACK_POS(ball.x, ball.y), NULL);
+      vx = vy = 0;
+    }
+
+    /* endGameScript                                                         */
+    bool won = spritesOverlap(ball, BALL_GLCD_WIDTH, hole, ENV_GLCD_WIDTH);
+    if (won || score > MAX_GOLF_SCORE) {
+      check(r, tick, TRACE_END, (score << 1) | won, NULL);
+      say("  %s with %d strokes at tick %u\n", won ? "won" : "lost", score, tick);
+      return tick;
+    }
+  }
+
+  say("  trace ended at tick %u before the game did\n", tick);
+  r->desyncs++;
+  return tick;
+}
+
+/* A copy of the records with record `k` left out (extra false) or recorded
+   twice, the second time after the last record of its tick (extra true)    */
+static int copy_trace (uint8_t *out, uint32_t seed, const TraceRecord *records, int count, int k, bool extra) {
+  uint32_t prev = 0;
+  int n = traceEncodeHeader(out, seed);
+
+  for (int j = 0; j < count; j++) {
+    if (j != k || extra) {
+      n += traceEncode(&out[n], prev, &records[j]);
+      prev = records[j].tick;
+    }
+    if (extra && j >= k && records[j].tick == records[k].tick && (j + 1 == count || records[j + 1].tick > prev)) {
+      n += traceEncode(&out[n], prev, &records[k]);
+      extra = false;
+    }
+  }
+  return n;
+}
+
+/* -c: replays the trace again with each checkpoint in turn dropped, then
+   recorded twice, as if the board had lost or repeated it. The replay must
+   resync like the board does: one more desync, for the missing or the extra
+   checkpoint, and the game ends on the same tick. The course and the end
+   record are left alone: without them there is no game, or no end.         */
+static int vary_checkpoints (const uint8_t *data, int length, uint32_t seed, uint32_t ticks, int desyncs) {
+  static TraceRecord records[1 << 16];
+  static uint8_t copy[1 << 20];
+  TraceReader in;
+  int count = 0, tried = 0, failures = 0;
+
+  traceReaderStart(&in, data, length);
+  for (; in.have && count < (int)(sizeof(records) / sizeof(records[0])); traceReaderAdvance(&in))
+    records[count++] = in.next;
+
+  for (int k = 0; k < count; k++) {
+    if (traceIsInput(records[k].type) || records[k].type == TRACE_COURSE || records[k].type == TRACE_END)
+      continue;
+    for (int extra = 0; extra <= 1; extra++) {
+      Reader r = { .desyncs = 0 };
+      uint32_t end;
+
+      traceReaderStart(&r.in, copy, copy_trace(copy, seed, records, count, k, extra));
+      quiet = true;
+      end = replay(&r, seed);
+      quiet = false;
+      tried++;
+      if (end != ticks || r.desyncs != desyncs + 1) {
+        printf("  FAIL with the %s at tick %u %s: ended at tick %u with %d desyncs\n", type_names[records[k].type],
+               records[k].tick, extra ? "twice" : "dropped", end, r.desyncs);
+        failures++;
+      }
+    }
+  }
+  printf("  %d checkpoints dropped or doubled in turn: %s\n", tried, failures ? "FAILED" : "each resynced");
+  return failures;
+}
+
+static double now_sec (void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+int main (int argc, char **argv) {
+  static uint8_t data[1 << 20];
+  bool print = false, drops = false;
+  int failed = 0, opt;
+
+  while ((opt = getopt(argc, argv, "dc")) != -1) {
+    if (opt == 'd') {
+      print = true;
+    } else if (opt == 'c') {
+      drops = true;
+    } else {
+      fprintf(stderr, "usage: %s [-d] [-c] trace...\n", argv[0]);
+      return 2;
+    }
+  }
+
+  for (int i = optind; i < argc; i++) {
+    FILE *f = fopen(argv[i], "rb");
+    Reader r = { .desyncs = 0 };
+    uint32_t seed, ticks;
+    int length;
+    double t;
+
+    if (!f) {
+      perror(argv[i]);
+      failed++;
+      continue;
+    }
+    length = (int)fread(data, 1, sizeof(data), f);
+    fclose(f);
+
+    if (!traceDecodeHeader(data, length, &seed)) {
+      printf("%s: not a trace\n", argv[i]);
+      failed++;
+      continue;
+    }
+    printf("%s: seed 0x%08x, %d bytes\n", argv[i], seed, length);
+    if (print)
+      dump(data, length);
+
+    traceReaderStart(&r.in, data, length);
+
+    t = now_sec();
+    ticks = replay(&r, seed);
+    t = now_sec() - t;
+
+    printf("  %s, %u ticks in %.3f ms (%.0fx real time)\n", r.desyncs ? "DIVERGED" : "matched",
+           ticks, t * 1000, t > 0 ? ticks * TICK_MS / (t * 1000) : 0);
+    failed += r.desyncs != 0;
+    if (drops)
+      failed += vary_checkpoints(data, length, seed, ticks, r.desyncs) != 0;
+  }
+
+  return failed ? 1 : 0;
+}
@@ -0,0 +1,101 @@
+/*----------------------------------------------------------------------------
+* Name:    trajbench.c
+* Purpose: Benchmark of the batched trajectory kernel against the scalar
+*          reference, checking that both give identical results
+* Note(s): Build from the repository root, e.g. with AVX2:
+*            cc -O2 -std=gnu11 -mavx2 -I. -Iexample-game tools/trajbench.c \
+*               tools/trajectory.c physics.c -lm -o trajbench
+*          Usage: trajbench [balls] [rounds]
+*----------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "trajectory.h"
+
+#define MIN_POWER   2
+#define MAX_POWER   8
+#define NUM_ANGLES  342
+
+static int32_t *lane_alloc (size_t n) {
+  return aligned_alloc(32, n * sizeof(int32_t));
+}
+
+static void batch_init (TrajBatch *b, size_t n) {
+  memset(b, 0, sizeof(*b));
+  b->n = n;
+  b->x = lane_alloc(n);  b->y = lane_alloc(n);
+  b->vx = lane_alloc(n); b->vy = lane_alloc(n);
+  b->state = lane_alloc(n);
+  b->hole.x = 200;       b->hole.y = 60;
+  b->teleporter.x = 100; b->teleporter.y = 150;
+  b->ballSize = b->holeSize = b->teleporterSize = 3;
+}
+
+static void batch_fill (TrajBatch *b, unsigned seed) {
+  size_t i;
+
+  srand(seed);
+  for (i = 0; i < b->n; i++) {
+    Pos start = { 5 + rand() % 311, 5 + rand() % 231 };
+    traj_launch(b, i, start, rand() % NUM_ANGLES, MIN_POWER + rand() % (MAX_POWER - MIN_POWER + 1));
+  }
+}
+
+static double now_sec (void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/* Runs every lane to completion, returns lane-steps per second              */
+static double bench (TrajBatch *b, size_t (*step)(TrajBatch *), int rounds, unsigned long long *laneSteps) {
+  double t, elapsed = 0;
+  int r;
+
+  *laneSteps = 0;
+  for (r = 0; r < rounds; r++) {
+    size_t moving;
+    batch_fill(b, r + 1);
+    t = now_sec();
+    do {
+      moving = step(b);
+      *laneSteps += moving;
+    } while (moving != 0);
+    elapsed += now_sec() - t;
+  }
+  return *laneSteps / elapsed;
+}
+
+int main (int argc, char **argv) {
+  size_t n = (argc > 1) ? strtoul(argv[1], NULL, 0) : 4096;
+  int rounds = (argc > 2) ? atoi(argv[2]) : 200;
+  TrajBatch ref, vec;
+  unsigned long long refSteps, vecSteps;
+  double refRate, vecRate;
+  size_t i;
+
+  n = (n + TRAJ_LANES - 1) / TRAJ_LANES * TRAJ_LANES;
+  batch_init(&ref, n);
+  batch_init(&vec, n);
+
+  refRate = bench(&ref, traj_step_scalar, rounds, &refSteps);
+  vecRate = bench(&vec, traj_step, rounds, &vecSteps);
+
+  /* Both ran the last round from the same seed, so every lane must match    */
+  for (i = 0; i < n; i++) {
+    if (ref.x[i] != vec.x[i] || ref.y[i] != vec.y[i] || ref.vx[i] != vec.vx[i] ||
+        ref.vy[i] != vec.vy[i] || ref.state[i] != vec.state[i]) {
+      printf("MISMATCH at lane %zu: scalar (%d,%d v%d,%d s%d) %s (%d,%d v%d,%d s%d)\n", i,
+             ref.x[i], ref.y[i], ref.vx[i], ref.vy[i], ref.state[i], traj_kernel_name(),
+             vec.x[i], vec.y[i], vec.vx[i], vec.vy[i], vec.state[i]);
+      return 1;
+    }
+  }
+
+  printf("%zu balls x %d rounds\n", n, rounds);
+  printf("scalar: %.1f M lane-steps/s\n", refRate / 1e6);
+  printf("%-6s: %.1f M lane-steps/s (%.2fx)\n", traj_kernel_name(), vecRate / 1e6, vecRate / refRate);
+  return 0;
+}
@@ -0,0 +1,233 @@
+/*----------------------------------------------------------------------------
+* Name:    trajectory.c
+* Purpose: Batched ball trajectory integrator for the host tools
+*----------------------------------------------------------------------------*/
+#include "trajectory.h"
+
+#if defined(__AVX2__)
+  #include <immintrin.h>
+#elif defined(__SSE2__)
+  #include <emmintrin.h>
+#endif
+
+/* Sprite extents used by spritesOverlap(): x always spans SPRITE_COLS
+   scaled pixels, y spans the bitmap size scaled                             */
+#define EXTENT_X  (SPRITE_COLS * SPRITE_SCALE)
+
+/*******************************************************************************
+* Put a ball in a lane with the launch velocity of a shot                      *
+*******************************************************************************/
+void traj_launch (TrajBatch *b, size_t lane, Pos start, int32_t angle, uint32_t power) {
+  int vx, vy;
+
+  launchVelocity(angle, power, &vx, &vy);
+  b->x[lane]  = start.x;
+  b->y[lane]  = start.y;
+  b->vx[lane] = vx;
+  b->vy[lane] = vy;
+  b->state[lane] = ballStopped(vx, vy) ? TRAJ_STOPPED : TRAJ_MOVING;
+}
+
+/*******************************************************************************
+* Reference kernel: one step of every moving lane, scalar                      *
+*   Return:       number of lanes still moving                                 *
+*******************************************************************************/
+size_t traj_step_scalar (TrajBatch *b) {
+  size_t i, moving = 0;
+
+  for (i = 0; i < b->n; i++) {
+    Pos p;
+    int vx, vy;
+
+    if (b->state[i] != TRAJ_MOVING)
+      continue;
+
+    p.x = b->x[i]; p.y = b->y[i];
+    vx = b->vx[i]; vy = b->vy[i];
+    stepPhysics(&p, &vx, &vy);
+    b->x[i] = p.x; b->y[i] = p.y;
+    b->vx[i] = vx; b->vy[i] = vy;
+
+    if (spritesOverlap(p, b->ballSize, b->teleporter, b->teleporterSize))
+      b->state[i] = TRAJ_TELEPORTED;
+    else if (spritesOverlap(p, b->ballSize, b->hole, b->holeSize))
+      b->state[i] = TRAJ_HOLED;
+    else if (ballStopped(vx, vy))
+      b->state[i] = TRAJ_STOPPED;
+    else
+      moving++;
+  }
+  return moving;
+}
+
+#if defined(__AVX2__) || defined(__SSE2__)
+
+/* The same kernel for AVX2 (8 lanes) and SSE2 (4 lanes); only the type and
+   the intrinsic names differ.                                               */
+#if defined(__AVX2__)
+  typedef __m256i vint;
+  #define VLANES          8
+  #define v_load(p)       _mm256_load_si256((const __m256i *)(p))
+  #define v_store(p, a)   _mm256_store_si256((__m256i *)(p), (a))
+  #define v_set1(k)       _mm256_set1_epi32(k)
+  #define v_add(a, b)     _mm256_add_epi32(a, b)
+  #define v_sub(a, b)     _mm256_sub_epi32(a, b)
+  #define v_and(a, b)     _mm256_and_si256(a, b)
+  #define v_or(a, b)      _mm256_or_si256(a, b)
+  #define v_andnot(a, b)  _mm256_andnot_si256(a, b)     /* ~a & b             */
+  #define v_xor(a, b)     _mm256_xor_si256(a, b)
+  #define v_srai(a, k)    _mm256_srai_epi32(a, k)
+  #define v_srli(a, k)    _mm256_srli_epi32(a, k)
+  #define v_mulhi16(a, b) _mm256_mulhi_epu16(a, b)
+  #define v_gt(a, b)      _mm256_cmpgt_epi32(a, b)
+  #define v_eq(a, b)      _mm256_cmpeq_epi32(a, b)
+  #define v_blend(a, b, m) _mm256_blendv_epi8(a, b, m)  /* m ? b : a          */
+  #define v_any(m)        (_mm256_movemask_epi8(m) != 0)
+#else
+  typedef __m128i vint;
+  #define VLANES          4
+  #define v_load(p)       _mm_load_si128((const __m128i *)(p))
+  #define v_store(p, a)   _mm_store_si128((__m128i *)(p), (a))
+  #define v_set1(k)       _mm_set1_epi32(k)
+  #define v_add(a, b)     _mm_add_epi32(a, b)
+  #define v_sub(a, b)     _mm_sub_epi32(a, b)
+  #define v_and(a, b)     _mm_and_si128(a, b)
+  #define v_or(a, b)      _mm_or_si128(a, b)
+  #define v_andnot(a, b)  _mm_andnot_si128(a, b)
+  #define v_xor(a, b)     _mm_xor_si128(a, b)
+  #define v_srai(a, k)    _mm_srai_epi32(a, k)
+  #define v_srli(a, k)    _mm_srli_epi32(a, k)
+  #define v_mulhi16(a, b) _mm_mulhi_epu16(a, b)
+  #define v_gt(a, b)      _mm_cmpgt_epi32(a, b)
+  #define v_eq(a, b)      _mm_cmpeq_epi32(a, b)
+  #define v_blend(a, b, m) _mm_or_si128(_mm_and_si128(m, b), _mm_andnot_si128(m, a))
+  #define v_any(m)        (_mm_movemask_epi8(m) != 0)
+#endif
+
+/* One axis of stepPhysics() for VLANES balls, on the magnitude a = |v|:
+     t = p + sign(v) * ((a + VELOCITY_ONE / 2) >> VELOCITY_SHIFT)
+     p = t <= 0 ? 0 : t >= max ? max : t
+     a = a - ((a * FRICTION_FAIRWAY) >> FRICTION_SHIFT)
+     v = sign(v) * a, negated where out of bounds
+   a and the friction both fit in 16 bits (speeds stay below 256 pixels per
+   step), so the product's top half is one unsigned 16-bit multiply-high.
+   Returns the new |v| for the stop test.                                    */
+static __inline vint step_axis (vint *p, vint *v, vint max) {
+  vint zero = v_set1(0);
+  vint sgn  = v_srai(*v, 31);                          /* -1 where v < 0     */
+  vint a    = v_sub(v_xor(*v, sgn), sgn);
+  vint move = v_srli(v_add(a, v_set1(VELOCITY_ONE / 2)), VELOCITY_SHIFT);
+  vint t    = v_add(*p, v_sub(v_xor(move, sgn), sgn));
+  vint in   = v_and(v_gt(t, zero), v_gt(max, t));      /* 0 < t < max        */
+  vint low  = v_gt(v_set1(1), t);                      /* t <= 0             */
+  vint pos  = v_blend(v_blend(max, zero, low), t, in);
+  vint flip = v_xor(sgn, v_xor(in, v_set1(-1)));       /* final sign         */
+
+  a  = v_sub(a, v_mulhi16(a, v_set1(FRICTION_FAIRWAY)));
+  *p = pos;
+  *v = v_sub(v_xor(a, flip), flip);
+  return a;
+}
+
+/* spritesOverlap() of every lane against one target                         */
+static __inline vint overlap (vint x, vint y, Pos t, int ballSize, int targetSize) {
+  vint tx = v_set1(t.x), ty = v_set1(t.y);
+  vint ex = v_set1(EXTENT_X);
+  vint a  = v_gt(v_add(tx, ex), x);                                 /* ax < bx2 */
+  vint b  = v_gt(v_add(x, ex), tx);                                 /* ax2 > bx */
+  vint c  = v_gt(v_add(ty, v_set1(targetSize * SPRITE_SCALE)), y); /* ay < by2 */
+  vint d  = v_gt(v_add(y, v_set1(ballSize * SPRITE_SCALE)), ty);   /* ay2 > by */
+  return v_and(v_and(a, b), v_and(c, d));
+}
+
+static size_t traj_step_simd (TrajBatch *b) {
+  size_t i, moving = 0;
+  vint maxX  = v_set1(COURSE_WIDTH);
+  vint maxY  = v_set1(COURSE_HEIGHT);
+  vint kMove = v_set1(TRAJ_MOVING);
+  vint kStop = v_set1(STOP_SPEED);
+
+  for (i = 0; i < b->n; i += VLANES) {
+    vint st   = v_load(&b->state[i]);
+    vint live = v_eq(st, kMove);
+    vint x, y, vx, vy, ax, ay, tele, hole, stop, done;
+
+    if (!v_any(live))
+      continue;
+
+    x  = v_load(&b->x[i]);  y  = v_load(&b->y[i]);
+    vx = v_load(&b->vx[i]); vy = v_load(&b->vy[i]);
+    {
+      vint nx = x, ny = y, nvx = vx, nvy = vy;
+      ax = step_axis(&nx, &nvx, maxX);
+      ay = step_axis(&ny, &nvy, maxY);
+      x  = v_blend(x,  nx,  live);
+      y  = v_blend(y,  ny,  live);
+      vx = v_blend(vx, nvx, live);
+      vy = v_blend(vy, nvy, live);
+    }
+
+    /* Same priority as the scalar kernel: teleporter, hole, stopped         */
+    tele = v_and(live, overlap(x, y, b->teleporter, b->ballSize, b->teleporterSize));
+    hole = v_andnot(tele, v_and(live, overlap(x, y, b->hole, b->ballSize, b->holeSize)));
+    stop = v_andnot(v_or(tele, hole), v_and(live, v_and(v_gt(kStop, ax), v_gt(kStop, ay))));
+    done = v_or(v_or(tele, hole), stop);
+
+    st = v_blend(st, v_set1(TRAJ_TELEPORTED), tele);
+    st = v_blend(st, v_set1(TRAJ_HOLED), hole);
+    st = v_blend(st, v_set1(TRAJ_STOPPED), stop);
+
+    v_store(&b->x[i], x);   v_store(&b->y[i], y);
+    v_store(&b->vx[i], vx); v_store(&b->vy[i], vy);
+    v_store(&b->state[i], st);
+
+    {
+      int32_t still[VLANES], k;
+      v_store(still, v_andnot(done, live));
+      for (k = 0; k < VLANES; k++)
+        moving += (still[k] != 0);
+    }
+  }
+  return moving;
+}
+
+#endif
+
+/*******************************************************************************
+* One step of every moving lane with the best kernel for this build            *
+*   Return:       number of lanes still moving                                 *
+*******************************************************************************/
+size_t traj_step (TrajBatch *b) {
+#if defined(__AVX2__) || defined(__SSE2__)
+  return traj_step_simd(b);
+#else
+  return traj_step_scalar(b);
+#endif
+}
+
+/*******************************************************************************
+* Step until no lane is moving                                                 *
+*   Return:       number of ball steps taken over all lanes                    *
+*******************************************************************************/
+size_t traj_run (TrajBatch *b) {
+  size_t i, moving = 0, laneSteps = 0;
+
+  for (i = 0; i < b->n; i++)
+    moving += (b->state[i] == TRAJ_MOVING);
+
+  while (moving != 0) {
+    laneSteps += moving;
+    moving = traj_step(b);
+  }
+  return laneSteps;
+}
+
+const char *traj_kernel_name (void) {
+#if defined(__AVX2__)
+  return "avx2";
+#elif defined(__SSE2__)
+  return "sse2";
+#else
+  return "scalar";
+#endif
+}
@@ -0,0 +1,45 @@
+/*----------------------------------------------------------------------------
+* Name:    trajectory.h
+* Purpose: Batched ball trajectory integrator for the host tools
+* Note(s): Structure-of-arrays state so many balls are stepped per
+*          instruction (AVX2: 8 lanes, SSE2: 4 lanes, or scalar). Each lane
+*          follows exactly the same rules as stepPhysics() in physics.c
+*          (fairway friction), including the edge clamp and bounce, and
+*          stops when it overlaps the hole or the teleporter, like the game
+*          scripts do.
+*----------------------------------------------------------------------------*/
+#ifndef __TRAJECTORY_H
+#define __TRAJECTORY_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "physics.h"
+
+/* Per-lane outcome                                                           */
+#define TRAJ_MOVING      0
+#define TRAJ_STOPPED     1
+#define TRAJ_HOLED       2
+#define TRAJ_TELEPORTED  3
+
+/* Arrays must hold a multiple of TRAJ_LANES entries and be 32-byte aligned   */
+#define TRAJ_LANES       8
+
+typedef struct {
+  int32_t *x, *y;
+  int32_t *vx, *vy;
+  int32_t *state;                       /* TRAJ_* per lane                    */
+  size_t   n;                           /* multiple of TRAJ_LANES             */
+
+  Pos hole;                             /* top corners of the targets         */
+  Pos teleporter;
+  int ballSize, holeSize, teleporterSize;   /* bitmap widths, as in the game  */
+} TrajBatch;
+
+void   traj_launch     (TrajBatch *b, size_t lane, Pos start, int32_t angle, uint32_t power);
+size_t traj_step       (TrajBatch *b);      /* best available kernel          */
+size_t traj_step_scalar(TrajBatch *b);      /* reference kernel               */
+size_t traj_run        (TrajBatch *b);      /* step until every lane is done, */
+                                            /* returns ball steps taken       */
+const char *traj_kernel_name (void);
+
+#endif /* __TRAJECTORY_H */
@@ -0,0 +1,158 @@
+#include "trace.h"
+
+#include <stdio.h>
+#include "uart.h"
+
+TraceMode traceMode = TRACE_OFF;
+uint32_t traceDesyncs = 0;
+
+// Tick of the last record written; records store the difference
+static uint32_t lastTick = 0;
+
+// Replay buffer and the reader going through it, only built into the replay builds
+#if defined(TRACE_REPLAY) || defined(TRACE_REPLAY_FAST)
+static uint8_t replayBuffer[TRACE_MAX_BYTES];
+static int replayLength = 0;
+static TraceReader replay;
+#endif
+
+
+static void writeRecord(uint32_t tick, uint8_t type, int32_t value) {
+	TraceRecord record = { tick, type, value };
+	uint8_t bytes[TRACE_MAX_RECORD];
+	int length = traceEncode(bytes, lastTick, &record);
+
+	UARTSend(TRACE_PORT, bytes, length);
+	lastTick = tick;
+}
+
+#if defined(TRACE_REPLAY) || defined(TRACE_REPLAY_FAST)
+// Resyncs past recorded records the replay went by without using (see TraceReader)
+static void skipRecords(uint32_t tick) {
+	uint32_t skipped = traceReaderSkip(&replay, tick);
+
+	if (skipped > 0) {
+		traceDesyncs += skipped;
+		printf("Replay desync at tick %u (%u records skipped)\n", tick, skipped);
+	}
+}
+
+// Receives a whole trace (up to its TRACE_END record) before the game starts, so a replay never waits on the UART
+static void receiveTrace(void) {
+	TraceRecord record;
+	uint32_t tick = 0;
+	int pos = TRACE_HEADER_SIZE;
+
+	printf("Waiting for trace on UART%d\n", TRACE_PORT);
+
+	while (replayLength < TRACE_MAX_BYTES) {
+		replayLength += UARTRecieve(TRACE_PORT, &replayBuffer[replayLength], TRACE_MAX_BYTES - replayLength);
+
+		if (replayLength < TRACE_HEADER_SIZE) {
+			continue;
+		}
+
+		// Walk the records received so far until the end record
+		int used;
+		while ((used = traceDecode(&replayBuffer[pos], replayLength - pos, tick, &record)) > 0) {
+			pos += used;
+			tick = record.tick;
+			if (record.type == TRACE_END) {
+				replayLength = pos;
+				return;
+			}
+		}
+	}
+
+	printf("Trace too long, replaying the first %d bytes\n", TRACE_MAX_BYTES);
+}
+#endif
+
+// Starts recording or replaying and returns the seed to play with: `seed` itself when recording,
+// the recorded seed when replaying. Call before setupGame, with the kernel not yet running.
+uint32_t traceStart(TraceMode mode, uint32_t seed) {
+	uint8_t header[TRACE_HEADER_SIZE];
+
+	traceMode = mode;
+	lastTick = 0;
+
+	if (mode == TRACE_OFF) {
+		return seed;
+	}
+
+	UARTInit(TRACE_PORT, TRACE_BAUD);
+
+	if (mode == TRACE_RECORDING) {
+		traceEncodeHeader(header, seed);
+		UARTSend(TRACE_PORT, header, TRACE_HEADER_SIZE);
+		return seed;
+	}
+
+#if defined(TRACE_REPLAY) || defined(TRACE_REPLAY_FAST)
+	receiveTrace();
+	if (!traceDecodeHeader(replayBuffer, replayLength, &seed)) {
+		printf("Bad trace header, playing live\n");
+		traceMode = TRACE_OFF;
+		return seed;
+	}
+
+	traceReaderStart(&replay, replayBuffer, replayLength);
+#else
+	printf("Built without TRACE_REPLAY, playing live\n");
+	traceMode = TRACE_OFF;
+#endif
+	return seed;
+}
+
+// Records an input applied at `tick`
+void traceInput(uint32_t tick, uint8_t type, int32_t value) {
+	if (traceMode == TRACE_RECORDING) {
+		writeRecord(tick, type, value);
+	}
+}
+
+// Replay: hands out the recorded inputs of `tick` one at a time, in recorded order
+bool traceNextInput(uint32_t tick, TraceRecord *record) {
+#if defined(TRACE_REPLAY) || defined(TRACE_REPLAY_FAST)
+	if (traceMode != TRACE_REPLAYING) {
+		return false;
+	}
+
+	skipRecords(tick);
+	return traceReaderInput(&replay, tick, record);
+#else
+	return false;
+#endif
+}
+
+// Records a checkpoint, or during a replay compares it with the recorded one
+void traceCheck(uint32_t tick, uint8_t type, int32_t value) {
+	if (traceMode == TRACE_RECORDING) {
+		writeRecord(tick, type, value);
+	}
+#if defined(TRACE_REPLAY) || defined(TRACE_REPLAY_FAST)
+	else if (traceMode == TRACE_REPLAYING) {
+		TraceRecord recorded;
+
+		skipRecords(tick);
+		if (!traceReaderCheck(&replay, tick, type, &recorded) || recorded.value != value) {
+			traceDesyncs++;
+			printf("Replay desync at tick %u (type %u)\n", tick, type);
+		}
+	}
+#endif
+}
+
+// Ends the trace with the result of the game
+void traceFinish(uint32_t tick, int score, bool won) {
+	traceCheck(tick, TRACE_END, (score << 1) | (won ? 1 : 0));
+
+	// A dropped byte misaligns every record after it, so such a trace must not be replayed
+	if (traceMode == TRACE_RECORDING && UARTTxDropped(TRACE_PORT) != 0) {
+		printf("Trace damaged: %u bytes dropped on UART%d, do not replay it\n", UARTTxDropped(TRACE_PORT), TRACE_PORT);
+	}
+
+	if (traceMode == TRACE_REPLAYING) {
+		printf("Replay %s (%u desyncs)\n", traceDesyncs == 0 ? "matched" : "diverged", traceDesyncs);
+	}
+}
@@ -0,0 +1,38 @@
+#ifndef GAME_TRACE
+#define GAME_TRACE
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "tracefmt.h"
+
+// Input trace recorder and replayer. Every game input is applied on the script thread at a script tick,
+// so the RNG seed plus the (tick, input) list is enough to play the same game again. Checkpoints (spawn,
+// teleports, final score) are recorded too, so a replay can tell where it stopped matching.
+//
+// Build with TRACE_RECORD to stream the trace out of TRACE_PORT, or with TRACE_REPLAY to read a trace from
+// TRACE_PORT at startup and play it instead of the live inputs (TRACE_REPLAY_FAST: without waiting for ticks).
+
+#define TRACE_PORT 1
+#define TRACE_BAUD 115200
+
+// Largest trace that can be replayed on the board; the buffer is only built into the replay builds
+#define TRACE_MAX_BYTES 4096
+
+typedef enum {
+	TRACE_OFF = 0,
+	TRACE_RECORDING,
+	TRACE_REPLAYING
+} TraceMode;
+
+extern TraceMode traceMode;
+
+// Number of checkpoints that did not match during a replay
+extern uint32_t traceDesyncs;
+
+uint32_t traceStart(TraceMode mode, uint32_t seed);
+void traceInput(uint32_t tick, uint8_t type, int32_t value);
+bool traceNextInput(uint32_t tick, TraceRecord *record);
+void traceCheck(uint32_t tick, uint8_t type, int32_t value);
+void traceFinish(uint32_t tick, int score, bool won);
+
+#endif
@@ -0,0 +1,142 @@
+#include "tracefmt.h"
+
+
+static int putVarint(uint8_t *out, uint32_t value) {
+	int n = 0;
+
+	while (value >= 0x80) {
+		out[n++] = (uint8_t)(value | 0x80);
+		value >>= 7;
+	}
+	out[n++] = (uint8_t)value;
+	return n;
+}
+
+// Returns the number of bytes used, or 0 if the input ends before the varint does
+static int getVarint(const uint8_t *in, int length, uint32_t *value) {
+	uint32_t result = 0;
+
+	for (int n = 0; n < length && n < 5; ++n) {
+		result |= (uint32_t)(in[n] & 0x7F) << (7 * n);
+		if (!(in[n] & 0x80)) {
+			*value = result;
+			return n + 1;
+		}
+	}
+	return 0;
+}
+
+int traceEncodeHeader(uint8_t *out, uint32_t seed) {
+	for (int i = 0; i < 4; ++i) {
+		out[i] = (uint8_t)(TRACE_MAGIC >> (8 * i));
+		out[5 + i] = (uint8_t)(seed >> (8 * i));
+	}
+	out[4] = TRACE_VERSION;
+	return TRACE_HEADER_SIZE;
+}
+
+bool traceDecodeHeader(const uint8_t *in, int length, uint32_t *seed) {
+	uint32_t magic = 0;
+
+	if (length < TRACE_HEADER_SIZE) {
+		return false;
+	}
+
+	*seed = 0;
+	for (int i = 0; i < 4; ++i) {
+		magic |= (uint32_t)in[i] << (8 * i);
+		*seed |= (uint32_t)in[5 + i] << (8 * i);
+	}
+	return magic == TRACE_MAGIC && in[4] == TRACE_VERSION;
+}
+
+// Writes one record (at most TRACE_MAX_RECORD bytes) and returns its length.
+// Values are zigzag coded so small negative changes stay one byte.
+int traceEncode(uint8_t *out, uint32_t prevTick, const TraceRecord *record) {
+	uint32_t zigzag = ((uint32_t)record->value << 1) ^ (uint32_t)(record->value >> 31);
+	int n = 0;
+
+	out[n++] = record->type;
+	n += putVarint(&out[n], record->tick - prevTick);
+	n += putVarint(&out[n], zigzag);
+	return n;
+}
+
+// Reads one record; returns the bytes consumed, or 0 if the record is not complete yet
+int traceDecode(const uint8_t *in, int length, uint32_t prevTick, TraceRecord *record) {
+	uint32_t delta, zigzag;
+	int n = 1, used;
+
+	if (length < 1) {
+		return 0;
+	}
+
+	used = getVarint(&in[n], length - n, &delta);
+	if (used == 0) {
+		return 0;
+	}
+	n += used;
+
+	used = getVarint(&in[n], length - n, &zigzag);
+	if (used == 0) {
+		return 0;
+	}
+	n += used;
+
+	record->type = in[0];
+	record->tick = prevTick + delta;
+	record->value = (int32_t)(zigzag >> 1) ^ -(int32_t)(zigzag & 1);
+	return n;
+}
+
+bool traceIsInput(uint8_t type) {
+	return type <= TRACE_ANGLE;
+}
+
+// Starts reading the records of a trace whose header has been checked
+void traceReaderStart(TraceReader *reader, const uint8_t *data, int length) {
+	reader->data = data;
+	reader->length = length;
+	reader->pos = TRACE_HEADER_SIZE;
+	reader->next.tick = 0;
+	reader->have = false;
+	traceReaderAdvance(reader);
+}
+
+void traceReaderAdvance(TraceReader *reader) {
+	int used = traceDecode(&reader->data[reader->pos], reader->length - reader->pos, reader->next.tick, &reader->next);
+
+	reader->have = used > 0;
+	reader->pos += used;
+}
+
+// Drops the records of ticks before `tick`, which a replay can no longer use, and returns how many
+uint32_t traceReaderSkip(TraceReader *reader, uint32_t tick) {
+	uint32_t skipped = 0;
+
+	while (reader->have && reader->next.tick < tick) {
+		traceReaderAdvance(reader);
+		skipped++;
+	}
+	return skipped;
+}
+
+// Hands out the recorded inputs of `tick` one at a time, in recorded order
+bool traceReaderInput(TraceReader *reader, uint32_t tick, TraceRecord *record) {
+	if (!reader->have || reader->next.tick != tick || !traceIsInput(reader->next.type)) {
+		return false;
+	}
+	*record = reader->next;
+	traceReaderAdvance(reader);
+	return true;
+}
+
+// Takes the recorded checkpoint `type` of `tick` if it is next; if not, the next record is left for its own tick
+bool traceReaderCheck(TraceReader *reader, uint32_t tick, uint8_t type, TraceRecord *record) {
+	if (!reader->have || reader->next.tick != tick || reader->next.type != type) {
+		return false;
+	}
+	*record = reader->next;
+	traceReaderAdvance(reader);
+	return true;
+}
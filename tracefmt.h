@@ -0,0 +1,65 @@
+#ifndef TRACE_FORMAT
+#define TRACE_FORMAT
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Binary game trace: a header with the RNG seed, then one record per input event or checkpoint.
+// A record is its type byte, the script ticks since the previous record and a value, both as
+// variable-length integers (7 bits per byte, low bits first), so a typical input costs 3 bytes.
+// Pure C so the recorder on the board and the host tools share it.
+
+#define TRACE_MAGIC 0x43525447UL   // "GTRC" little-endian
+#define TRACE_VERSION 4          // 2: games are played on a course (TRACE_COURSE), 3: exact wall collision,
+                                   // 4: terrain friction
+#define TRACE_HEADER_SIZE 9        // magic, version, seed
+#define TRACE_MAX_RECORD 11        // type + two 5-byte varints
+
+typedef enum {
+	// Inputs, same values as InputType
+	TRACE_HIT = 0,
+	TRACE_POWER,                   // value: power change (+1 / -1)
+	TRACE_ANGLE,                   // value: new raw pot angle
+
+	// Checkpoints the replay compares against what it computed
+	TRACE_BALL_POS,                // value: TRACE_PACK_POS of the ball after spawning or teleporting
+	TRACE_HOLE_POS,
+	TRACE_TELEPORTER_POS,
+	TRACE_END,                     // value: (score << 1) | won
+	TRACE_COURSE                   // value: index of the built-in course played (recorded before the spawn)
+} TraceType;
+
+typedef struct {
+	uint32_t tick;                 // script tick the record applies to
+	uint8_t type;
+	int32_t value;
+} TraceRecord;
+
+#define TRACE_PACK_POS(x, y) ((int32_t)(((uint32_t)(x) << 16) | ((uint32_t)(y) & 0xFFFF)))
+#define TRACE_POS_X(v) ((int32_t)((uint32_t)(v) >> 16))
+#define TRACE_POS_Y(v) ((int32_t)((uint32_t)(v) & 0xFFFF))
+
+// Reads a trace one record at a time. The board's replay and tracetool both go through it, so they resync the
+// same way: records before the current tick (a checkpoint the replay did not reach, or an extra one) are
+// skipped, and a checkpoint the replay makes that the trace lacks leaves the next record where it is.
+typedef struct {
+	const uint8_t *data;
+	int length;
+	int pos;
+	TraceRecord next;              // the record at pos, while `have`
+	bool have;
+} TraceReader;
+
+int traceEncodeHeader(uint8_t *out, uint32_t seed);
+bool traceDecodeHeader(const uint8_t *in, int length, uint32_t *seed);
+int traceEncode(uint8_t *out, uint32_t prevTick, const TraceRecord *record);
+int traceDecode(const uint8_t *in, int length, uint32_t prevTick, TraceRecord *record);
+bool traceIsInput(uint8_t type);
+
+void traceReaderStart(TraceReader *reader, const uint8_t *data, int length);
+void traceReaderAdvance(TraceReader *reader);
+uint32_t traceReaderSkip(TraceReader *reader, uint32_t tick);
+bool traceReaderInput(TraceReader *reader, uint32_t tick, TraceRecord *record);
+bool traceReaderCheck(TraceReader *reader, uint32_t tick, uint8_t type, TraceRecord *record);
+
+#endif